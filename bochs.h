@@ -172,6 +172,8 @@ void print_tree(bx_param_c *node, int level = 0);
 // #define BX_OUTP(addr, val, len)  bx_pc_system.outp(addr, val, len)
 #define BX_INP(addr, len)           bx_devices.inp(addr, len)
 #define BX_OUTP(addr, val, len)     bx_devices.outp(addr, val, len)
+#define BX_BULK_INP(addr, ptr, len, count)  bx_devices.bulk_inp(addr, ptr, len, count)
+#define BX_BULK_OUTP(addr, ptr, len, count) bx_devices.bulk_outp(addr, ptr, len, count)
 #define BX_TICK1()                  bx_pc_system.tick1()
 #define BX_TICKN(n)                 bx_pc_system.tickn(n)
 #define BX_INTR                     bx_pc_system.INTR
@@ -236,6 +238,10 @@ void print_tree(bx_param_c *node, int level = 0);
         bx_dbg_lin_memory_access(cpu, lin, phy, len, pl, rw, data)
 #  define BX_DBG_PHY_MEMORY_ACCESS(cpu, phy, len, rw, data) \
         bx_dbg_phy_memory_access(cpu, phy, len, rw, data)
+// memory access through a TLB host pointer, watched pages never get one
+#  define BX_DBG_TLB_MEMORY_ACCESS(cpu, lin, phy, len, pl, rw, data) do { \
+        if (BX_CPU(cpu)->trace_mem) bx_dbg_lin_memory_access(cpu, lin, phy, len, pl, rw, data); \
+      } while (0)
 #else  // #if BX_DEBUGGER
 // debugger not compiled in, use empty stubs
 #  define BX_DBG_ASYNC_INTR 1
@@ -246,6 +252,7 @@ void print_tree(bx_param_c *node, int level = 0);
 #  define BX_DBG_IO_REPORT(port, size, op, val)                      /* empty */
 #  define BX_DBG_LIN_MEMORY_ACCESS(cpu, lin, phy, len, pl, rw, data) /* empty */
 #  define BX_DBG_PHY_MEMORY_ACCESS(cpu, phy, len, rw, data)          /* empty */
+#  define BX_DBG_TLB_MEMORY_ACCESS(cpu, lin, phy, len, pl, rw, data) /* empty */
 #endif  // #if BX_DEBUGGER
 
 #define MAGIC_LOGNUM 0x12345678
@@ -481,6 +488,8 @@ BOCHSAPI extern Bit32u apic_id_mask;
 
 #include "memory/memory.h"
 #include "pc_system.h"
+#include "replay.h"
+#include "profile.h"
 #include "plugin.h"
 #include "gui/gui.h"
 
@@ -497,6 +506,9 @@ extern bx_bool bx_gui_sighandler;
 
 #define BX_PATHNAME_LEN 512
 
+// longest chain of incremental checkpoints followed on restore
+#define BX_SR_MAX_CHAIN 1024
+
 #define BX_KBD_XT_TYPE        0
 #define BX_KBD_AT_TYPE        1
 #define BX_KBD_MF_TYPE        2
@@ -92,6 +92,7 @@ static void bx_unnest_infile(void);
 static void bx_get_command(void);
 static void bx_dbg_print_guard_results();
 static void bx_dbg_breakpoint_changed(void);
+static void* bx_dbg_grow_bpoints(void *table, unsigned *max, unsigned num, unsigned initial, size_t size);
 
 bx_guard_t        bx_guard;
 
@@ -119,8 +120,32 @@ static char  bx_disasm_tbuf[512];
 static bx_bool watchpoint_continue = 0;
 unsigned num_write_watchpoints = 0;
 unsigned num_read_watchpoints = 0;
-bx_watchpoint write_watchpoint[BX_DBG_MAX_WATCHPONTS];
-bx_watchpoint read_watchpoint[BX_DBG_MAX_WATCHPONTS];
+unsigned max_write_watchpoints = 0;
+unsigned max_read_watchpoints = 0;
+bx_watchpoint *write_watchpoint = NULL;
+bx_watchpoint *read_watchpoint = NULL;
+
+// Index of the watched physical pages. Each page holds the sorted list
+// of the disjoint byte ranges watched within the page, so a memory access
+// is checked with one hash lookup and a binary search. Pages in the index
+// never get a host pointer in the TLB, accesses to other pages take the
+// usual fast path without looking at the watchpoints.
+typedef struct {
+  Bit16u begin, end; // offsets within the page, inclusive
+} bx_dbg_watch_range_t;
+
+typedef struct {
+  Bit64u key;        // physical page number + 1, 0 marks a free slot
+  unsigned num_ranges, max_ranges;
+  bx_dbg_watch_range_t *range;
+} bx_dbg_watch_page_t;
+
+typedef struct {
+  bx_dbg_watch_page_t *page;
+  unsigned mask;
+} bx_dbg_watch_index_t;
+
+static bx_dbg_watch_index_t read_watch_index, write_watch_index;
 
 #define DBG_PRINTF_BUFFER_LEN 1024
 
@@ -165,6 +190,12 @@ int bx_dbg_main(void)
   bx_guard.async.irq = 1;
   bx_guard.async.dma = 1;
 
+  // the debugger GUI stores up to BX_DBG_MAX_WATCHPONTS directly
+  read_watchpoint = (bx_watchpoint *) bx_dbg_grow_bpoints(NULL,
+      &max_read_watchpoints, 0, BX_DBG_MAX_WATCHPONTS, sizeof(bx_watchpoint));
+  write_watchpoint = (bx_watchpoint *) bx_dbg_grow_bpoints(NULL,
+      &max_write_watchpoints, 0, BX_DBG_MAX_WATCHPONTS, sizeof(bx_watchpoint));
+
   memset(&bx_debugger, 0, sizeof(bx_debugger));
   bx_debugger.auto_disassemble = 1;
   bx_debugger.disassemble_size = 0;
@@ -212,15 +243,7 @@ int bx_dbg_main(void)
   // would have to be so hard.  First initialize guard_found, since it is used
   // in the disassembly code to decide what instruction to print.
   for (int i=0; i<BX_SMP_PROCESSORS; i++) {
-    BX_CPU(i)->guard_found.cs = BX_CPU(i)->sregs[BX_SEG_REG_CS].selector.value;
-    BX_CPU(i)->guard_found.eip = BX_CPU(i)->get_instruction_pointer();
-    BX_CPU(i)->guard_found.laddr =
-      BX_CPU(i)->get_laddr(BX_SEG_REG_CS, BX_CPU(i)->guard_found.eip);
-    // 00 - 16 bit, 01 - 32 bit, 10 - 64-bit, 11 - illegal
-    if (BX_CPU(i)->sregs[BX_SEG_REG_CS].cache.u.segment.d_b)
-      BX_CPU(i)->guard_found.code_32_64 |= 0x1;
-    if (BX_CPU(i)->get_cpu_mode() == BX_MODE_LONG_64)
-      BX_CPU(i)->guard_found.code_32_64 |= 0x2;
+    BX_CPU(i)->dbg_set_guard_location();
   }
   // finally, call the usual function to print the disassembly
   dbg_printf("Next at t=" FMT_LL "d\n", bx_pc_system.time_ticks());
@@ -537,28 +560,155 @@ void bx_dbg_watchpoint_continue(bx_bool watch_continue)
   }
 }
 
-void bx_dbg_check_memory_watchpoints(unsigned cpu, bx_phy_address phy, unsigned len, unsigned rw)
+static bx_dbg_watch_page_t* bx_dbg_find_watch_page(bx_dbg_watch_index_t *index, Bit64u page, bx_bool create)
+{
+  if (! index->page) return NULL;
+
+  Bit64u key = page + 1;
+  unsigned n = (unsigned)(page ^ (page >> 13)) & index->mask;
+  while (index->page[n].key) {
+    if (index->page[n].key == key) return &index->page[n];
+    n = (n + 1) & index->mask;
+  }
+  if (! create) return NULL;
+  index->page[n].key = key;
+  return &index->page[n];
+}
+
+static void bx_dbg_add_watch_range(bx_dbg_watch_page_t *p, unsigned begin, unsigned end)
+{
+  unsigned i, n;
+
+  bx_dbg_watch_range_t *range = (bx_dbg_watch_range_t *) bx_dbg_grow_bpoints(p->range,
+      &p->max_ranges, p->num_ranges, 4, sizeof(bx_dbg_watch_range_t));
+  if (! range) {
+    if (p->num_ranges == 0) {
+      dbg_printf("No memory left for watchpoints\n");
+      return;
+    }
+    // out of memory, watch the page as a whole
+    p->range[0].begin = 0;
+    p->range[0].end = 0xfff;
+    p->num_ranges = 1;
+    return;
+  }
+  p->range = range;
+
+  // insert sorted by begin and merge with overlapping or adjacent ranges
+  for (i = 0; i < p->num_ranges && p->range[i].begin <= begin; i++);
+  for (n = p->num_ranges; n > i; n--)
+    p->range[n] = p->range[n-1];
+  p->range[i].begin = begin;
+  p->range[i].end = end;
+  p->num_ranges++;
+
+  for (i = 0, n = 0; i < p->num_ranges; i++) {
+    if (n > 0 && p->range[i].begin <= p->range[n-1].end + 1) {
+      if (p->range[i].end > p->range[n-1].end)
+        p->range[n-1].end = p->range[i].end;
+    }
+    else {
+      p->range[n++] = p->range[i];
+    }
+  }
+  p->num_ranges = n;
+}
+
+static void bx_dbg_build_watch_index(bx_dbg_watch_index_t *index, bx_watchpoint *wp, unsigned num)
+{
+  unsigned i, pages = 0;
+
+  if (index->page) {
+    for (i = 0; i <= index->mask; i++) {
+      if (index->page[i].range) free(index->page[i].range);
+    }
+    delete [] index->page;
+    index->page = NULL;
+    index->mask = 0;
+  }
+
+  for (i = 0; i < num; i++) {
+    Bit32u len = wp[i].len ? wp[i].len : 1;
+    pages += (unsigned)(((wp[i].addr + len - 1) >> 12) - (wp[i].addr >> 12) + 1);
+  }
+  if (pages == 0) return;
+
+  unsigned size = 16;
+  while (size < 2*pages) size <<= 1;
+  index->page = new bx_dbg_watch_page_t[size];
+  index->mask = size - 1;
+  memset(index->page, 0, size * sizeof(bx_dbg_watch_page_t));
+
+  for (i = 0; i < num; i++) {
+    Bit32u len = wp[i].len ? wp[i].len : 1;
+    bx_phy_address addr = wp[i].addr, end = wp[i].addr + len - 1;
+    while (1) {
+      bx_phy_address page_end = addr | 0xfff;
+      bx_dbg_add_watch_range(bx_dbg_find_watch_page(index, addr >> 12, 1),
+          (unsigned)(addr & 0xfff), (unsigned)((end < page_end ? end : page_end) & 0xfff));
+      if (page_end >= end) break;
+      addr = page_end + 1;
+    }
+  }
+}
+
+static bx_bool bx_dbg_watch_hit(bx_dbg_watch_index_t *index, bx_phy_address phy, unsigned len)
 {
   bx_phy_address phy_end = phy + len - 1;
 
+  while (1) {
+    bx_dbg_watch_page_t *p = bx_dbg_find_watch_page(index, phy >> 12, 0);
+    if (p) {
+      unsigned begin = (unsigned)(phy & 0xfff);
+      unsigned end = ((phy_end >> 12) == (phy >> 12)) ? (unsigned)(phy_end & 0xfff) : 0xfff;
+      // find the first range ending at or after the access
+      unsigned lo = 0, hi = p->num_ranges;
+      while (lo < hi) {
+        unsigned mid = (lo + hi) / 2;
+        if (p->range[mid].end < begin) lo = mid + 1;
+        else hi = mid;
+      }
+      if (lo < p->num_ranges && p->range[lo].begin <= end)
+        return 1;
+    }
+    if ((phy_end >> 12) == (phy >> 12)) break;
+    phy = (phy | 0xfff) + 1;
+  }
+
+  return 0;
+}
+
+// Rebuild the watched page index and drop the host pointers which the
+// TLBs may hold for newly watched pages
+void bx_dbg_watchpoints_changed(void)
+{
+  bx_dbg_build_watch_index(&read_watch_index, read_watchpoint, num_read_watchpoints);
+  bx_dbg_build_watch_index(&write_watch_index, write_watchpoint, num_write_watchpoints);
+
+  for (int cpu=0; cpu < BX_SMP_PROCESSORS; cpu++)
+    BX_CPU(cpu)->TLB_flush();
+}
+
+bx_bool bx_dbg_watched_page(bx_phy_address ppf)
+{
+  return bx_dbg_find_watch_page(&read_watch_index, ppf >> 12, 0) != NULL ||
+         bx_dbg_find_watch_page(&write_watch_index, ppf >> 12, 0) != NULL;
+}
+
+void bx_dbg_check_memory_watchpoints(unsigned cpu, bx_phy_address phy, unsigned len, unsigned rw)
+{
   if (rw & 1) {
     // Check for physical write watch points
-    for (unsigned i = 0; i < num_write_watchpoints; i++) {
-      bx_phy_address watch_end = write_watchpoint[i].addr + write_watchpoint[i].len - 1;
-      if (watch_end < phy || phy_end < write_watchpoint[i].addr) continue;
+    if (bx_dbg_watch_hit(&write_watch_index, phy, len)) {
       BX_CPU(cpu)->watchpoint  = phy;
       BX_CPU(cpu)->break_point = BREAK_POINT_WRITE;
-      break;
     }
   }
   else {
     // Check for physical read watch points
-    for (unsigned i = 0; i < num_read_watchpoints; i++) {
-      bx_phy_address watch_end = read_watchpoint[i].addr + read_watchpoint[i].len - 1;
-      if (watch_end < phy || phy_end < read_watchpoint[i].addr) continue;
+    if (bx_dbg_watch_hit(&read_watch_index, phy, len)) {
       BX_CPU(cpu)->watchpoint  = phy;
       BX_CPU(cpu)->break_point = BREAK_POINT_READ;
-      break;
     }
   }
 }
@@ -1461,6 +1611,8 @@ void bx_dbg_show_param_command(const char *param)
   }
   else {
     node = SIM->get_param(param, dbg_cpu_list);
+    if (node == NULL)
+      node = SIM->get_param(param);  // options and statistics
     if (node)
       print_tree(node, 0);
     else
@@ -1628,20 +1780,26 @@ void bx_dbg_print_watchpoints(void)
 void bx_dbg_watch(int type, bx_phy_address address, Bit32u len)
 {
   if (type == BX_READ) {
-    if (num_read_watchpoints == BX_DBG_MAX_WATCHPONTS) {
-      dbg_printf("Too many read watchpoints (%d)\n", BX_DBG_MAX_WATCHPONTS);
+    bx_watchpoint *wp = (bx_watchpoint *) bx_dbg_grow_bpoints(read_watchpoint,
+        &max_read_watchpoints, num_read_watchpoints, BX_DBG_MAX_WATCHPONTS, sizeof(bx_watchpoint));
+    if (! wp) {
+      dbg_printf("Too many read watchpoints (%d)\n", num_read_watchpoints);
       return;
     }
+    read_watchpoint = wp;
     read_watchpoint[num_read_watchpoints].addr = address;
     read_watchpoint[num_read_watchpoints].len = len;
     num_read_watchpoints++;
     dbg_printf("read watchpoint at 0x" FMT_PHY_ADDRX " len=%d inserted\n", address, len);
   }
   else if (type == BX_WRITE) {
-    if (num_write_watchpoints == BX_DBG_MAX_WATCHPONTS) {
-      dbg_printf("Too many write watchpoints (%d)\n", BX_DBG_MAX_WATCHPONTS);
+    bx_watchpoint *wp = (bx_watchpoint *) bx_dbg_grow_bpoints(write_watchpoint,
+        &max_write_watchpoints, num_write_watchpoints, BX_DBG_MAX_WATCHPONTS, sizeof(bx_watchpoint));
+    if (! wp) {
+      dbg_printf("Too many write watchpoints (%d)\n", num_write_watchpoints);
       return;
     }
+    write_watchpoint = wp;
     write_watchpoint[num_write_watchpoints].addr = address;
     write_watchpoint[num_write_watchpoints].len = len;
     num_write_watchpoints++;
@@ -1650,11 +1808,14 @@ void bx_dbg_watch(int type, bx_phy_address address, Bit32u len)
   else {
     dbg_printf("bx_dbg_watch: broken watchpoint type");
   }
+
+  bx_dbg_watchpoints_changed();
 }
 
 void bx_dbg_unwatch_all()
 {
   num_read_watchpoints = num_write_watchpoints = 0;
+  bx_dbg_watchpoints_changed();
   dbg_printf("All watchpoints removed\n");
 }
 
@@ -1683,6 +1844,8 @@ void bx_dbg_unwatch(bx_phy_address address)
       break;
     }
   }
+
+  bx_dbg_watchpoints_changed();
 }
 
 void bx_dbg_continue_command(void)
@@ -1728,6 +1891,7 @@ one_more:
     for (cpu=0; cpu < BX_SMP_PROCESSORS; cpu++) {
       Bit64u cpu_icount = BX_CPU(cpu)->guard_found.icount;
       BX_CPU(cpu)->cpu_loop(quantum);
+      BX_CPU(cpu)->dbg_set_guard_location();
       Bit32u executed = BX_CPU(cpu)->guard_found.icount - cpu_icount;
       if (executed > max_executed) max_executed = executed;
       // set stop flag if a guard found other than icount or halted
@@ -1796,6 +1960,7 @@ void bx_dbg_stepN_command(int cpu, Bit32u count)
     bx_guard.interrupt_requested = 0;
     BX_CPU(cpu)->guard_found.guard_found = 0;
     BX_CPU(cpu)->cpu_loop(count);
+    BX_CPU(cpu)->dbg_set_guard_location();
   }
 #if BX_SUPPORT_SMP
   else {
@@ -1806,6 +1971,7 @@ void bx_dbg_stepN_command(int cpu, Bit32u count)
         bx_guard.interrupt_requested = 0;
         BX_CPU(ncpu)->guard_found.guard_found = 0;
         BX_CPU(ncpu)->cpu_loop(1);
+        BX_CPU(ncpu)->dbg_set_guard_location();
         // set stop flag if a guard found other than icount or halted
         unsigned found = BX_CPU(ncpu)->guard_found.guard_found;
         stop_reason_t reason = (stop_reason_t) BX_CPU(ncpu)->stop_reason;
@@ -1959,6 +2125,78 @@ void bx_dbg_print_guard_results(void)
 #endif
 }
 
+// Grow a breakpoint table if it is full. Returns the (possibly moved)
+// table or NULL if no memory is left.
+static void* bx_dbg_grow_bpoints(void *table, unsigned *max, unsigned num, unsigned initial, size_t size)
+{
+  if (num < *max) return table;
+  unsigned new_max = (*max) ? (*max) * 2 : initial;
+  void *new_table = realloc(table, new_max * size);
+  if (new_table) *max = new_max;
+  return new_table;
+}
+
+static void bx_dbg_add_bpoint_page(unsigned type, Bit64u page)
+{
+  Bit64u key = (page << 3) | type;
+  unsigned n = (unsigned)(page ^ (page >> 13)) & bx_guard.iaddr.page_hash_mask;
+  while (bx_guard.iaddr.page_hash[n]) {
+    if (bx_guard.iaddr.page_hash[n] == key) return;
+    n = (n + 1) & bx_guard.iaddr.page_hash_mask;
+  }
+  bx_guard.iaddr.page_hash[n] = key;
+}
+
+// Rebuild the set of pages holding enabled instruction breakpoints. The
+// CPUs look it up when they start fetching from a new code page and only
+// compare the breakpoints after instructions on such pages.
+static void bx_dbg_update_bpoint_pages(void)
+{
+  unsigned i, count = 0;
+
+  if (bx_guard.iaddr.page_hash) {
+    delete [] bx_guard.iaddr.page_hash;
+    bx_guard.iaddr.page_hash = NULL;
+    bx_guard.iaddr.page_hash_mask = 0;
+  }
+
+#if (BX_DBG_MAX_VIR_BPOINTS > 0)
+  count += bx_guard.iaddr.num_virtual;
+#endif
+#if (BX_DBG_MAX_LIN_BPOINTS > 0)
+  count += bx_guard.iaddr.num_linear;
+#endif
+#if (BX_DBG_MAX_PHY_BPOINTS > 0)
+  count += bx_guard.iaddr.num_physical;
+#endif
+  if (count == 0) return;
+
+  unsigned size = 16;
+  while (size < 2*count) size <<= 1;
+  bx_guard.iaddr.page_hash = new Bit64u[size];
+  bx_guard.iaddr.page_hash_mask = size - 1;
+  memset(bx_guard.iaddr.page_hash, 0, size * sizeof(Bit64u));
+
+#if (BX_DBG_MAX_VIR_BPOINTS > 0)
+  for (i=0; i<bx_guard.iaddr.num_virtual; i++) {
+    if (bx_guard.iaddr.vir[i].enabled)
+      bx_dbg_add_bpoint_page(BX_DBG_GUARD_IADDR_VIR, bx_guard.iaddr.vir[i].eip >> 12);
+  }
+#endif
+#if (BX_DBG_MAX_LIN_BPOINTS > 0)
+  for (i=0; i<bx_guard.iaddr.num_linear; i++) {
+    if (bx_guard.iaddr.lin[i].enabled)
+      bx_dbg_add_bpoint_page(BX_DBG_GUARD_IADDR_LIN, bx_guard.iaddr.lin[i].addr >> 12);
+  }
+#endif
+#if (BX_DBG_MAX_PHY_BPOINTS > 0)
+  for (i=0; i<bx_guard.iaddr.num_physical; i++) {
+    if (bx_guard.iaddr.phy[i].enabled)
+      bx_dbg_add_bpoint_page(BX_DBG_GUARD_IADDR_PHY, bx_guard.iaddr.phy[i].addr >> 12);
+  }
+#endif
+}
+
 void bx_dbg_breakpoint_changed(void)
 {
 #if (BX_DBG_MAX_VIR_BPOINTS > 0)
@@ -1981,6 +2219,8 @@ void bx_dbg_breakpoint_changed(void)
   else
     bx_guard.guard_for &= ~BX_DBG_GUARD_IADDR_PHY;
 #endif
+
+  bx_dbg_update_bpoint_pages();
 }
 
 void bx_dbg_en_dis_breakpoint_command(unsigned handle, bx_bool enable)
@@ -2135,11 +2375,14 @@ int bx_dbg_vbreakpoint_command(BreakpointKind bk, Bit32u cs, bx_address eip)
     return -1;
   }
 
-  if (bx_guard.iaddr.num_virtual >= BX_DBG_MAX_VIR_BPOINTS) {
+  bx_dbg_vir_bpoint_t *vir = (bx_dbg_vir_bpoint_t *) bx_dbg_grow_bpoints(bx_guard.iaddr.vir,
+      &bx_guard.iaddr.max_virtual, bx_guard.iaddr.num_virtual,
+      BX_DBG_MAX_VIR_BPOINTS, sizeof(bx_dbg_vir_bpoint_t));
+  if (! vir) {
     dbg_printf("Error: no more virtual breakpoint slots left.\n");
-    dbg_printf("Error: see BX_DBG_MAX_VIR_BPOINTS.\n");
     return -1;
   }
+  bx_guard.iaddr.vir = vir;
 
   bx_guard.iaddr.vir[bx_guard.iaddr.num_virtual].cs  = cs;
   bx_guard.iaddr.vir[bx_guard.iaddr.num_virtual].eip = eip;
@@ -2147,7 +2390,7 @@ int bx_dbg_vbreakpoint_command(BreakpointKind bk, Bit32u cs, bx_address eip)
   int BpId = (int)bx_guard.iaddr.vir[bx_guard.iaddr.num_virtual].bpoint_id;
   bx_guard.iaddr.vir[bx_guard.iaddr.num_virtual].enabled=1;
   bx_guard.iaddr.num_virtual++;
-  bx_guard.guard_for |= BX_DBG_GUARD_IADDR_VIR;
+  bx_dbg_breakpoint_changed();
   return BpId;
 
 #else
@@ -2165,18 +2408,21 @@ int bx_dbg_lbreakpoint_command(BreakpointKind bk, bx_address laddress)
     return -1;
   }
 
-  if (bx_guard.iaddr.num_linear >= BX_DBG_MAX_LIN_BPOINTS) {
+  bx_dbg_lin_bpoint_t *lin = (bx_dbg_lin_bpoint_t *) bx_dbg_grow_bpoints(bx_guard.iaddr.lin,
+      &bx_guard.iaddr.max_linear, bx_guard.iaddr.num_linear,
+      BX_DBG_MAX_LIN_BPOINTS, sizeof(bx_dbg_lin_bpoint_t));
+  if (! lin) {
     dbg_printf("Error: no more linear breakpoint slots left.\n");
-    dbg_printf("Error: see BX_DBG_MAX_LIN_BPOINTS.\n");
     return -1;
   }
+  bx_guard.iaddr.lin = lin;
 
   bx_guard.iaddr.lin[bx_guard.iaddr.num_linear].addr = laddress;
   int BpId = (bk == bkStepOver) ? 0 : bx_debugger.next_bpoint_id++;
   bx_guard.iaddr.lin[bx_guard.iaddr.num_linear].bpoint_id = BpId;
   bx_guard.iaddr.lin[bx_guard.iaddr.num_linear].enabled=1;
   bx_guard.iaddr.num_linear++;
-  bx_guard.guard_for |= BX_DBG_GUARD_IADDR_LIN;
+  bx_dbg_breakpoint_changed();
   return BpId;
 
 #else
@@ -2194,18 +2440,21 @@ int bx_dbg_pbreakpoint_command(BreakpointKind bk, bx_phy_address paddress)
     return -1;
   }
 
-  if (bx_guard.iaddr.num_physical >= BX_DBG_MAX_PHY_BPOINTS) {
+  bx_dbg_phy_bpoint_t *phy = (bx_dbg_phy_bpoint_t *) bx_dbg_grow_bpoints(bx_guard.iaddr.phy,
+      &bx_guard.iaddr.max_physical, bx_guard.iaddr.num_physical,
+      BX_DBG_MAX_PHY_BPOINTS, sizeof(bx_dbg_phy_bpoint_t));
+  if (! phy) {
     dbg_printf("Error: no more physical breakpoint slots left.\n");
-    dbg_printf("Error: see BX_DBG_MAX_PHY_BPOINTS.\n");
     return -1;
   }
+  bx_guard.iaddr.phy = phy;
 
   bx_guard.iaddr.phy[bx_guard.iaddr.num_physical].addr = paddress;
   bx_guard.iaddr.phy[bx_guard.iaddr.num_physical].bpoint_id = bx_debugger.next_bpoint_id++;
   int BpId = (int)bx_guard.iaddr.phy[bx_guard.iaddr.num_physical].bpoint_id;
   bx_guard.iaddr.phy[bx_guard.iaddr.num_physical].enabled=1;
   bx_guard.iaddr.num_physical++;
-  bx_guard.guard_for |= BX_DBG_GUARD_IADDR_PHY;
+  bx_dbg_breakpoint_changed();
   return BpId;
 #else
   dbg_printf("Error: physical breakpoint support not compiled in.\n");
@@ -305,6 +305,8 @@ void bx_dbg_phy_memory_access(unsigned cpu, bx_phy_address phy, unsigned len, un
 
 // check memory access for watchpoints
 void bx_dbg_check_memory_watchpoints(unsigned cpu, bx_phy_address phy, unsigned len, unsigned rw);
+void bx_dbg_watchpoints_changed(void);
+bx_bool bx_dbg_watched_page(bx_phy_address ppf);
 
 // commands that work with Bochs param tree
 void bx_dbg_restore_command(const char *param_name, const char *path);
@@ -379,38 +381,51 @@ void bx_dbg_exit(int code);
 
 #define BX_DBG_GUARD_CTRL_C        0x0100
 
+typedef struct {
+  Bit32u cs;  // only use 16 bits
+  bx_address eip;
+  unsigned bpoint_id;
+  bx_bool enabled;
+} bx_dbg_vir_bpoint_t;
+
+typedef struct {
+  bx_address addr;
+  unsigned bpoint_id;
+  bx_bool enabled;
+} bx_dbg_lin_bpoint_t;
+
+typedef struct {
+  bx_phy_address addr;
+  unsigned bpoint_id;
+  bx_bool enabled;
+} bx_dbg_phy_bpoint_t;
+
 typedef struct {
   unsigned guard_for;
 
-  // instruction address breakpoints
+  // instruction address breakpoints, the tables start with
+  // BX_DBG_MAX_xxx_BPOINTS entries and grow when they are full
   struct {
 #if (BX_DBG_MAX_VIR_BPOINTS > 0)
-    unsigned num_virtual;
-    struct {
-      Bit32u cs;  // only use 16 bits
-      bx_address eip;
-      unsigned bpoint_id;
-      bx_bool enabled;
-    } vir[BX_DBG_MAX_VIR_BPOINTS];
+    unsigned num_virtual, max_virtual;
+    bx_dbg_vir_bpoint_t *vir;
 #endif
 
 #if (BX_DBG_MAX_LIN_BPOINTS > 0)
-    unsigned num_linear;
-    struct {
-      bx_address addr;
-      unsigned bpoint_id;
-      bx_bool enabled;
-    } lin[BX_DBG_MAX_LIN_BPOINTS];
+    unsigned num_linear, max_linear;
+    bx_dbg_lin_bpoint_t *lin;
 #endif
 
 #if (BX_DBG_MAX_PHY_BPOINTS > 0)
-    unsigned num_physical;
-    struct {
-      bx_phy_address addr;
-      unsigned bpoint_id;
-      bx_bool enabled;
-    } phy[BX_DBG_MAX_PHY_BPOINTS];
+    unsigned num_physical, max_physical;
+    bx_dbg_phy_bpoint_t *phy;
 #endif
+
+    // hash set of the 4K pages holding enabled breakpoints, the key
+    // is (page << 3) | BX_DBG_GUARD_IADDR_xxx and 0 marks a free slot.
+    // Pages of virtual breakpoints are pages of eip values.
+    Bit64u *page_hash;
+    unsigned page_hash_mask;
   } iaddr;
 
   // user typed Ctrl-C, requesting simulator stop at next convient spot
@@ -470,10 +485,24 @@ struct bx_watchpoint {
 
 extern unsigned num_write_watchpoints;
 extern unsigned num_read_watchpoints;
-extern bx_watchpoint write_watchpoint[BX_DBG_MAX_WATCHPONTS];
-extern bx_watchpoint read_watchpoint[BX_DBG_MAX_WATCHPONTS];
+extern bx_watchpoint *write_watchpoint;
+extern bx_watchpoint *read_watchpoint;
 extern bx_guard_t bx_guard;
 
+BX_CPP_INLINE bx_bool bx_dbg_bpoint_page(unsigned type, Bit64u page)
+{
+  if (! bx_guard.iaddr.page_hash) return 0;
+  Bit64u key = (page << 3) | type;
+  unsigned n = (unsigned)(page ^ (page >> 13)) & bx_guard.iaddr.page_hash_mask;
+  while (bx_guard.iaddr.page_hash[n]) {
+    if (bx_guard.iaddr.page_hash[n] == key) return 1;
+    n = (n + 1) & bx_guard.iaddr.page_hash_mask;
+  }
+  return 0;
+}
+
+extern unsigned dbg_show_mask;
+
 #define IS_CODE_32(code_32_64) ((code_32_64 & 1) != 0)
 #define IS_CODE_64(code_32_64) ((code_32_64 & 2) != 0)
 
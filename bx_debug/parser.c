@@ -3520,6 +3520,7 @@ yyreduce:
          dbg_printf("show off - toggles off symbolic info\n");
          dbg_printf("show dbg-all - turn on all show flags\n");
          dbg_printf("show dbg-none - turn off all show flags\n");
+         dbg_printf("show \"param\" - show the value of a parameter, e.g. show \"stats\" for the emulator statistics\n");
          free((yyvsp[(1) - (3)].sval));free((yyvsp[(2) - (3)].sval));
        }
     break;
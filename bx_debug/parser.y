@@ -1145,6 +1145,7 @@ help_command:
          dbg_printf("show off - toggles off symbolic info\n");
          dbg_printf("show dbg-all - turn on all show flags\n");
          dbg_printf("show dbg-none - turn off all show flags\n");
+         dbg_printf("show \"param\" - show the value of a parameter, e.g. show \"stats\" for the emulator statistics\n");
          free($1);free($2);
        }
      | BX_TOKEN_HELP BX_TOKEN_CALC '\n'
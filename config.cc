@@ -237,7 +237,7 @@ void bx_init_options()
   bx_param_c *root_param = SIM->get_param(".");
 
   // general options subtree
-  menu = new bx_list_c(root_param, "general", "", 11);
+  menu = new bx_list_c(root_param, "general", "", 16);
 
  // config interface option, set in bochsrc or command line
   static const char *config_interface_list[] = {
@@ -282,6 +282,49 @@ void bx_init_options()
     "Path to data for restore",
     "",
     BX_PATHNAME_LEN);
+  // incremental checkpoints, set by command line arg
+  new bx_param_bool_c(menu,
+      "save_incremental",
+      "Save incremental checkpoints",
+      "Only save the state changed since the last saved or restored checkpoint",
+      0);
+  // binary checkpoint format, set by command line arg
+  new bx_param_bool_c(menu,
+      "save_binary",
+      "Save binary checkpoints",
+      "Save the device state in binary format for a faster restore",
+      0);
+  // live snapshots, set by command line arg
+  new bx_param_bool_c(menu,
+      "save_live",
+      "Save live snapshots",
+      "Write the guest RAM in the background while the simulation keeps running",
+      0);
+  // record and replay of the external inputs, set by command line arg
+  new bx_param_string_c(menu,
+    "record_path",
+    "Path to the input log to record",
+    "Record the external inputs of the simulation to this file",
+    "",
+    BX_PATHNAME_LEN);
+  new bx_param_string_c(menu,
+    "replay_path",
+    "Path to the input log to replay",
+    "Replay the external inputs of the simulation from this file",
+    "",
+    BX_PATHNAME_LEN);
+  // sampling profiler of the guest code, set by command line arg
+  new bx_param_string_c(menu,
+    "profile_path",
+    "Path to the guest profile",
+    "Sample the guest code and write a pprof profile to this file",
+    "",
+    BX_PATHNAME_LEN);
+  new bx_param_num_c(menu,
+      "profile_period",
+      "Profile sampling period",
+      "Number of ticks between two samples of the guest code",
+      1, BX_MAX_BIT32U, BX_PROFILE_DEFAULT_PERIOD);
 
   // benchmarking mode, set by command line arg
   new bx_param_num_c(menu,
@@ -304,7 +347,7 @@ void bx_init_options()
 #endif
 
   // cpu subtree
-  bx_list_c *cpu_param = new bx_list_c(root_param, "cpu", "CPU Options", 8 + BX_SUPPORT_SMP);
+  bx_list_c *cpu_param = new bx_list_c(root_param, "cpu", "CPU Options", 9 + BX_SUPPORT_SMP);
 
   // cpu options
   bx_param_num_c *nprocessors = new bx_param_num_c(cpu_param,
@@ -341,6 +384,10 @@ void bx_init_options()
       "reset_on_triple_fault", "Enable CPU reset on triple fault",
       "Enable CPU reset if triple fault occured (highly recommended)",
       1);
+  new bx_param_bool_c(cpu_param,
+      "idle_skip", "Skip emulated time in idle loops",
+      "Pass the time until the next timer event at once when the guest spins idle",
+      0);
 #if BX_CPU_LEVEL >= 5
   new bx_param_bool_c(cpu_param,
       "ignore_bad_msrs", "Ignore RDMSR/WRMSR to unknown MSR register",
@@ -471,6 +518,34 @@ void bx_init_options()
   host_ramsize->set_ask_format("Enter memory size (MB): [%d] ");
   host_ramsize->set_options(ramsize->USE_SPIN_CONTROL);
 
+  static const char *mem_alloc_names[] = { "heap", "mmap", "hugetlb", "shared", NULL };
+  new bx_param_enum_c(ram,
+      "alloc",
+      "Host memory allocator",
+      "Host allocation method for guest RAM (heap, anonymous mmap with transparent huge pages, hugetlbfs pages or shared memory file)",
+      mem_alloc_names,
+      BX_MEM_ALLOC_HEAP,
+      BX_MEM_ALLOC_HEAP);
+  new bx_param_num_c(ram,
+      "numa_node",
+      "Host NUMA node",
+      "Bind mmap/hugetlb allocated guest RAM to this host NUMA node (-1 = no binding)",
+      -1, BX_MEM_MAX_NUMA_NODE,
+      -1);
+  path = new bx_param_filename_c(ram,
+      "file",
+      "Shared memory file",
+      "Pathname of the file holding guest RAM for the shared allocator (anonymous if empty)",
+      "", BX_PATHNAME_LEN);
+  static const char *mem_save_format_names[] = { "raw", "compact", NULL };
+  new bx_param_enum_c(ram,
+      "save_format",
+      "RAM image format",
+      "Format of the guest RAM image in a saved state (sparse raw file or compact page table with zero and duplicate page elimination)",
+      mem_save_format_names,
+      BX_MEM_SAVE_RAW,
+      BX_MEM_SAVE_RAW);
+
   path = new bx_param_filename_c(rom,
       "path",
       "ROM BIOS image",
@@ -1790,6 +1865,12 @@ void bx_init_options()
   };
   misc = new bx_list_c(menu, "misc", "Misc options", rt_misc_init_list);
   misc->set_options(misc->SHOW_PARENT | misc->SHOW_GROUP_NAME);
+
+  // emulator statistics, the counters are added by the components
+  bx_list_c *stats = new bx_list_c(root_param, "stats", "Emulator statistics",
+                                   BX_MAX_SMP_THREADS_SUPPORTED + 4);
+  new bx_list_c(stats, "io", "Port I/O per device", BX_MAX_STATS_DEVICES);
+  new bx_list_c(stats, "mmio", "Memory mapped I/O per device", BX_MAX_STATS_DEVICES);
 }
 
 void bx_reset_options()
@@ -2608,6 +2689,10 @@ static int parse_line_formatted(const char *context, int num_params, char *param
         if (parse_param_bool(params[i], 22, BXPN_RESET_ON_TRIPLE_FAULT) < 0) {
           PARSE_ERR(("%s: cpu directive malformed.", context));
         }
+      } else if (!strncmp(params[i], "idle_skip=", 10)) {
+        if (parse_param_bool(params[i], 10, BXPN_IDLE_SKIP) < 0) {
+          PARSE_ERR(("%s: cpu directive malformed.", context));
+        }
 #if BX_CPU_LEVEL >= 5
       } else if (!strncmp(params[i], "ignore_bad_msrs=", 16)) {
         if (parse_param_bool(params[i], 16, BXPN_IGNORE_BAD_MSRS) < 0) {
@@ -2705,6 +2790,18 @@ static int parse_line_formatted(const char *context, int num_params, char *param
         SIM->get_param_num(BXPN_HOST_MEM_SIZE)->set(atol(&params[i][5]));
       } else if (!strncmp(params[i], "guest=", 6)) {
         SIM->get_param_num(BXPN_MEM_SIZE)->set(atol(&params[i][6]));
+      } else if (!strncmp(params[i], "alloc=", 6)) {
+        if (!SIM->get_param_enum(BXPN_MEM_ALLOC)->set_by_name(&params[i][6])) {
+          PARSE_ERR(("%s: memory directive: unknown allocator '%s'.", context, &params[i][6]));
+        }
+      } else if (!strncmp(params[i], "numa_node=", 10)) {
+        SIM->get_param_num(BXPN_MEM_NUMA_NODE)->set(atol(&params[i][10]));
+      } else if (!strncmp(params[i], "file=", 5)) {
+        SIM->get_param_string(BXPN_MEM_FILE)->set(&params[i][5]);
+      } else if (!strncmp(params[i], "save_format=", 12)) {
+        if (!SIM->get_param_enum(BXPN_MEM_SAVE_FORMAT)->set_by_name(&params[i][12])) {
+          PARSE_ERR(("%s: memory directive: unknown save format '%s'.", context, &params[i][12]));
+        }
       } else {
         PARSE_ERR(("%s: memory directive malformed.", context));
       }
@@ -3729,8 +3826,16 @@ int bx_write_configuration(const char *rc, int overwrite)
     fprintf(fp, ", options=\"%s\"\n", strptr);
   else
     fprintf(fp, "\n");
-  fprintf(fp, "memory: host=%d, guest=%d\n", SIM->get_param_num(BXPN_HOST_MEM_SIZE)->get(),
-    SIM->get_param_num(BXPN_MEM_SIZE)->get());
+  fprintf(fp, "memory: host=%d, guest=%d, alloc=%s", SIM->get_param_num(BXPN_HOST_MEM_SIZE)->get(),
+    SIM->get_param_num(BXPN_MEM_SIZE)->get(), SIM->get_param_enum(BXPN_MEM_ALLOC)->get_selected());
+  if (SIM->get_param_num(BXPN_MEM_NUMA_NODE)->get() >= 0)
+    fprintf(fp, ", numa_node=%d", SIM->get_param_num(BXPN_MEM_NUMA_NODE)->get());
+  strptr = SIM->get_param_string(BXPN_MEM_FILE)->getptr();
+  if (strlen(strptr) > 0)
+    fprintf(fp, ", file=\"%s\"", strptr);
+  if (SIM->get_param_enum(BXPN_MEM_SAVE_FORMAT)->get() != BX_MEM_SAVE_RAW)
+    fprintf(fp, ", save_format=%s", SIM->get_param_enum(BXPN_MEM_SAVE_FORMAT)->get_selected());
+  fprintf(fp, "\n");
   strptr = SIM->get_param_string(BXPN_ROM_PATH)->getptr();
   if (strlen(strptr) > 0) {
     fprintf(fp, "romimage: file=\"%s\"", strptr);
@@ -3830,6 +3935,7 @@ int bx_write_configuration(const char *rc, int overwrite)
 #endif
   fprintf(fp, "reset_on_triple_fault=%d",
     SIM->get_param_bool(BXPN_RESET_ON_TRIPLE_FAULT)->get());
+  fprintf(fp, ", idle_skip=%d", SIM->get_param_bool(BXPN_IDLE_SKIP)->get());
 #if BX_CPU_LEVEL >= 5
   fprintf(fp, ", ignore_bad_msrs=%d", SIM->get_param_bool(BXPN_IGNORE_BAD_MSRS)->get());
 #endif
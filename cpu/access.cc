@@ -249,7 +249,7 @@ BX_CPU_C::system_read_byte(bx_address laddr)
     BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 1, BX_READ);
     Bit8u *hostAddr = (Bit8u*) (hostPageAddr | pageOffset);
     data = *hostAddr;
-    BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+    BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
         tlbEntry->ppf | pageOffset, 1, 0, BX_READ, (Bit8u*) &data);
     return data;
   }
@@ -272,7 +272,7 @@ BX_CPU_C::system_read_word(bx_address laddr)
     BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 2, BX_READ);
     Bit16u *hostAddr = (Bit16u*) (hostPageAddr | pageOffset);
     ReadHostWordFromLittleEndian(hostAddr, data);
-    BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+    BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
         tlbEntry->ppf | pageOffset, 2, 0, BX_READ, (Bit8u*) &data);
     return data;
   }
@@ -295,7 +295,7 @@ BX_CPU_C::system_read_dword(bx_address laddr)
     BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 4, BX_READ);
     Bit32u *hostAddr = (Bit32u*) (hostPageAddr | pageOffset);
     ReadHostDWordFromLittleEndian(hostAddr, data);
-    BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+    BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
         tlbEntry->ppf | pageOffset, 4, 0, BX_READ, (Bit8u*) &data);
     return data;
   }
@@ -318,7 +318,7 @@ BX_CPU_C::system_read_qword(bx_address laddr)
     BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 8, BX_READ);
     Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
     ReadHostQWordFromLittleEndian(hostAddr, data);
-    BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+    BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
         tlbEntry->ppf | pageOffset, 8, 0, BX_READ, (Bit8u*) &data);
     return data;
   }
@@ -340,7 +340,7 @@ BX_CPU_C::system_write_byte(bx_address laddr, Bit8u data)
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 1, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 1, 0, BX_WRITE, (Bit8u*) &data);
       Bit8u *hostAddr = (Bit8u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -365,7 +365,7 @@ BX_CPU_C::system_write_word(bx_address laddr, Bit16u data)
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 2, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 2, 0, BX_WRITE, (Bit8u*) &data);
       Bit16u *hostAddr = (Bit16u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -390,7 +390,7 @@ BX_CPU_C::system_write_dword(bx_address laddr, Bit32u data)
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 4, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 4, 0, BX_WRITE, (Bit8u*) &data);
       Bit32u *hostAddr = (Bit32u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
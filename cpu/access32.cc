@@ -41,7 +41,12 @@ accessOK:
       laddr = BX_CPU_THIS_PTR get_laddr32(s, offset);
       unsigned tlbIndex = BX_TLB_INDEX_OF(laddr, 0);
       Bit32u lpf = LPFOf(laddr);
-      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_write;
+      if (tlbEntry->lpf != lpf) {
+        tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+        if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & (0x2 | USER_PL)))
+          BX_CPU_THIS_PTR TLB.last_write = *tlbEntry;
+      }
       if (tlbEntry->lpf == lpf) {
         // See if the TLB entry privilege level allows us write access
         // from this CPL.
@@ -49,7 +54,7 @@ accessOK:
           bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
           Bit32u pageOffset = PAGE_OFFSET(laddr);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 1, BX_WRITE);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 1, CPL, BX_WRITE, (Bit8u*) &data);
           Bit8u *hostAddr = (Bit8u*) (hostPageAddr | pageOffset);
           pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -90,7 +95,12 @@ accessOK:
 #else
       Bit32u lpf = LPFOf(laddr);
 #endif    
-      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_write;
+      if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xffe) {
+        tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+        if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & (0x2 | USER_PL)))
+          BX_CPU_THIS_PTR TLB.last_write = *tlbEntry;
+      }
       if (tlbEntry->lpf == lpf) {
         // See if the TLB entry privilege level allows us write access
         // from this CPL.
@@ -98,7 +108,7 @@ accessOK:
           bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
           Bit32u pageOffset = PAGE_OFFSET(laddr);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 2, BX_WRITE);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 2, CPL, BX_WRITE, (Bit8u*) &data);
           Bit16u *hostAddr = (Bit16u*) (hostPageAddr | pageOffset);
           pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -149,7 +159,12 @@ accessOK:
 #else
       Bit32u lpf = LPFOf(laddr);
 #endif    
-      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_write;
+      if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xffc) {
+        tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+        if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & (0x2 | USER_PL)))
+          BX_CPU_THIS_PTR TLB.last_write = *tlbEntry;
+      }
       if (tlbEntry->lpf == lpf) {
         // See if the TLB entry privilege level allows us write access
         // from this CPL.
@@ -157,7 +172,7 @@ accessOK:
           bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
           Bit32u pageOffset = PAGE_OFFSET(laddr);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 4, BX_WRITE);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 4, CPL, BX_WRITE, (Bit8u*) &data);
           Bit32u *hostAddr = (Bit32u*) (hostPageAddr | pageOffset);
           pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -208,7 +223,12 @@ accessOK:
 #else
       Bit32u lpf = LPFOf(laddr);
 #endif    
-      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_write;
+      if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xff8) {
+        tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+        if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & (0x2 | USER_PL)))
+          BX_CPU_THIS_PTR TLB.last_write = *tlbEntry;
+      }
       if (tlbEntry->lpf == lpf) {
         // See if the TLB entry privilege level allows us write access
         // from this CPL.
@@ -216,7 +236,7 @@ accessOK:
           bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
           Bit32u pageOffset = PAGE_OFFSET(laddr);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 8, BX_WRITE);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 8, CPL, BX_WRITE, (Bit8u*) &data);
           Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
           pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -273,7 +293,7 @@ accessOK:
           bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
           Bit32u pageOffset = PAGE_OFFSET(laddr);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 16, BX_WRITE);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
             tlbEntry->ppf | pageOffset, 16, CPL, BX_WRITE, (Bit8u*) data);
           Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
           pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -326,7 +346,7 @@ accessOK:
           bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
           Bit32u pageOffset = PAGE_OFFSET(laddr);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 16, BX_WRITE);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
             tlbEntry->ppf | pageOffset, 16, CPL, BX_WRITE, (Bit8u*) data);
           Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
           pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -367,7 +387,12 @@ accessOK:
       laddr = BX_CPU_THIS_PTR get_laddr32(s, offset);
       unsigned tlbIndex = BX_TLB_INDEX_OF(laddr, 0);
       Bit32u lpf = LPFOf(laddr);
-      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_read;
+      if (tlbEntry->lpf != lpf) {
+        tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+        if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & USER_PL))
+          BX_CPU_THIS_PTR TLB.last_read = *tlbEntry;
+      }
       if (tlbEntry->lpf == lpf) {
         // See if the TLB entry privilege level allows us read access
         // from this CPL.
@@ -377,7 +402,7 @@ accessOK:
           Bit8u *hostAddr = (Bit8u*) (hostPageAddr | pageOffset);
           data = *hostAddr;
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 1, BX_READ);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
             tlbEntry->ppf | pageOffset, 1, CPL, BX_READ, (Bit8u*) &data);
           return data;
         }
@@ -416,7 +441,12 @@ accessOK:
 #else
       Bit32u lpf = LPFOf(laddr);
 #endif    
-      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_read;
+      if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xffe) {
+        tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+        if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & USER_PL))
+          BX_CPU_THIS_PTR TLB.last_read = *tlbEntry;
+      }
       if (tlbEntry->lpf == lpf) {
         // See if the TLB entry privilege level allows us read access
         // from this CPL.
@@ -426,7 +456,7 @@ accessOK:
           Bit16u *hostAddr = (Bit16u*) (hostPageAddr | pageOffset);
           ReadHostWordFromLittleEndian(hostAddr, data);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 2, BX_READ);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 2, CPL, BX_READ, (Bit8u*) &data);
           return data;
         }
@@ -475,7 +505,12 @@ accessOK:
 #else
       Bit32u lpf = LPFOf(laddr);
 #endif    
-      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_read;
+      if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xffc) {
+        tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+        if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & USER_PL))
+          BX_CPU_THIS_PTR TLB.last_read = *tlbEntry;
+      }
       if (tlbEntry->lpf == lpf) {
         // See if the TLB entry privilege level allows us read access
         // from this CPL.
@@ -485,7 +520,7 @@ accessOK:
           Bit32u *hostAddr = (Bit32u*) (hostPageAddr | pageOffset);
           ReadHostDWordFromLittleEndian(hostAddr, data);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 4, BX_READ);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 4, CPL, BX_READ, (Bit8u*) &data);
           return data;
         }
@@ -534,7 +569,12 @@ accessOK:
 #else
       Bit32u lpf = LPFOf(laddr);
 #endif    
-      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_read;
+      if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xff8) {
+        tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+        if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & USER_PL))
+          BX_CPU_THIS_PTR TLB.last_read = *tlbEntry;
+      }
       if (tlbEntry->lpf == lpf) {
         // See if the TLB entry privilege level allows us read access
         // from this CPL.
@@ -544,7 +584,7 @@ accessOK:
           Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
           ReadHostQWordFromLittleEndian(hostAddr, data);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 8, BX_READ);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 8, CPL, BX_READ, (Bit8u*) &data);
           return data;
         }
@@ -601,7 +641,7 @@ accessOK:
           ReadHostQWordFromLittleEndian(hostAddr,   data->xmm64u(0));
           ReadHostQWordFromLittleEndian(hostAddr+1, data->xmm64u(1));
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 16, BX_READ);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 16, CPL, BX_READ, (Bit8u*) data);
           return;
         }
@@ -652,7 +692,7 @@ accessOK:
           ReadHostQWordFromLittleEndian(hostAddr,   data->xmm64u(0));
           ReadHostQWordFromLittleEndian(hostAddr+1, data->xmm64u(1));
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 16, BX_READ);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 16, CPL, BX_READ, (Bit8u*) data);
           return;
         }
@@ -706,7 +746,7 @@ accessOK:
           data = *hostAddr;
           BX_CPU_THIS_PTR address_xlation.pages = (bx_ptr_equiv_t) hostAddr;
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 1, BX_RW);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 1, CPL, BX_READ, (Bit8u*) &data);
           return data;
         }
@@ -757,7 +797,7 @@ accessOK:
           ReadHostWordFromLittleEndian(hostAddr, data);
           BX_CPU_THIS_PTR address_xlation.pages = (bx_ptr_equiv_t) hostAddr;
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 2, BX_RW);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 2, CPL, BX_READ, (Bit8u*) &data);
           return data;
         }
@@ -818,7 +858,7 @@ accessOK:
           ReadHostDWordFromLittleEndian(hostAddr, data);
           BX_CPU_THIS_PTR address_xlation.pages = (bx_ptr_equiv_t) hostAddr;
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 4, BX_RW);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 4, CPL, BX_READ, (Bit8u*) &data);
           return data;
         }
@@ -879,7 +919,7 @@ accessOK:
           ReadHostQWordFromLittleEndian(hostAddr, data);
           BX_CPU_THIS_PTR address_xlation.pages = (bx_ptr_equiv_t) hostAddr;
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 8, BX_RW);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 8, CPL, BX_READ, (Bit8u*) &data);
           return data;
         }
@@ -1080,7 +1120,7 @@ accessOK:
           bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
           Bit32u pageOffset = PAGE_OFFSET(laddr);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 2, BX_WRITE);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
             tlbEntry->ppf | pageOffset, 2, curr_pl, BX_WRITE, (Bit8u*) &data);
           Bit16u *hostAddr = (Bit16u*) (hostPageAddr | pageOffset);
           pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -1139,7 +1179,7 @@ accessOK:
           bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
           Bit32u pageOffset = PAGE_OFFSET(laddr);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 4, BX_WRITE);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
             tlbEntry->ppf | pageOffset, 4, curr_pl, BX_WRITE, (Bit8u*) &data);
           Bit32u *hostAddr = (Bit32u*) (hostPageAddr | pageOffset);
           pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -1198,7 +1238,7 @@ accessOK:
           bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
           Bit32u pageOffset = PAGE_OFFSET(laddr);
           BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 8, BX_WRITE);
-          BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+          BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
               tlbEntry->ppf | pageOffset, 8, curr_pl, BX_WRITE, (Bit8u*) &data);
           Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
           pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -38,7 +38,12 @@ BX_CPU_C::write_virtual_byte_64(unsigned s, Bit64u offset, Bit8u data)
   Bit64u laddr = BX_CPU_THIS_PTR get_laddr64(s, offset);
   unsigned tlbIndex = BX_TLB_INDEX_OF(laddr, 0);
   Bit64u lpf = LPFOf(laddr);
-  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_write;
+  if (tlbEntry->lpf != lpf) {
+    tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+    if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & (0x2 | USER_PL)))
+      BX_CPU_THIS_PTR TLB.last_write = *tlbEntry;
+  }
   if (tlbEntry->lpf == lpf) {
     // See if the TLB entry privilege level allows us write access
     // from this CPL.
@@ -46,7 +51,7 @@ BX_CPU_C::write_virtual_byte_64(unsigned s, Bit64u offset, Bit8u data)
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 1, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
             tlbEntry->ppf | pageOffset, 1, CPL, BX_WRITE, (Bit8u*) &data);
       Bit8u *hostAddr = (Bit8u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -77,7 +82,12 @@ BX_CPU_C::write_virtual_word_64(unsigned s, Bit64u offset, Bit16u data)
 #else
   Bit64u lpf = LPFOf(laddr);
 #endif    
-  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_write;
+  if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xffe) {
+    tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+    if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & (0x2 | USER_PL)))
+      BX_CPU_THIS_PTR TLB.last_write = *tlbEntry;
+  }
   if (tlbEntry->lpf == lpf) {
     // See if the TLB entry privilege level allows us write access
     // from this CPL.
@@ -85,7 +95,7 @@ BX_CPU_C::write_virtual_word_64(unsigned s, Bit64u offset, Bit16u data)
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 2, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 2, CPL, BX_WRITE, (Bit8u*) &data);
       Bit16u *hostAddr = (Bit16u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -130,7 +140,12 @@ BX_CPU_C::write_virtual_dword_64(unsigned s, Bit64u offset, Bit32u data)
 #else
   Bit64u lpf = LPFOf(laddr);
 #endif    
-  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_write;
+  if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xffc) {
+    tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+    if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & (0x2 | USER_PL)))
+      BX_CPU_THIS_PTR TLB.last_write = *tlbEntry;
+  }
   if (tlbEntry->lpf == lpf) {
     // See if the TLB entry privilege level allows us write access
     // from this CPL.
@@ -138,7 +153,7 @@ BX_CPU_C::write_virtual_dword_64(unsigned s, Bit64u offset, Bit32u data)
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 4, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 4, CPL, BX_WRITE, (Bit8u*) &data);
       Bit32u *hostAddr = (Bit32u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -183,7 +198,12 @@ BX_CPU_C::write_virtual_qword_64(unsigned s, Bit64u offset, Bit64u data)
 #else
   Bit64u lpf = LPFOf(laddr);
 #endif    
-  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_write;
+  if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xff8) {
+    tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+    if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & (0x2 | USER_PL)))
+      BX_CPU_THIS_PTR TLB.last_write = *tlbEntry;
+  }
   if (tlbEntry->lpf == lpf) {
     // See if the TLB entry privilege level allows us write access
     // from this CPL.
@@ -191,7 +211,7 @@ BX_CPU_C::write_virtual_qword_64(unsigned s, Bit64u offset, Bit64u data)
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 8, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 8, CPL, BX_WRITE, (Bit8u*) &data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -240,7 +260,7 @@ BX_CPU_C::write_virtual_dqword_64(unsigned s, Bit64u offset, const BxPackedXmmRe
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 16, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 16, CPL, BX_WRITE, (Bit8u*) data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -276,7 +296,7 @@ BX_CPU_C::write_virtual_dqword_aligned_64(unsigned s, Bit64u offset, const BxPac
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 16, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 16, CPL, BX_WRITE, (Bit8u*) data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -309,7 +329,12 @@ BX_CPU_C::read_virtual_byte_64(unsigned s, Bit64u offset)
   Bit64u laddr = BX_CPU_THIS_PTR get_laddr64(s, offset);
   unsigned tlbIndex = BX_TLB_INDEX_OF(laddr, 0);
   Bit64u lpf = LPFOf(laddr);
-  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_read;
+  if (tlbEntry->lpf != lpf) {
+    tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+    if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & USER_PL))
+      BX_CPU_THIS_PTR TLB.last_read = *tlbEntry;
+  }
   if (tlbEntry->lpf == lpf) {
     // See if the TLB entry privilege level allows us read access
     // from this CPL.
@@ -319,7 +344,7 @@ BX_CPU_C::read_virtual_byte_64(unsigned s, Bit64u offset)
       Bit8u *hostAddr = (Bit8u*) (hostPageAddr | pageOffset);
       data = *hostAddr;
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 1, BX_READ);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 1, CPL, BX_READ, (Bit8u*) &data);
       return data;
     }
@@ -348,7 +373,12 @@ BX_CPU_C::read_virtual_word_64(unsigned s, Bit64u offset)
 #else
   Bit64u lpf = LPFOf(laddr);
 #endif    
-  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_read;
+  if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xffe) {
+    tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+    if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & USER_PL))
+      BX_CPU_THIS_PTR TLB.last_read = *tlbEntry;
+  }
   if (tlbEntry->lpf == lpf) {
     // See if the TLB entry privilege level allows us read access
     // from this CPL.
@@ -358,7 +388,7 @@ BX_CPU_C::read_virtual_word_64(unsigned s, Bit64u offset)
       Bit16u *hostAddr = (Bit16u*) (hostPageAddr | pageOffset);
       ReadHostWordFromLittleEndian(hostAddr, data);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 2, BX_READ);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 2, CPL, BX_READ, (Bit8u*) &data);
       return data;
     }
@@ -401,7 +431,12 @@ BX_CPU_C::read_virtual_dword_64(unsigned s, Bit64u offset)
 #else
   Bit64u lpf = LPFOf(laddr);
 #endif    
-  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_read;
+  if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xffc) {
+    tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+    if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & USER_PL))
+      BX_CPU_THIS_PTR TLB.last_read = *tlbEntry;
+  }
   if (tlbEntry->lpf == lpf) {
     // See if the TLB entry privilege level allows us read access
     // from this CPL.
@@ -411,7 +446,7 @@ BX_CPU_C::read_virtual_dword_64(unsigned s, Bit64u offset)
       Bit32u *hostAddr = (Bit32u*) (hostPageAddr | pageOffset);
       ReadHostDWordFromLittleEndian(hostAddr, data);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 4, BX_READ);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 4, CPL, BX_READ, (Bit8u*) &data);
       return data;
     }
@@ -454,7 +489,12 @@ BX_CPU_C::read_virtual_qword_64(unsigned s, Bit64u offset)
 #else
   Bit64u lpf = LPFOf(laddr);
 #endif    
-  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+  bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR TLB.last_read;
+  if (tlbEntry->lpf != lpf || PAGE_OFFSET(laddr) > 0xff8) {
+    tlbEntry = &BX_CPU_THIS_PTR TLB.entry[tlbIndex];
+    if (tlbEntry->lpf == lpf && ! (tlbEntry->accessBits & USER_PL))
+      BX_CPU_THIS_PTR TLB.last_read = *tlbEntry;
+  }
   if (tlbEntry->lpf == lpf) {
     // See if the TLB entry privilege level allows us read access
     // from this CPL.
@@ -464,7 +504,7 @@ BX_CPU_C::read_virtual_qword_64(unsigned s, Bit64u offset)
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       ReadHostQWordFromLittleEndian(hostAddr, data);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 8, BX_READ);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 8, CPL, BX_READ, (Bit8u*) &data);
       return data;
     }
@@ -513,7 +553,7 @@ BX_CPU_C::read_virtual_dqword_64(unsigned s, Bit64u offset, BxPackedXmmRegister
       ReadHostQWordFromLittleEndian(hostAddr,   data->xmm64u(0));
       ReadHostQWordFromLittleEndian(hostAddr+1, data->xmm64u(1));
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 16, BX_READ);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 16, CPL, BX_READ, (Bit8u*) data);
       return;
     }
@@ -547,7 +587,7 @@ BX_CPU_C::read_virtual_dqword_aligned_64(unsigned s, Bit64u offset, BxPackedXmmR
       ReadHostQWordFromLittleEndian(hostAddr,   data->xmm64u(0));
       ReadHostQWordFromLittleEndian(hostAddr+1, data->xmm64u(1));
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 16, BX_READ);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 16, CPL, BX_READ, (Bit8u*) data);
       return;
     }
@@ -593,7 +633,7 @@ BX_CPU_C::read_RMW_virtual_byte_64(unsigned s, Bit64u offset)
       data = *hostAddr;
       BX_CPU_THIS_PTR address_xlation.pages = (bx_ptr_equiv_t) hostAddr;
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 1, BX_RW);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 1, CPL, BX_READ, (Bit8u*) &data);
       return data;
     }
@@ -634,7 +674,7 @@ BX_CPU_C::read_RMW_virtual_word_64(unsigned s, Bit64u offset)
       ReadHostWordFromLittleEndian(hostAddr, data);
       BX_CPU_THIS_PTR address_xlation.pages = (bx_ptr_equiv_t) hostAddr;
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 2, BX_RW);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 2, CPL, BX_READ, (Bit8u*) &data);
       return data;
     }
@@ -689,7 +729,7 @@ BX_CPU_C::read_RMW_virtual_dword_64(unsigned s, Bit64u offset)
       ReadHostDWordFromLittleEndian(hostAddr, data);
       BX_CPU_THIS_PTR address_xlation.pages = (bx_ptr_equiv_t) hostAddr;
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 4, BX_RW);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 4, CPL, BX_READ, (Bit8u*) &data);
       return data;
     }
@@ -744,7 +784,7 @@ BX_CPU_C::read_RMW_virtual_qword_64(unsigned s, Bit64u offset)
       ReadHostQWordFromLittleEndian(hostAddr, data);
       BX_CPU_THIS_PTR address_xlation.pages = (bx_ptr_equiv_t) hostAddr;
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 8, BX_RW);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 8, CPL, BX_READ, (Bit8u*) &data);
       return data;
     }
@@ -790,7 +830,7 @@ void BX_CPU_C::write_new_stack_word_64(Bit64u laddr, unsigned curr_pl, Bit16u da
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 2, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 2, curr_pl, BX_WRITE, (Bit8u*) &data);
       Bit16u *hostAddr = (Bit16u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -838,7 +878,7 @@ void BX_CPU_C::write_new_stack_dword_64(Bit64u laddr, unsigned curr_pl, Bit32u d
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 4, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 4, curr_pl, BX_WRITE, (Bit8u*) &data);
       Bit32u *hostAddr = (Bit32u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
@@ -886,7 +926,7 @@ void BX_CPU_C::write_new_stack_qword_64(Bit64u laddr, unsigned curr_pl, Bit64u d
       bx_hostpageaddr_t hostPageAddr = tlbEntry->hostPageAddr;
       Bit32u pageOffset = PAGE_OFFSET(laddr);
       BX_INSTR_LIN_ACCESS(BX_CPU_ID, laddr, tlbEntry->ppf | pageOffset, 8, BX_WRITE);
-      BX_DBG_LIN_MEMORY_ACCESS(BX_CPU_ID, laddr,
+      BX_DBG_TLB_MEMORY_ACCESS(BX_CPU_ID, laddr,
           tlbEntry->ppf | pageOffset, 8, curr_pl, BX_WRITE, (Bit8u*) &data);
       Bit64u *hostAddr = (Bit64u*) (hostPageAddr | pageOffset);
       pageWriteStampTable.decWriteStamp(tlbEntry->ppf);
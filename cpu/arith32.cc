@@ -48,7 +48,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADD_EdGdM(bxInstruction_c *i)
 {
   Bit32u op1_32, op2_32, sum_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op2_32 = BX_READ_32BIT_REG(i->nnn());
@@ -88,7 +88,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADC_EdGdM(bxInstruction_c *i)
 
   Bit32u op1_32, op2_32, sum_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op2_32 = BX_READ_32BIT_REG(i->nnn());
@@ -131,7 +131,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SBB_EdGdM(bxInstruction_c *i)
 
   Bit32u op1_32, op2_32, diff_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op2_32 = BX_READ_32BIT_REG(i->nnn());
@@ -175,7 +175,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SBB_EdIdM(bxInstruction_c *i)
 
   Bit32u op1_32, op2_32 = i->Id(), diff_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   diff_32 = op1_32 - (op2_32 + temp_CF);
@@ -201,7 +201,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SUB_EdGdM(bxInstruction_c *i)
 {
   Bit32u op1_32, op2_32, diff_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op2_32 = BX_READ_32BIT_REG(i->nnn());
@@ -239,7 +239,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMP_EdGdM(bxInstruction_c *i)
 {
   Bit32u op1_32, op2_32, diff_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_virtual_dword(i->seg(), eaddr);
   op2_32 = BX_READ_32BIT_REG(i->nnn());
@@ -323,7 +323,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::XADD_EdGdM(bxInstruction_c *i)
    * dst  <-- tmp               | op1 = sum
    */
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op2_32 = BX_READ_32BIT_REG(i->nnn());
@@ -364,7 +364,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADD_EdIdM(bxInstruction_c *i)
 {
   Bit32u op1_32, op2_32, sum_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op2_32 = i->Id();
@@ -393,7 +393,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADC_EdIdM(bxInstruction_c *i)
 
   Bit32u op1_32, op2_32 = i->Id(), sum_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   sum_32 = op1_32 + op2_32 + temp_CF;
@@ -419,7 +419,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SUB_EdIdM(bxInstruction_c *i)
 {
   Bit32u op1_32, op2_32 = i->Id(), diff_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   diff_32 = op1_32 - op2_32;
@@ -443,7 +443,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMP_EdIdM(bxInstruction_c *i)
 {
   Bit32u op1_32, op2_32, diff_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_virtual_dword(i->seg(), eaddr);
   op2_32 = i->Id();
@@ -467,7 +467,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::NEG_EdM(bxInstruction_c *i)
 {
   Bit32u op1_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op1_32 = - (Bit32s)(op1_32);
@@ -489,7 +489,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INC_EdM(bxInstruction_c *i)
 {
   Bit32u op1_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op1_32++;
@@ -502,7 +502,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::DEC_EdM(bxInstruction_c *i)
 {
   Bit32u op1_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op1_32--;
@@ -515,7 +515,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPXCHG_EdGdM(bxInstruction_c *i)
 {
   Bit32u op1_32, op2_32, diff_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   diff_32 = EAX - op1_32;
@@ -555,7 +555,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPXCHG8B(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   // check write permission for following write
   op1_64 = read_RMW_virtual_qword(i->seg(), eaddr);
@@ -574,3 +574,23 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPXCHG8B(bxInstruction_c *i)
     clear_ZF();
   }
 }
+
+#if BX_SUPPORT_FUSED_PAIRS
+// fused with the load of its source operand before it, see fuseTrace()
+BX_FUSED_ALU_HANDLER(ADD_GdEdR)
+BX_FUSED_ALU_HANDLER(SUB_GdEdR)
+BX_FUSED_ALU_HANDLER(CMP_GdEdR)
+
+// without the flags the instruction after it overwrites, see fuseTrace()
+BX_DEAD_FLAGS_HANDLER(ADD_GdEdR, BX_WRITE_32BIT_REGZ(i->nnn(), BX_READ_32BIT_REG(i->nnn()) + BX_READ_32BIT_REG(i->rm())))
+BX_DEAD_FLAGS_HANDLER(ADD_EdIdR, BX_WRITE_32BIT_REGZ(i->rm(), BX_READ_32BIT_REG(i->rm()) + i->Id()))
+BX_DEAD_FLAGS_HANDLER(ADD_EAXId, RAX = EAX + i->Id())
+BX_DEAD_FLAGS_HANDLER(SUB_GdEdR, BX_WRITE_32BIT_REGZ(i->nnn(), BX_READ_32BIT_REG(i->nnn()) - BX_READ_32BIT_REG(i->rm())))
+BX_DEAD_FLAGS_HANDLER(SUB_EdIdR, BX_WRITE_32BIT_REGZ(i->rm(), BX_READ_32BIT_REG(i->rm()) - i->Id()))
+BX_DEAD_FLAGS_HANDLER(SUB_EAXId, RAX = EAX - i->Id())
+BX_DEAD_FLAGS_HANDLER(CMP_GdEdR, {})
+BX_DEAD_FLAGS_HANDLER(CMP_EdIdR, {})
+BX_DEAD_FLAGS_HANDLER(CMP_EAXId, {})
+BX_DEAD_FLAGS_HANDLER(INC_ERX, ++BX_READ_32BIT_REG(i->opcodeReg()); BX_CLEAR_64BIT_HIGH(i->opcodeReg()))
+BX_DEAD_FLAGS_HANDLER(DEC_ERX, --BX_READ_32BIT_REG(i->opcodeReg()); BX_CLEAR_64BIT_HIGH(i->opcodeReg()))
+#endif
@@ -30,7 +30,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADD_EqGqM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64, sum_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -73,7 +73,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADC_EqGqM(bxInstruction_c *i)
 
   Bit64u op1_64, op2_64, sum_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -122,7 +122,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SBB_EqGqM(bxInstruction_c *i)
 
   Bit64u op1_64, op2_64, diff_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -171,7 +171,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SBB_EqIdM(bxInstruction_c *i)
 
   Bit64u op1_64, op2_64, diff_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -200,7 +200,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SUB_EqGqM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64, diff_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -243,7 +243,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMP_EqGqM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64, diff_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_64 = read_virtual_qword_64(i->seg(), eaddr);
   op2_64 = BX_READ_64BIT_REG(i->nnn());
@@ -300,7 +300,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::XADD_EqGqM(bxInstruction_c *i)
    * dst  <-- tmp               | op1 = sum
    */
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -342,7 +342,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADD_EqIdM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64, sum_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -371,7 +371,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADC_EqIdM(bxInstruction_c *i)
 
   Bit64u op1_64, op2_64, sum_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -400,7 +400,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SUB_EqIdM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64, diff_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -427,7 +427,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMP_EqIdM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64, diff_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_64 = read_virtual_qword_64(i->seg(), eaddr);
   op2_64 = (Bit32s) i->Id();
@@ -451,7 +451,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::NEG_EqM(bxInstruction_c *i)
 {
   Bit64u op1_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -474,7 +474,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INC_EqM(bxInstruction_c *i)
 {
   Bit64u op1_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -494,7 +494,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::DEC_EqM(bxInstruction_c *i)
 {
   Bit64u op1_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -514,7 +514,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPXCHG_EqGqM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64, diff_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
@@ -555,7 +555,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPXCHG16B(bxInstruction_c *i)
 {
   Bit64u op1_64_lo, op1_64_hi, diff;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   bx_address laddr = get_laddr64(i->seg(), eaddr);
 
@@ -586,4 +586,24 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPXCHG16B(bxInstruction_c *i)
   }
 }
 
+#if BX_SUPPORT_FUSED_PAIRS
+// fused with the load of its source operand before it, see fuseTrace()
+BX_FUSED_ALU_HANDLER(ADD_GqEqR)
+BX_FUSED_ALU_HANDLER(SUB_GqEqR)
+BX_FUSED_ALU_HANDLER(CMP_GqEqR)
+
+// without the flags the instruction after it overwrites, see fuseTrace()
+BX_DEAD_FLAGS_HANDLER(ADD_GqEqR, BX_WRITE_64BIT_REG(i->nnn(), BX_READ_64BIT_REG(i->nnn()) + BX_READ_64BIT_REG(i->rm())))
+BX_DEAD_FLAGS_HANDLER(ADD_EqIdR, BX_WRITE_64BIT_REG(i->rm(), BX_READ_64BIT_REG(i->rm()) + (Bit32s) i->Id()))
+BX_DEAD_FLAGS_HANDLER(ADD_RAXId, RAX += (Bit32s) i->Id())
+BX_DEAD_FLAGS_HANDLER(SUB_GqEqR, BX_WRITE_64BIT_REG(i->nnn(), BX_READ_64BIT_REG(i->nnn()) - BX_READ_64BIT_REG(i->rm())))
+BX_DEAD_FLAGS_HANDLER(SUB_EqIdR, BX_WRITE_64BIT_REG(i->rm(), BX_READ_64BIT_REG(i->rm()) - (Bit32s) i->Id()))
+BX_DEAD_FLAGS_HANDLER(SUB_RAXId, RAX -= (Bit32s) i->Id())
+BX_DEAD_FLAGS_HANDLER(CMP_GqEqR, {})
+BX_DEAD_FLAGS_HANDLER(CMP_EqIdR, {})
+BX_DEAD_FLAGS_HANDLER(CMP_RAXId, {})
+BX_DEAD_FLAGS_HANDLER(INC_EqR, ++BX_READ_64BIT_REG(i->rm()))
+BX_DEAD_FLAGS_HANDLER(DEC_EqR, --BX_READ_64BIT_REG(i->rm()))
+#endif
+
 #endif /* if BX_SUPPORT_X86_64 */
@@ -78,10 +78,13 @@ void BX_CPU_C::cpu_loop(Bit32u max_instr_count)
   BX_CPU_THIS_PTR break_point = 0;
   BX_CPU_THIS_PTR magic_break = 0;
   BX_CPU_THIS_PTR stop_reason = STOP_NO_REASON;
+  // breakpoints may have changed, look them up again on next prefetch
+  invalidate_prefetch_q();
 #endif
 
   if (setjmp(BX_CPU_THIS_PTR jmp_buf_env)) {
     // only from exception function we can get here ...
+    BX_CPU_THIS_PTR idle.loops = 0;
     BX_INSTR_NEW_INSTRUCTION(BX_CPU_ID);
     BX_TICK1_IF_SINGLE_PROCESSOR();
 #if BX_DEBUGGER || BX_GDBSTUB
@@ -141,12 +144,17 @@ no_async_event:
       // iCache miss. No validated instruction with matching fetch parameters
       // is in the iCache.
       InstrICache_Increment(iCacheMisses);
+      BX_CPU_THIS_PTR stats.icache_misses++;
       serveICacheMiss(entry, (Bit32u) eipBiased, pAddr);
       i = entry->i;
     }
+    else {
+      BX_CPU_THIS_PTR stats.icache_hits++;
+    }
 
 #if BX_SUPPORT_TRACE_CACHE
     bxInstruction_c *last = i + (entry->tlen);
+    bx_address traceRip = RIP;
 
     for(;;) {
 #endif
@@ -186,6 +194,9 @@ no_async_event:
       if (BX_CPU_THIS_PTR async_event) {
         // clear stop trace magic indication that probably was set by repeat or branch32/64
         BX_CPU_THIS_PTR async_event &= ~BX_ASYNC_EVENT_STOP_TRACE;
+        // the trace jumped back to its start
+        if (RIP == traceRip && BX_CPU_THIS_PTR idle_skip && ! BX_CPU_THIS_PTR async_event)
+          checkIdleLoop(entry->i, i);
         break;
       }
 
@@ -418,6 +429,9 @@ void BX_CPP_AttrRegparmN(2) BX_CPU_C::repeat_ZF(bxInstruction_c *i, BxExecutePtr
 
 unsigned BX_CPU_C::handleAsyncEvent(void)
 {
+  BX_CPU_THIS_PTR stats.async_events++;
+  BX_CPU_THIS_PTR idle.loops = 0;
+
   //
   // This area is where we process special conditions and events.
   //
@@ -673,6 +687,159 @@ unsigned BX_CPU_C::handleAsyncEvent(void)
   return 0; // Continue executing cpu_loop.
 }
 
+// A guest waiting for an interrupt without HLT spins in a loop reading
+// memory or an I/O port until it changes. As for HLT, nothing happens until
+// the next timer event then, pass the time up to it at once.
+void BX_CPU_C::skipIdleTime(void)
+{
+  Bit32u ticks = bx_pc_system.getNumCpuTicksLeftNextEvent();
+
+  BX_CPU_THIS_PTR stats.idle_skips++;
+  BX_CPU_THIS_PTR stats.idle_ticks += ticks;
+
+  BX_TICKN(ticks);
+
+#if BX_USE_IDLE_HACK
+  bx_gui->sim_is_idle();
+#endif
+}
+
+#if BX_SUPPORT_TRACE_CACHE
+
+// Number of iterations in a row before a loop is checked for progress
+#define BX_IDLE_LOOP_COUNT 64
+
+// Instructions that change nothing but the registers and the flags. The
+// second instruction of a fused pair is a branch or a register operation,
+// see fuseTrace().
+static bx_bool idleInstruction(unsigned ia_opcode)
+{
+  switch(ia_opcode) {
+    case BX_IA_NOP: case BX_IA_PAUSE:
+    case BX_IA_MOV_GbEbM: case BX_IA_MOV_GbEbR:
+    case BX_IA_MOV_GwEwM: case BX_IA_MOV_GwEwR:
+    case BX_IA_MOV32_GdEdM: case BX_IA_MOV_GdEdR:
+    case BX_IA_MOV_ALOd: case BX_IA_MOV_AXOd: case BX_IA_MOV_EAXOd:
+    case BX_IA_MOVZX_GwEbM: case BX_IA_MOVZX_GwEbR:
+    case BX_IA_MOVZX_GdEbM: case BX_IA_MOVZX_GdEbR:
+    case BX_IA_MOVZX_GdEwM: case BX_IA_MOVZX_GdEwR:
+    case BX_IA_CMP_GbEbM: case BX_IA_CMP_GbEbR: case BX_IA_CMP_EbGbM:
+    case BX_IA_CMP_EbIbM: case BX_IA_CMP_EbIbR: case BX_IA_CMP_ALIb:
+    case BX_IA_CMP_GwEwM: case BX_IA_CMP_GwEwR: case BX_IA_CMP_EwGwM:
+    case BX_IA_CMP_EwIwM: case BX_IA_CMP_EwIwR: case BX_IA_CMP_AXIw:
+    case BX_IA_CMP_GdEdM: case BX_IA_CMP_GdEdR: case BX_IA_CMP_EdGdM:
+    case BX_IA_CMP_EdIdM: case BX_IA_CMP_EdIdR: case BX_IA_CMP_EAXId:
+    case BX_IA_TEST_EbGbM: case BX_IA_TEST_EbGbR: case BX_IA_TEST_EbIbM:
+    case BX_IA_TEST_EbIbR: case BX_IA_TEST_ALIb:
+    case BX_IA_TEST_EwGwM: case BX_IA_TEST_EwGwR: case BX_IA_TEST_EwIwM:
+    case BX_IA_TEST_EwIwR: case BX_IA_TEST_AXIw:
+    case BX_IA_TEST_EdGdM: case BX_IA_TEST_EdGdR: case BX_IA_TEST_EdIdM:
+    case BX_IA_TEST_EdIdR: case BX_IA_TEST_EAXId:
+    case BX_IA_AND_GdEdR: case BX_IA_AND_EdIdR: case BX_IA_AND_EAXId:
+    case BX_IA_IN_ALIb: case BX_IA_IN_AXIb: case BX_IA_IN_EAXIb:
+    case BX_IA_IN_ALDX: case BX_IA_IN_AXDX: case BX_IA_IN_EAXDX:
+    case BX_IA_JMP_Jw: case BX_IA_JMP_Jd:
+    case BX_IA_JO_Jw: case BX_IA_JNO_Jw: case BX_IA_JB_Jw: case BX_IA_JNB_Jw:
+    case BX_IA_JZ_Jw: case BX_IA_JNZ_Jw: case BX_IA_JBE_Jw: case BX_IA_JNBE_Jw:
+    case BX_IA_JS_Jw: case BX_IA_JNS_Jw: case BX_IA_JP_Jw: case BX_IA_JNP_Jw:
+    case BX_IA_JL_Jw: case BX_IA_JNL_Jw: case BX_IA_JLE_Jw: case BX_IA_JNLE_Jw:
+    case BX_IA_JO_Jd: case BX_IA_JNO_Jd: case BX_IA_JB_Jd: case BX_IA_JNB_Jd:
+    case BX_IA_JZ_Jd: case BX_IA_JNZ_Jd: case BX_IA_JBE_Jd: case BX_IA_JNBE_Jd:
+    case BX_IA_JS_Jd: case BX_IA_JNS_Jd: case BX_IA_JP_Jd: case BX_IA_JNP_Jd:
+    case BX_IA_JL_Jd: case BX_IA_JNL_Jd: case BX_IA_JLE_Jd: case BX_IA_JNLE_Jd:
+#if BX_SUPPORT_X86_64
+    case BX_IA_MOV64_GdEdM: case BX_IA_MOV_GqEqM: case BX_IA_MOV_GqEqR:
+    case BX_IA_MOV_ALOq: case BX_IA_MOV_AXOq: case BX_IA_MOV_EAXOq:
+    case BX_IA_MOV_RAXOq:
+    case BX_IA_MOVZX_GqEbM: case BX_IA_MOVZX_GqEbR:
+    case BX_IA_MOVZX_GqEwM: case BX_IA_MOVZX_GqEwR:
+    case BX_IA_CMP_GqEqM: case BX_IA_CMP_GqEqR: case BX_IA_CMP_EqGqM:
+    case BX_IA_CMP_EqIdM: case BX_IA_CMP_EqIdR: case BX_IA_CMP_RAXId:
+    case BX_IA_TEST_EqGqM: case BX_IA_TEST_EqGqR: case BX_IA_TEST_EqIdM:
+    case BX_IA_TEST_EqIdR: case BX_IA_TEST_RAXId:
+    case BX_IA_AND_GqEqR: case BX_IA_AND_EqIdR: case BX_IA_AND_RAXId:
+    case BX_IA_JMP_Jq:
+    case BX_IA_JO_Jq: case BX_IA_JNO_Jq: case BX_IA_JB_Jq: case BX_IA_JNB_Jq:
+    case BX_IA_JZ_Jq: case BX_IA_JNZ_Jq: case BX_IA_JBE_Jq: case BX_IA_JNBE_Jq:
+    case BX_IA_JS_Jq: case BX_IA_JNS_Jq: case BX_IA_JP_Jq: case BX_IA_JNP_Jq:
+    case BX_IA_JL_Jq: case BX_IA_JNL_Jq: case BX_IA_JLE_Jq: case BX_IA_JNLE_Jq:
+#endif
+      return 1;
+  }
+  return 0;
+}
+
+// The instructions of a trace up to last just jumped back to its start, see
+// cpu_loop(). After they did so BX_IDLE_LOOP_COUNT times in a row, take a
+// snapshot of the registers and compare it after the next iteration. A loop
+// writing nothing but the registers with none of them changed made no
+// progress: it repeats the same way until an interrupt or a timer event
+// changes what it reads.
+//
+// Interrupts and exceptions reset the count, a timer event during the
+// iteration cancels the check.
+void BX_CPU_C::checkIdleLoop(bxInstruction_c *i, bxInstruction_c *last)
+{
+  if (BX_CPU_THIS_PTR idle.rip != RIP) {
+    BX_CPU_THIS_PTR idle.rip = RIP;
+    BX_CPU_THIS_PTR idle.loops = 0;
+    return;
+  }
+
+  Bit32u loops = ++BX_CPU_THIS_PTR idle.loops;
+  if (loops < BX_IDLE_LOOP_COUNT) return;
+
+  if (loops == BX_IDLE_LOOP_COUNT) {
+    for (; i <= last; i++) {
+      if (! idleInstruction(i->getIaOpcode())) {
+        BX_CPU_THIS_PTR idle.loops = 0;
+        return;
+      }
+    }
+
+    memcpy(BX_CPU_THIS_PTR idle.gen_reg, BX_CPU_THIS_PTR gen_reg, sizeof(BX_CPU_THIS_PTR idle.gen_reg));
+    BX_CPU_THIS_PTR idle.eflags = read_eflags();
+    BX_CPU_THIS_PTR idle.deadline = bx_pc_system.time_ticks() +
+                                    bx_pc_system.getNumCpuTicksLeftNextEvent();
+    return;
+  }
+
+  BX_CPU_THIS_PTR idle.loops = 0;
+
+  if (bx_pc_system.time_ticks() >= BX_CPU_THIS_PTR idle.deadline) return;
+
+  if (memcmp(BX_CPU_THIS_PTR idle.gen_reg, BX_CPU_THIS_PTR gen_reg, sizeof(BX_CPU_THIS_PTR idle.gen_reg)) ||
+      BX_CPU_THIS_PTR idle.eflags != read_eflags()) return;
+
+  skipIdleTime();
+
+  // check the next iteration again
+  BX_CPU_THIS_PTR idle.loops = BX_IDLE_LOOP_COUNT - 1;
+}
+
+#endif
+
+// Number of PAUSEs in a row making a spin loop, and the most ticks
+// between two of them
+#define BX_PAUSE_SPIN_COUNT 64
+#define BX_PAUSE_SPIN_GAP   256
+
+// PAUSE marks a spin wait loop. Also those running through several traces
+// or changing registers, a delay loop for example, only pass the time.
+void BX_CPU_C::checkPauseSpin(void)
+{
+  Bit64u now = bx_pc_system.time_ticks();
+
+  if (now - BX_CPU_THIS_PTR idle.last_pause > BX_PAUSE_SPIN_GAP)
+    BX_CPU_THIS_PTR idle.pauses = 0;
+  BX_CPU_THIS_PTR idle.last_pause = now;
+
+  if (++BX_CPU_THIS_PTR idle.pauses == BX_PAUSE_SPIN_COUNT) {
+    BX_CPU_THIS_PTR idle.pauses = 0;
+    skipIdleTime();
+  }
+}
+
 
 // boundaries of consideration:
 //
@@ -757,6 +924,10 @@ void BX_CPU_C::prefetch(void)
   }
 
   BX_CPU_THIS_PTR currPageWriteStampPtr = pageWriteStampTable.getPageWriteStampPtr(BX_CPU_THIS_PTR pAddrPage);
+
+#if BX_DEBUGGER
+  BX_CPU_THIS_PTR bpoint_page = dbg_check_bpoint_page(laddr);
+#endif
 }
 
 void BX_CPU_C::deliver_SIPI(unsigned vector)
@@ -799,19 +970,52 @@ void BX_CPU_C::set_INTR(bx_bool value)
   BX_CPU_THIS_PTR async_event = 1;
 }
 
+#if BX_DEBUGGER
+// Record the location of the next instruction for the debugger
+void BX_CPU_C::dbg_set_guard_location(void)
+{
+  BX_CPU_THIS_PTR guard_found.cs  = BX_CPU_THIS_PTR sregs[BX_SEG_REG_CS].selector.value;
+  BX_CPU_THIS_PTR guard_found.eip = RIP;
+  BX_CPU_THIS_PTR guard_found.laddr = BX_CPU_THIS_PTR get_laddr(BX_SEG_REG_CS, RIP);
+  BX_CPU_THIS_PTR guard_found.code_32_64 = BX_CPU_THIS_PTR fetchModeMask;
+}
+
+// Find out if the code page starting at laddr may hold an instruction
+// breakpoint. Virtual breakpoints are indexed by their eip page and the
+// code page may span two of them if CS base is not page aligned.
+bx_bool BX_CPU_C::dbg_check_bpoint_page(bx_address laddr)
+{
+  if (! (bx_guard.guard_for & BX_DBG_GUARD_IADDR_ALL))
+    return 0;
+
+  if (bx_dbg_bpoint_page(BX_DBG_GUARD_IADDR_PHY, BX_CPU_THIS_PTR pAddrPage >> 12) ||
+      bx_dbg_bpoint_page(BX_DBG_GUARD_IADDR_LIN, laddr >> 12))
+    return 1;
+
+  bx_address eip_start = RIP - PAGE_OFFSET(laddr);
+  bx_address eip_end = eip_start + 0xfff;
+#if BX_SUPPORT_X86_64
+  if (! long64_mode())
+#endif
+  {
+    eip_start &= 0xffffffff;
+    eip_end &= 0xffffffff;
+  }
+
+  return bx_dbg_bpoint_page(BX_DBG_GUARD_IADDR_VIR, eip_start >> 12) ||
+         bx_dbg_bpoint_page(BX_DBG_GUARD_IADDR_VIR, eip_end >> 12);
+}
+#endif
+
 #if BX_DEBUGGER || BX_GDBSTUB
-bx_bool BX_CPU_C::dbg_instruction_epilog(void)
+bx_bool BX_CPU_C::dbg_check_guards(void)
 {
 #if BX_DEBUGGER
   Bit64u tt = bx_pc_system.time_ticks();
   bx_address debug_eip = RIP;
   Bit16u cs = BX_CPU_THIS_PTR sregs[BX_SEG_REG_CS].selector.value;
 
-  BX_CPU_THIS_PTR guard_found.icount++;
-  BX_CPU_THIS_PTR guard_found.cs  = cs;
-  BX_CPU_THIS_PTR guard_found.eip = debug_eip;
-  BX_CPU_THIS_PTR guard_found.laddr = BX_CPU_THIS_PTR get_laddr(BX_SEG_REG_CS, debug_eip);
-  BX_CPU_THIS_PTR guard_found.code_32_64 = BX_CPU_THIS_PTR fetchModeMask;
+  dbg_set_guard_location();
 
   //
   // Take care of break point conditions generated during instruction execution
@@ -849,7 +1053,6 @@ bx_bool BX_CPU_C::dbg_instruction_epilog(void)
   }
 
   // support for 'show' command in debugger
-  extern unsigned dbg_show_mask;
   if(dbg_show_mask) {
     int rv = bx_dbg_show_symbolic();
     if (rv) return(rv);
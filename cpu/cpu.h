@@ -413,8 +413,6 @@ class BX_MEM_C;
 // Since this is different from when SMF=1, encapsulate it in a macro.
 #  define BX_CPU_CALL_METHOD(func, args) \
             (this->*((BxExecutePtr_tR) (func))) args
-#  define BX_CPU_CALL_METHODR(func, args) \
-            (this->*((BxResolvePtr_tR) (func))) args
 #else
 // static member functions.  With SMF, there is only one CPU by definition.
 #  define BX_CPU_THIS_PTR  BX_CPU(0)->
@@ -423,8 +421,16 @@ class BX_MEM_C;
 #  define BX_CPU_C_PREFIX
 #  define BX_CPU_CALL_METHOD(func, args) \
             ((BxExecutePtr_tR) (func)) args
-#  define BX_CPU_CALL_METHODR(func, args) \
-            ((BxResolvePtr_tR) (func)) args
+#endif
+
+// Effective address of the memory operand of an instruction, see
+// BxResolve32() and BxResolve64()
+#if BX_SUPPORT_X86_64
+#  define BX_CPU_RESOLVE_ADDR(i) \
+            ((i)->as64L() ? BxResolve64(i) : BxResolve32(i))
+#else
+#  define BX_CPU_RESOLVE_ADDR(i) \
+            (BxResolve32(i))
 #endif
 
 #if BX_SUPPORT_SMP
@@ -671,6 +677,12 @@ typedef struct {
   #define LPF_MASK (0xfffff000)
 #endif
 
+#if BX_SUPPORT_X86_64
+  #define BX_INVALID_TLB_ENTRY BX_CONST64(0xffffffffffffffff)
+#else
+  #define BX_INVALID_TLB_ENTRY 0xffffffff
+#endif
+
 #define LPFOf(laddr)               ((laddr) & LPF_MASK)
 #define AlignedAccessLPFOf(laddr, alignment_mask) \
                                    ((laddr) & (LPF_MASK | (alignment_mask)))
@@ -983,6 +995,7 @@ public: // for now...
 #if BX_CPU_LEVEL >= 5
   bx_bool  ignore_bad_msrs;
 #endif
+  bx_bool  idle_skip;
 
   // for exceptions
   jmp_buf jmp_buf_env;
@@ -1008,6 +1021,7 @@ public: // for now...
   bx_bool mode_break;
   unsigned show_flag;
   bx_guard_found_t guard_found;
+  bx_bool bpoint_page; // current code page holds instruction breakpoints
 #endif
   Bit8u trace;
 
@@ -1017,6 +1031,11 @@ public: // for now...
 #if BX_CPU_LEVEL >= 5
     bx_bool split_large;
 #endif
+    // copies of the TLB entries of the last data pages read and written,
+    // checked first by the read_virtual/write_virtual accesses; they only
+    // hold pages the current CPL may access, see invalidate_data_pages()
+    bx_TLB_entry last_read;
+    bx_TLB_entry last_write;
   } TLB;
 
 #if BX_CPU_LEVEL >= 6
@@ -1033,6 +1052,28 @@ public: // for now...
   Bit32u fetchModeMask;
   const Bit32u *currPageWriteStampPtr;
 
+  // Emulator statistics, exported read-only as stats.cpuN
+  struct {
+    Bit64u icache_hits;
+    Bit64u icache_misses;
+    Bit64u tlb_misses;
+    Bit64u page_walks;
+    Bit64u async_events;
+    Bit64u idle_skips;
+    Bit64u idle_ticks;
+  } stats;
+
+  // Idle loop and PAUSE spin detection, see checkIdleLoop()
+  struct {
+    bx_address rip;           // start of the trace jumping back to itself
+    Bit32u loops;             // its iterations in a row
+    Bit64u deadline;          // time of the next timer event at the snapshot
+    bx_gen_reg_t gen_reg[BX_GENERAL_REGISTERS];
+    Bit32u eflags;
+    Bit64u last_pause;        // time of the last PAUSE
+    Bit32u pauses;            // PAUSEs in a row, see checkPauseSpin()
+  } idle;
+
   struct {
     bx_address rm_addr;       // The address offset after resolution
     bx_phy_address paddress1; // physical address after translation of 1st len1 bytes of data
@@ -1103,6 +1144,7 @@ public: // for now...
 #if BX_WITH_WX
   void register_wx_state(void);
 #endif
+  void register_stats(void);
   static Bit64s param_save_handler(void *devptr, bx_param_c *param);
   static void param_restore_handler(void *devptr, bx_param_c *param, Bit64s val);
 #if !BX_USE_CPU_SMF
@@ -2798,12 +2840,9 @@ public: // for now...
   BX_SMF void UndefinedOpcode(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
   BX_SMF void BxError(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
 
-  BX_SMF bx_address BxResolve16BaseIndex(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
-  BX_SMF bx_address BxResolve32Base(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
-  BX_SMF bx_address BxResolve32BaseIndex(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF BX_CPP_INLINE bx_address BxResolve32(bxInstruction_c *i);
 #if BX_SUPPORT_X86_64
-  BX_SMF bx_address BxResolve64Base(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
-  BX_SMF bx_address BxResolve64BaseIndex(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF BX_CPP_INLINE bx_address BxResolve64(bxInstruction_c *i);
 #endif
 // <TAG-CLASS-CPU-END>
 
@@ -2821,7 +2860,12 @@ public: // for now...
   BX_SMF unsigned   dbg_query_pending(void);
 #endif
 #if BX_DEBUGGER || BX_GDBSTUB
-  BX_SMF bx_bool  dbg_instruction_epilog(void);
+  BX_SMF BX_CPP_INLINE bx_bool dbg_instruction_epilog(void);
+  BX_SMF bx_bool  dbg_check_guards(void);
+#endif
+#if BX_DEBUGGER
+  BX_SMF void     dbg_set_guard_location(void);
+  BX_SMF bx_bool  dbg_check_bpoint_page(bx_address laddr);
 #endif
 #if BX_DEBUGGER || BX_DISASM || BX_INSTRUMENTATION || BX_GDBSTUB
   BX_SMF bx_bool  dbg_xlate_linear2phy(bx_address linear, bx_phy_address *phy, bx_bool verbose = 0);
@@ -2834,6 +2878,11 @@ public: // for now...
   // now for some ancillary functions...
   BX_SMF void cpu_loop(Bit32u max_instr_count);
   BX_SMF unsigned handleAsyncEvent(void);
+#if BX_SUPPORT_TRACE_CACHE
+  BX_SMF void checkIdleLoop(bxInstruction_c *i, bxInstruction_c *last);
+#endif
+  BX_SMF void checkPauseSpin(void);
+  BX_SMF void skipIdleTime(void);
 
   BX_SMF int fetchDecode32(const Bit8u *fetchPtr, bxInstruction_c *i, unsigned remainingInPage) BX_CPP_AttrRegparmN(3);
 #if BX_SUPPORT_X86_64
@@ -2843,11 +2892,144 @@ public: // for now...
   BX_SMF void serveICacheMiss(bxICacheEntry_c *entry, Bit32u eipBiased, bx_phy_address pAddr);
 #if BX_SUPPORT_TRACE_CACHE
   BX_SMF bx_bool mergeTraces(bxICacheEntry_c *entry, bxInstruction_c *i, bx_phy_address pAddr);
+#if BX_SUPPORT_FUSED_PAIRS
+  BX_SMF void fuseTrace(bxICacheEntry_c *entry);
+  BX_SMF BX_CPP_INLINE bx_bool fusedPairFirst(bxInstruction_c *i);
+  BX_SMF BX_CPP_INLINE void fusedPairSecond(bxInstruction_c *i);
+  // fused pairs, by the second instruction
+  BX_SMF void JO_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNO_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JB_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNB_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JZ_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNZ_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JBE_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNBE_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JS_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNS_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JP_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNP_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JL_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNL_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JLE_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNLE_Jw_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JO_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNO_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JB_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNB_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JZ_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNZ_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JBE_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNBE_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JS_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNS_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JP_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNP_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JL_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNL_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JLE_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNLE_Jd_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#if BX_SUPPORT_X86_64
+  BX_SMF void JO_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNO_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JB_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNB_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JZ_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNZ_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JBE_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNBE_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JS_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNS_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JP_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNP_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JL_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNL_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JLE_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNLE_Jq_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#endif
+  BX_SMF void PUSH_RX_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void POP_RX_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void PUSH_ERX_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void POP_ERX_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#if BX_SUPPORT_X86_64
+  BX_SMF void PUSH_RRX_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void POP_RRX_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#endif
+  BX_SMF void ADD_GdEdR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void SUB_GdEdR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void CMP_GdEdR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void AND_GdEdR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void OR_GdEdR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void XOR_GdEdR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void TEST_EdGdR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#if BX_SUPPORT_X86_64
+  BX_SMF void ADD_GqEqR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void SUB_GqEqR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void CMP_GqEqR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void AND_GqEqR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void OR_GqEqR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void XOR_GqEqR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void TEST_EqGqR_Fused(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#endif
+  // pairs with the flags of the first instruction dead, by the first one
+  BX_SMF void ADD_GdEdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void ADD_EdIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void ADD_EAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void SUB_GdEdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void SUB_EdIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void SUB_EAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void AND_GdEdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void AND_EdIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void AND_EAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void OR_GdEdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void OR_EdIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void OR_EAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void XOR_GdEdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void XOR_EdIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void XOR_EAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void CMP_GdEdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void CMP_EdIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void CMP_EAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void TEST_EdGdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void TEST_EdIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void TEST_EAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void INC_ERX_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void DEC_ERX_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#if BX_SUPPORT_X86_64
+  BX_SMF void ADD_GqEqR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void ADD_EqIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void ADD_RAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void SUB_GqEqR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void SUB_EqIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void SUB_RAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void AND_GqEqR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void AND_EqIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void AND_RAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void OR_GqEqR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void OR_EqIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void OR_RAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void XOR_GqEqR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void XOR_EqIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void XOR_RAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void CMP_GqEqR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void CMP_EqIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void CMP_RAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void TEST_EqGqR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void TEST_EqIdR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void TEST_RAXId_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void INC_EqR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void DEC_EqR_DeadFlags(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#endif
+#endif
 #else
   BX_SMF bx_bool fetchInstruction(bxInstruction_c *iStorage, Bit32u eipBiased);
 #endif
   BX_SMF void prefetch(void);
   BX_SMF void updateFetchModeMask(void);
+  BX_SMF BX_CPP_INLINE void invalidate_data_pages(void) {
+    BX_CPU_THIS_PTR TLB.last_read.lpf = BX_INVALID_TLB_ENTRY;
+    BX_CPU_THIS_PTR TLB.last_write.lpf = BX_INVALID_TLB_ENTRY;
+  }
   BX_SMF BX_CPP_INLINE void invalidate_prefetch_q(void)
   {
     BX_CPU_THIS_PTR eipPageWindowSize = 0;
@@ -3097,11 +3279,22 @@ public: // for now...
        Bit16u val, Bit32u  wordCount);
   BX_SMF Bit32u FastRepSTOSD(bxInstruction_c *i, unsigned dstSeg, bx_address dstOff,
        Bit32u val, Bit32u dwordCount);
+#if BX_SUPPORT_X86_64
+  BX_SMF Bit32u FastRepMOVSQ(bxInstruction_c *i, unsigned srcSeg, bx_address srcOff,
+       unsigned dstSeg, bx_address dstOff, Bit32u qwordCount);
+  BX_SMF Bit32u FastRepSTOSQ(bxInstruction_c *i, unsigned dstSeg, bx_address dstOff,
+       Bit64u val, Bit32u qwordCount);
+#endif
 
-  BX_SMF Bit32u FastRepINSW(bxInstruction_c *i, bx_address dstOff,
-       Bit16u port, Bit32u wordCount);
-  BX_SMF Bit32u FastRepOUTSW(bxInstruction_c *i, unsigned srcSeg, bx_address srcOff,
-       Bit16u port, Bit32u wordCount);
+  BX_SMF Bit32u FastRepSCASB(bxInstruction_c *i, bx_address dstOff,
+       Bit8u val, Bit32u byteCount);
+  BX_SMF Bit32u FastRepCMPSB(bxInstruction_c *i, unsigned srcSeg, bx_address srcOff,
+       bx_address dstOff, Bit32u byteCount);
+
+  BX_SMF Bit32u FastRepINS(bxInstruction_c *i, bx_address dstOff,
+       Bit16u port, unsigned len, Bit32u count);
+  BX_SMF Bit32u FastRepOUTS(bxInstruction_c *i, unsigned srcSeg, bx_address srcOff,
+       Bit16u port, unsigned len, Bit32u count);
 #endif
 
   BX_SMF void repeat(bxInstruction_c *i, BxExecutePtr_tR execute) BX_CPP_AttrRegparmN(2);
@@ -3533,6 +3726,25 @@ BX_CPP_INLINE void BX_CPU_C::prepareXSAVE(void)
   BX_CPU_THIS_PTR speculative_rsp = 0; \
 }
 
+// The decoder leaves the base and index registers an addressing form does
+// not use as BX_NIL_REGISTER, which reads as zero, and the scale zero when
+// there is no s-i-b byte, so all the forms of an address size are computed
+// by the same expression, inline in the instruction handlers.
+BX_CPP_INLINE bx_address BX_CPU_C::BxResolve32(bxInstruction_c *i)
+{
+  if (i->as32L())
+    return (Bit32u) (BX_READ_32BIT_REG(i->sibBase()) + (BX_READ_32BIT_REG(i->sibIndex()) << i->sibScale()) + i->displ32s());
+
+  return (Bit16u) (BX_READ_16BIT_REG(i->sibBase()) + BX_READ_16BIT_REG(i->sibIndex()) + i->displ16s());
+}
+
+#if BX_SUPPORT_X86_64
+BX_CPP_INLINE bx_address BX_CPU_C::BxResolve64(bxInstruction_c *i)
+{
+  return BX_READ_64BIT_REG(i->sibBase()) + (BX_READ_64BIT_REG(i->sibIndex()) << i->sibScale()) + i->displ32s();
+}
+#endif
+
 #endif // defined(NEED_CPU_REG_SHORTCUTS)
 
 BX_CPP_INLINE void BX_CPU_C::updateFetchModeMask(void)
@@ -3543,8 +3755,12 @@ BX_CPP_INLINE void BX_CPU_C::updateFetchModeMask(void)
 #endif
      (BX_CPU_THIS_PTR sregs[BX_SEG_REG_CS].cache.u.segment.d_b);
 
-  BX_CPU_THIS_PTR user_pl = // CPL == 3
+  bx_bool user_pl = // CPL == 3
      (BX_CPU_THIS_PTR sregs[BX_SEG_REG_CS].selector.rpl == 3);
+  if (user_pl != BX_CPU_THIS_PTR user_pl) {
+    BX_CPU_THIS_PTR user_pl = user_pl;
+    invalidate_data_pages();
+  }
 }
 
 #if BX_X86_DEBUGGER
@@ -3625,6 +3841,113 @@ BX_CPP_INLINE bx_address BX_CPU_C::get_instruction_pointer(void)
 }
 #endif
 
+#if BX_SUPPORT_FUSED_PAIRS
+
+// Runs the first instruction of a fused pair (kept in execute2) and gets
+// ready for the second one, whose length is kept in b1, see fuseTrace().
+// Returns 0 if an event must be handled between the two.
+BX_CPP_INLINE bx_bool BX_CPU_C::fusedPairFirst(bxInstruction_c *i)
+{
+  BX_CPU_CALL_METHOD(i->execute2, (i));
+  if (BX_CPU_THIS_PTR async_event) return 0;
+
+  fusedPairSecond(i);
+  return 1;
+}
+
+// Completes the first instruction of a fused pair and moves to the second
+BX_CPP_INLINE void BX_CPU_C::fusedPairSecond(bxInstruction_c *i)
+{
+  BX_CPU_THIS_PTR prev_rip = get_instruction_pointer(); // commit new RIP
+  BX_TICK1_IF_SINGLE_PROCESSOR();
+#if BX_SUPPORT_X86_64
+  BX_CPU_THIS_PTR gen_reg[BX_64BIT_REG_RIP].rrx += i->b1();
+#else
+  BX_CPU_THIS_PTR gen_reg[BX_32BIT_REG_EIP].dword.erx += i->b1();
+#endif
+}
+
+// The second instruction is rebuilt from the fields of the first one it is
+// packed into, see fuseTrace(), with the fields its handler uses only.
+#define BX_FUSED_JCC_HANDLER(jcc)                                           \
+  void BX_CPP_AttrRegparmN(1) BX_CPU_C::jcc##_Fused(bxInstruction_c *i)     \
+  {                                                                         \
+    if (fusedPairFirst(i)) {                                                \
+      bxInstruction_c next;                                                 \
+      next.modRMForm.Id = i->modRMForm.displ32u;                            \
+      jcc(&next);                                                           \
+    }                                                                       \
+  }
+
+#define BX_FUSED_STACK_HANDLER(op)                                          \
+  void BX_CPP_AttrRegparmN(1) BX_CPU_C::op##_Fused(bxInstruction_c *i)      \
+  {                                                                         \
+    if (fusedPairFirst(i)) {                                                \
+      bxInstruction_c next;                                                 \
+      next.setOpcodeReg(i->nnn());                                          \
+      op(&next);                                                            \
+    }                                                                       \
+  }
+
+#define BX_FUSED_ALU_HANDLER(op)                                            \
+  void BX_CPP_AttrRegparmN(1) BX_CPU_C::op##_Fused(bxInstruction_c *i)      \
+  {                                                                         \
+    if (fusedPairFirst(i)) {                                                \
+      bxInstruction_c next;                                                 \
+      next.setNnn(i->modRMForm.Iw & 0xff);                                  \
+      next.setRm(i->modRMForm.Iw >> 8);                                     \
+      op(&next);                                                            \
+    }                                                                       \
+  }
+
+// A register ALU operation followed by one overwriting all the arithmetic
+// flags without reading them (kept in execute2, its operands in the sib
+// fields and displ32u): the first one is run by 'noflags', which leaves the
+// flags alone. No event may be handled between the two, it would see the
+// flags missing: the first one raises none, an interrupt raised by the tick
+// is recognized after the pair. Pending events (single step, code
+// breakpoints) run the first one alone with its flags instead.
+#define BX_DEAD_FLAGS_HANDLER(op, noflags)                                  \
+  void BX_CPP_AttrRegparmN(1) BX_CPU_C::op##_DeadFlags(bxInstruction_c *i)  \
+  {                                                                         \
+    if (BX_CPU_THIS_PTR async_event) {                                      \
+      op(i);                                                                \
+      return;                                                               \
+    }                                                                       \
+    noflags;                                                                \
+    fusedPairSecond(i);                                                     \
+    bxInstruction_c next;                                                   \
+    next.setNnn(i->sibBase());                                              \
+    next.setRm(i->sibIndex());                                              \
+    next.modRMForm.Id = i->modRMForm.displ32u;                              \
+    BX_CPU_CALL_METHOD(i->execute2, (&next));                               \
+  }
+
+#endif
+
+#if BX_DEBUGGER || BX_GDBSTUB
+BX_CPP_INLINE bx_bool BX_CPU_C::dbg_instruction_epilog(void)
+{
+#if BX_DEBUGGER
+  BX_CPU_THIS_PTR guard_found.icount++;
+
+  // Nothing to check unless a stop condition is pending, the code page
+  // holds breakpoints or the instruction left the current code page
+  if (! BX_CPU_THIS_PTR break_point && ! BX_CPU_THIS_PTR magic_break &&
+      ! bx_guard.interrupt_requested && ! dbg_show_mask)
+  {
+    if (! (bx_guard.guard_for & BX_DBG_GUARD_IADDR_ALL))
+      return 0;
+    if (! BX_CPU_THIS_PTR bpoint_page &&
+        (get_instruction_pointer() + BX_CPU_THIS_PTR eipPageBias) < BX_CPU_THIS_PTR eipPageWindowSize)
+      return 0;
+  }
+#endif
+
+  return dbg_check_guards();
+}
+#endif
+
 BX_CPP_INLINE Bit16u BX_CPU_C::get_reg16(unsigned reg)
 {
   assert(reg < BX_GENERAL_REGISTERS);
@@ -276,7 +276,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CALL16_Ep(bxInstruction_c *i)
   BX_CPU_THIS_PTR show_flag |= Flag_call;
 #endif
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_16 = read_virtual_word(i->seg(), eaddr);
   cs_raw = read_virtual_word(i->seg(), eaddr+2);
@@ -553,7 +553,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::JMP16_Ep(bxInstruction_c *i)
 
   invalidate_prefetch_q();
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_16 = read_virtual_word(i->seg(), eaddr);
   cs_raw = read_virtual_word(i->seg(), eaddr+2);
@@ -783,3 +783,23 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LOOP16_Jb(bxInstruction_c *i)
     CX = count;
   }
 }
+
+#if BX_SUPPORT_FUSED_PAIRS
+// Jcc fused with the arithmetic instruction before it, see fuseTrace()
+BX_FUSED_JCC_HANDLER(JO_Jw)
+BX_FUSED_JCC_HANDLER(JNO_Jw)
+BX_FUSED_JCC_HANDLER(JB_Jw)
+BX_FUSED_JCC_HANDLER(JNB_Jw)
+BX_FUSED_JCC_HANDLER(JZ_Jw)
+BX_FUSED_JCC_HANDLER(JNZ_Jw)
+BX_FUSED_JCC_HANDLER(JBE_Jw)
+BX_FUSED_JCC_HANDLER(JNBE_Jw)
+BX_FUSED_JCC_HANDLER(JS_Jw)
+BX_FUSED_JCC_HANDLER(JNS_Jw)
+BX_FUSED_JCC_HANDLER(JP_Jw)
+BX_FUSED_JCC_HANDLER(JNP_Jw)
+BX_FUSED_JCC_HANDLER(JL_Jw)
+BX_FUSED_JCC_HANDLER(JNL_Jw)
+BX_FUSED_JCC_HANDLER(JLE_Jw)
+BX_FUSED_JCC_HANDLER(JNLE_Jw)
+#endif
@@ -278,7 +278,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CALL32_Ep(bxInstruction_c *i)
   BX_CPU_THIS_PTR show_flag |= Flag_call;
 #endif
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_32 = read_virtual_dword(i->seg(), eaddr);
@@ -593,7 +593,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::JMP32_Ep(bxInstruction_c *i)
 
   invalidate_prefetch_q();
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   op1_32 = read_virtual_dword(i->seg(), eaddr);
@@ -826,4 +826,24 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LOOP32_Jb(bxInstruction_c *i)
   }
 }
 
+#if BX_SUPPORT_FUSED_PAIRS
+// Jcc fused with the arithmetic instruction before it, see fuseTrace()
+BX_FUSED_JCC_HANDLER(JO_Jd)
+BX_FUSED_JCC_HANDLER(JNO_Jd)
+BX_FUSED_JCC_HANDLER(JB_Jd)
+BX_FUSED_JCC_HANDLER(JNB_Jd)
+BX_FUSED_JCC_HANDLER(JZ_Jd)
+BX_FUSED_JCC_HANDLER(JNZ_Jd)
+BX_FUSED_JCC_HANDLER(JBE_Jd)
+BX_FUSED_JCC_HANDLER(JNBE_Jd)
+BX_FUSED_JCC_HANDLER(JS_Jd)
+BX_FUSED_JCC_HANDLER(JNS_Jd)
+BX_FUSED_JCC_HANDLER(JP_Jd)
+BX_FUSED_JCC_HANDLER(JNP_Jd)
+BX_FUSED_JCC_HANDLER(JL_Jd)
+BX_FUSED_JCC_HANDLER(JNL_Jd)
+BX_FUSED_JCC_HANDLER(JLE_Jd)
+BX_FUSED_JCC_HANDLER(JNLE_Jd)
+#endif
+
 #endif
@@ -151,7 +151,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CALL64_Ep(bxInstruction_c *i)
   BX_CPU_THIS_PTR show_flag |= Flag_call;
 #endif
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   /* pointer, segment address pair */
   Bit64u op1_64 = read_virtual_qword_64(i->seg(), eaddr);
@@ -407,7 +407,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::JMP64_Ep(bxInstruction_c *i)
 {
   invalidate_prefetch_q();
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit64u op1_64 = read_virtual_qword_64(i->seg(), eaddr);
   Bit16u cs_raw = read_virtual_word_64(i->seg(), eaddr+8);
@@ -573,4 +573,24 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LOOP64_Jb(bxInstruction_c *i)
   }
 }
 
+#if BX_SUPPORT_FUSED_PAIRS
+// Jcc fused with the arithmetic instruction before it, see fuseTrace()
+BX_FUSED_JCC_HANDLER(JO_Jq)
+BX_FUSED_JCC_HANDLER(JNO_Jq)
+BX_FUSED_JCC_HANDLER(JB_Jq)
+BX_FUSED_JCC_HANDLER(JNB_Jq)
+BX_FUSED_JCC_HANDLER(JZ_Jq)
+BX_FUSED_JCC_HANDLER(JNZ_Jq)
+BX_FUSED_JCC_HANDLER(JBE_Jq)
+BX_FUSED_JCC_HANDLER(JNBE_Jq)
+BX_FUSED_JCC_HANDLER(JS_Jq)
+BX_FUSED_JCC_HANDLER(JNS_Jq)
+BX_FUSED_JCC_HANDLER(JP_Jq)
+BX_FUSED_JCC_HANDLER(JNP_Jq)
+BX_FUSED_JCC_HANDLER(JL_Jq)
+BX_FUSED_JCC_HANDLER(JNL_Jq)
+BX_FUSED_JCC_HANDLER(JLE_Jq)
+BX_FUSED_JCC_HANDLER(JNLE_Jq)
+#endif
+
 #endif /* if BX_SUPPORT_X86_64 */
@@ -2367,7 +2367,6 @@ BX_CPU_C::fetchDecode32(const Bit8u *iptr, bxInstruction_c *i, unsigned remainin
   os_32 = is_32 =
     BX_CPU_THIS_PTR sregs[BX_SEG_REG_CS].cache.u.segment.d_b;
 
-  i->ResolveModrm = 0;
   i->init(/*os32*/ is_32,  /*as32*/ is_32,
           /*os64*/     0,  /*as64*/     0);
 
@@ -2480,14 +2479,14 @@ fetch_b1:
     index++; // /m form
 
     i->setRm(BX_TMP_REGISTER);
-    i->setSibBase(rm);      // initialize with rm to use BxResolve32Base
+    i->setSibBase(rm);      // initialize with rm for the forms without s-i-b
     i->setSibIndex(BX_NIL_REGISTER);
+    i->setSibScale(0);
     // initialize displ32 with zero to include cases with no diplacement
     i->modRMForm.displ32u = 0;
 
     if (i->as32L()) {
       // 32-bit addressing modes; note that mod==11b handled above
-      i->ResolveModrm = &BX_CPU_C::BxResolve32Base;
       if (rm != 4) { // no s-i-b byte
         if (mod == 0x00) { // mod == 00b
           if (rm == 5) {
@@ -2519,7 +2518,6 @@ fetch_b1:
         i->setSibScale(scale);
         i->setSibBase(base);
         if (index != 4) {
-          i->ResolveModrm = &BX_CPU_C::BxResolve32BaseIndex;
           i->setSibIndex(index);
         }
         if (mod == 0x00) { // mod==00b, rm==4
@@ -2565,7 +2563,6 @@ fetch_b1:
     }
     else {
       // 16-bit addressing modes, mod==11b handled above
-      i->ResolveModrm = &BX_CPU_C::BxResolve16BaseIndex;
       i->setSibBase(Resolve16BaseReg[rm]);
       i->setSibIndex(Resolve16IndexReg[rm]);
       if (mod == 0x00) { // mod == 00b
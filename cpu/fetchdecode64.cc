@@ -3270,7 +3270,6 @@ BX_CPU_C::fetchDecode64(const Bit8u *iptr, bxInstruction_c *i, unsigned remainin
   unsigned sse_prefix = SSE_PREFIX_NONE;
   unsigned rex_prefix = 0;
 
-  i->ResolveModrm = 0;
   i->init(/*os32*/ 1,  // operand size 32 override defaults to 1
           /*as32*/ 1,  // address size 32 override defaults to 1
           /*os64*/ 0,  // operand size 64 override defaults to 0
@@ -3421,14 +3420,14 @@ fetch_b1:
     index++;
 
     i->setRm(BX_TMP_REGISTER);
-    i->setSibBase(rm);      // initialize with rm to use BxResolve32Base
+    i->setSibBase(rm);      // initialize with rm for the forms without s-i-b
     i->setSibIndex(BX_NIL_REGISTER);
+    i->setSibScale(0);
     // initialize displ32 with zero to include cases with no diplacement
     i->modRMForm.displ32u = 0;
 
     if (i->as64L()) {
       // 64-bit addressing modes; note that mod==11b handled above
-      i->ResolveModrm = &BX_CPU_C::BxResolve64Base;
       if ((rm & 0x7) != 4) { // no s-i-b byte
         if (mod == 0x00) { // mod == 00b
           if ((rm & 0x7) == 5) {
@@ -3456,7 +3455,6 @@ fetch_b1:
         i->setSibScale(scale);
         i->setSibBase(base);
         if (index != 4) {
-          i->ResolveModrm = &BX_CPU_C::BxResolve64BaseIndex;
           i->setSibIndex(index);
         }
         if (mod == 0x00) { // mod==00b, rm==4
@@ -3474,7 +3472,6 @@ fetch_b1:
     }
     else {
       // 32-bit addressing modes; note that mod==11b handled above
-      i->ResolveModrm = &BX_CPU_C::BxResolve32Base;
       if ((rm & 0x7) != 4) { // no s-i-b byte
         if (mod == 0x00) { // mod == 00b
           if ((rm & 0x7) == 5) {
@@ -3502,7 +3499,6 @@ fetch_b1:
         i->setSibBase(base);
         i->setSibScale(scale);
         if (index != 4) {
-          i->ResolveModrm = &BX_CPU_C::BxResolve32BaseIndex;
           i->setSibIndex(index);
         }
         if (mod == 0x00) { // mod==00b, rm==4
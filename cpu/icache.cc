@@ -122,6 +122,10 @@ void BX_CPU_C::serveICacheMiss(bxICacheEntry_c *entry, Bit32u eipBiased, bx_phy_
       if (mergeTraces(entry, i, pAddr)) break;
   }
 
+#if BX_SUPPORT_FUSED_PAIRS
+  fuseTrace(entry);
+#endif
+
   BX_CPU_THIS_PTR iCache.commit_trace(entry->tlen);
 }
 
@@ -147,6 +151,295 @@ bx_bool BX_CPU_C::mergeTraces(bxICacheEntry_c *entry, bxInstruction_c *i, bx_phy
   return 0;
 }
 
+#if BX_SUPPORT_FUSED_PAIRS
+
+enum {
+  BX_FUSABLE_NONE = 0,
+  BX_FUSABLE_ARITH, // setting the flags for a Jcc, register forms only
+  BX_FUSABLE_PUSH,
+  BX_FUSABLE_POP,
+  BX_FUSABLE_LOAD   // for an ALU instruction using the loaded register
+};
+
+// Kind of pair an instruction may start
+static unsigned fusableFirst(unsigned ia_opcode)
+{
+  switch(ia_opcode) {
+    case BX_IA_ADD_GwEwR: case BX_IA_ADD_EwIwR: case BX_IA_ADD_AXIw:
+    case BX_IA_ADD_GdEdR: case BX_IA_ADD_EdIdR: case BX_IA_ADD_EAXId:
+    case BX_IA_SUB_GwEwR: case BX_IA_SUB_EwIwR: case BX_IA_SUB_AXIw:
+    case BX_IA_SUB_GdEdR: case BX_IA_SUB_EdIdR: case BX_IA_SUB_EAXId:
+    case BX_IA_AND_GwEwR: case BX_IA_AND_EwIwR: case BX_IA_AND_AXIw:
+    case BX_IA_AND_GdEdR: case BX_IA_AND_EdIdR: case BX_IA_AND_EAXId:
+    case BX_IA_OR_GwEwR:  case BX_IA_OR_EwIwR:  case BX_IA_OR_AXIw:
+    case BX_IA_OR_GdEdR:  case BX_IA_OR_EdIdR:  case BX_IA_OR_EAXId:
+    case BX_IA_XOR_GwEwR: case BX_IA_XOR_EwIwR: case BX_IA_XOR_AXIw:
+    case BX_IA_XOR_GdEdR: case BX_IA_XOR_EdIdR: case BX_IA_XOR_EAXId:
+    case BX_IA_CMP_GwEwR: case BX_IA_CMP_EwIwR: case BX_IA_CMP_AXIw:
+    case BX_IA_CMP_GdEdR: case BX_IA_CMP_EdIdR: case BX_IA_CMP_EAXId:
+    case BX_IA_TEST_EwGwR: case BX_IA_TEST_EwIwR: case BX_IA_TEST_AXIw:
+    case BX_IA_TEST_EdGdR: case BX_IA_TEST_EdIdR: case BX_IA_TEST_EAXId:
+    case BX_IA_INC_RX:  case BX_IA_INC_EwR: case BX_IA_DEC_RX:  case BX_IA_DEC_EwR:
+    case BX_IA_INC_ERX: case BX_IA_INC_EdR: case BX_IA_DEC_ERX: case BX_IA_DEC_EdR:
+#if BX_SUPPORT_X86_64
+    case BX_IA_ADD_GqEqR: case BX_IA_ADD_EqIdR: case BX_IA_ADD_RAXId:
+    case BX_IA_SUB_GqEqR: case BX_IA_SUB_EqIdR: case BX_IA_SUB_RAXId:
+    case BX_IA_AND_GqEqR: case BX_IA_AND_EqIdR: case BX_IA_AND_RAXId:
+    case BX_IA_OR_GqEqR:  case BX_IA_OR_EqIdR:  case BX_IA_OR_RAXId:
+    case BX_IA_XOR_GqEqR: case BX_IA_XOR_EqIdR: case BX_IA_XOR_RAXId:
+    case BX_IA_CMP_GqEqR: case BX_IA_CMP_EqIdR: case BX_IA_CMP_RAXId:
+    case BX_IA_TEST_EqGqR: case BX_IA_TEST_EqIdR: case BX_IA_TEST_RAXId:
+    case BX_IA_INC_EqR: case BX_IA_DEC_EqR:
+#endif
+      return BX_FUSABLE_ARITH;
+    case BX_IA_PUSH_RX:  case BX_IA_PUSH_EwR:
+    case BX_IA_PUSH_ERX: case BX_IA_PUSH_EdR:
+#if BX_SUPPORT_X86_64
+    case BX_IA_PUSH_RRX: case BX_IA_PUSH_EqR:
+#endif
+      return BX_FUSABLE_PUSH;
+    case BX_IA_POP_RX:  case BX_IA_POP_EwR:
+    case BX_IA_POP_ERX: case BX_IA_POP_EdR:
+#if BX_SUPPORT_X86_64
+    case BX_IA_POP_RRX: case BX_IA_POP_EqR:
+#endif
+      return BX_FUSABLE_POP;
+    case BX_IA_MOV_GwEwM: case BX_IA_MOV32_GdEdM:
+#if BX_SUPPORT_X86_64
+    case BX_IA_MOV64_GdEdM: case BX_IA_MOV_GqEqM:
+#endif
+      return BX_FUSABLE_LOAD;
+  }
+  return BX_FUSABLE_NONE;
+}
+
+// Arithmetic instructions overwriting all the flags without reading them,
+// register forms only
+static bx_bool killsFlags(unsigned ia_opcode)
+{
+  switch(ia_opcode) {
+    case BX_IA_ADD_GwEwR: case BX_IA_ADD_EwIwR: case BX_IA_ADD_AXIw:
+    case BX_IA_ADD_GdEdR: case BX_IA_ADD_EdIdR: case BX_IA_ADD_EAXId:
+    case BX_IA_SUB_GwEwR: case BX_IA_SUB_EwIwR: case BX_IA_SUB_AXIw:
+    case BX_IA_SUB_GdEdR: case BX_IA_SUB_EdIdR: case BX_IA_SUB_EAXId:
+    case BX_IA_AND_GwEwR: case BX_IA_AND_EwIwR: case BX_IA_AND_AXIw:
+    case BX_IA_AND_GdEdR: case BX_IA_AND_EdIdR: case BX_IA_AND_EAXId:
+    case BX_IA_OR_GwEwR:  case BX_IA_OR_EwIwR:  case BX_IA_OR_AXIw:
+    case BX_IA_OR_GdEdR:  case BX_IA_OR_EdIdR:  case BX_IA_OR_EAXId:
+    case BX_IA_XOR_GwEwR: case BX_IA_XOR_EwIwR: case BX_IA_XOR_AXIw:
+    case BX_IA_XOR_GdEdR: case BX_IA_XOR_EdIdR: case BX_IA_XOR_EAXId:
+    case BX_IA_CMP_GwEwR: case BX_IA_CMP_EwIwR: case BX_IA_CMP_AXIw:
+    case BX_IA_CMP_GdEdR: case BX_IA_CMP_EdIdR: case BX_IA_CMP_EAXId:
+    case BX_IA_TEST_EwGwR: case BX_IA_TEST_EwIwR: case BX_IA_TEST_AXIw:
+    case BX_IA_TEST_EdGdR: case BX_IA_TEST_EdIdR: case BX_IA_TEST_EAXId:
+#if BX_SUPPORT_X86_64
+    case BX_IA_ADD_GqEqR: case BX_IA_ADD_EqIdR: case BX_IA_ADD_RAXId:
+    case BX_IA_SUB_GqEqR: case BX_IA_SUB_EqIdR: case BX_IA_SUB_RAXId:
+    case BX_IA_AND_GqEqR: case BX_IA_AND_EqIdR: case BX_IA_AND_RAXId:
+    case BX_IA_OR_GqEqR:  case BX_IA_OR_EqIdR:  case BX_IA_OR_RAXId:
+    case BX_IA_XOR_GqEqR: case BX_IA_XOR_EqIdR: case BX_IA_XOR_RAXId:
+    case BX_IA_CMP_GqEqR: case BX_IA_CMP_EqIdR: case BX_IA_CMP_RAXId:
+    case BX_IA_TEST_EqGqR: case BX_IA_TEST_EqIdR: case BX_IA_TEST_RAXId:
+#endif
+      return 1;
+  }
+  return 0;
+}
+
+#define BX_DEAD_FLAGS(ia, first) case BX_IA_##ia: return &BX_CPU_C::first##_DeadFlags
+
+// Handler of the pair by the first instruction, whose flags are dead
+static BxExecutePtr_tR deadFlags(unsigned ia_opcode)
+{
+  switch(ia_opcode) {
+    BX_DEAD_FLAGS(ADD_GdEdR, ADD_GdEdR);   BX_DEAD_FLAGS(ADD_EdIdR, ADD_EdIdR);   BX_DEAD_FLAGS(ADD_EAXId, ADD_EAXId);
+    BX_DEAD_FLAGS(SUB_GdEdR, SUB_GdEdR);   BX_DEAD_FLAGS(SUB_EdIdR, SUB_EdIdR);   BX_DEAD_FLAGS(SUB_EAXId, SUB_EAXId);
+    BX_DEAD_FLAGS(AND_GdEdR, AND_GdEdR);   BX_DEAD_FLAGS(AND_EdIdR, AND_EdIdR);   BX_DEAD_FLAGS(AND_EAXId, AND_EAXId);
+    BX_DEAD_FLAGS(OR_GdEdR, OR_GdEdR);     BX_DEAD_FLAGS(OR_EdIdR, OR_EdIdR);     BX_DEAD_FLAGS(OR_EAXId, OR_EAXId);
+    BX_DEAD_FLAGS(XOR_GdEdR, XOR_GdEdR);   BX_DEAD_FLAGS(XOR_EdIdR, XOR_EdIdR);   BX_DEAD_FLAGS(XOR_EAXId, XOR_EAXId);
+    BX_DEAD_FLAGS(CMP_GdEdR, CMP_GdEdR);   BX_DEAD_FLAGS(CMP_EdIdR, CMP_EdIdR);   BX_DEAD_FLAGS(CMP_EAXId, CMP_EAXId);
+    BX_DEAD_FLAGS(TEST_EdGdR, TEST_EdGdR); BX_DEAD_FLAGS(TEST_EdIdR, TEST_EdIdR); BX_DEAD_FLAGS(TEST_EAXId, TEST_EAXId);
+    BX_DEAD_FLAGS(INC_ERX, INC_ERX); BX_DEAD_FLAGS(INC_EdR, INC_ERX);
+    BX_DEAD_FLAGS(DEC_ERX, DEC_ERX); BX_DEAD_FLAGS(DEC_EdR, DEC_ERX);
+#if BX_SUPPORT_X86_64
+    BX_DEAD_FLAGS(ADD_GqEqR, ADD_GqEqR);   BX_DEAD_FLAGS(ADD_EqIdR, ADD_EqIdR);   BX_DEAD_FLAGS(ADD_RAXId, ADD_RAXId);
+    BX_DEAD_FLAGS(SUB_GqEqR, SUB_GqEqR);   BX_DEAD_FLAGS(SUB_EqIdR, SUB_EqIdR);   BX_DEAD_FLAGS(SUB_RAXId, SUB_RAXId);
+    BX_DEAD_FLAGS(AND_GqEqR, AND_GqEqR);   BX_DEAD_FLAGS(AND_EqIdR, AND_EqIdR);   BX_DEAD_FLAGS(AND_RAXId, AND_RAXId);
+    BX_DEAD_FLAGS(OR_GqEqR, OR_GqEqR);     BX_DEAD_FLAGS(OR_EqIdR, OR_EqIdR);     BX_DEAD_FLAGS(OR_RAXId, OR_RAXId);
+    BX_DEAD_FLAGS(XOR_GqEqR, XOR_GqEqR);   BX_DEAD_FLAGS(XOR_EqIdR, XOR_EqIdR);   BX_DEAD_FLAGS(XOR_RAXId, XOR_RAXId);
+    BX_DEAD_FLAGS(CMP_GqEqR, CMP_GqEqR);   BX_DEAD_FLAGS(CMP_EqIdR, CMP_EqIdR);   BX_DEAD_FLAGS(CMP_RAXId, CMP_RAXId);
+    BX_DEAD_FLAGS(TEST_EqGqR, TEST_EqGqR); BX_DEAD_FLAGS(TEST_EqIdR, TEST_EqIdR); BX_DEAD_FLAGS(TEST_RAXId, TEST_RAXId);
+    BX_DEAD_FLAGS(INC_EqR, INC_EqR); BX_DEAD_FLAGS(DEC_EqR, DEC_EqR);
+#endif
+  }
+  return NULL;
+}
+
+#undef BX_DEAD_FLAGS
+
+#define BX_FUSED(ia, second) case BX_IA_##ia: return &BX_CPU_C::second##_Fused
+
+// Handler of the pair by the second instruction
+static BxExecutePtr_tR fusedJcc(unsigned ia_opcode)
+{
+  switch(ia_opcode) {
+    BX_FUSED(JO_Jw, JO_Jw);   BX_FUSED(JNO_Jw, JNO_Jw);   BX_FUSED(JB_Jw, JB_Jw);   BX_FUSED(JNB_Jw, JNB_Jw);
+    BX_FUSED(JZ_Jw, JZ_Jw);   BX_FUSED(JNZ_Jw, JNZ_Jw);   BX_FUSED(JBE_Jw, JBE_Jw); BX_FUSED(JNBE_Jw, JNBE_Jw);
+    BX_FUSED(JS_Jw, JS_Jw);   BX_FUSED(JNS_Jw, JNS_Jw);   BX_FUSED(JP_Jw, JP_Jw);   BX_FUSED(JNP_Jw, JNP_Jw);
+    BX_FUSED(JL_Jw, JL_Jw);   BX_FUSED(JNL_Jw, JNL_Jw);   BX_FUSED(JLE_Jw, JLE_Jw); BX_FUSED(JNLE_Jw, JNLE_Jw);
+    BX_FUSED(JO_Jd, JO_Jd);   BX_FUSED(JNO_Jd, JNO_Jd);   BX_FUSED(JB_Jd, JB_Jd);   BX_FUSED(JNB_Jd, JNB_Jd);
+    BX_FUSED(JZ_Jd, JZ_Jd);   BX_FUSED(JNZ_Jd, JNZ_Jd);   BX_FUSED(JBE_Jd, JBE_Jd); BX_FUSED(JNBE_Jd, JNBE_Jd);
+    BX_FUSED(JS_Jd, JS_Jd);   BX_FUSED(JNS_Jd, JNS_Jd);   BX_FUSED(JP_Jd, JP_Jd);   BX_FUSED(JNP_Jd, JNP_Jd);
+    BX_FUSED(JL_Jd, JL_Jd);   BX_FUSED(JNL_Jd, JNL_Jd);   BX_FUSED(JLE_Jd, JLE_Jd); BX_FUSED(JNLE_Jd, JNLE_Jd);
+#if BX_SUPPORT_X86_64
+    BX_FUSED(JO_Jq, JO_Jq);   BX_FUSED(JNO_Jq, JNO_Jq);   BX_FUSED(JB_Jq, JB_Jq);   BX_FUSED(JNB_Jq, JNB_Jq);
+    BX_FUSED(JZ_Jq, JZ_Jq);   BX_FUSED(JNZ_Jq, JNZ_Jq);   BX_FUSED(JBE_Jq, JBE_Jq); BX_FUSED(JNBE_Jq, JNBE_Jq);
+    BX_FUSED(JS_Jq, JS_Jq);   BX_FUSED(JNS_Jq, JNS_Jq);   BX_FUSED(JP_Jq, JP_Jq);   BX_FUSED(JNP_Jq, JNP_Jq);
+    BX_FUSED(JL_Jq, JL_Jq);   BX_FUSED(JNL_Jq, JNL_Jq);   BX_FUSED(JLE_Jq, JLE_Jq); BX_FUSED(JNLE_Jq, JNLE_Jq);
+#endif
+  }
+  return NULL;
+}
+
+static BxExecutePtr_tR fusedStack(unsigned ia_opcode)
+{
+  switch(ia_opcode) {
+    BX_FUSED(PUSH_RX, PUSH_RX);   BX_FUSED(PUSH_EwR, PUSH_RX);
+    BX_FUSED(PUSH_ERX, PUSH_ERX); BX_FUSED(PUSH_EdR, PUSH_ERX);
+    BX_FUSED(POP_RX, POP_RX);     BX_FUSED(POP_EwR, POP_RX);
+    BX_FUSED(POP_ERX, POP_ERX);   BX_FUSED(POP_EdR, POP_ERX);
+#if BX_SUPPORT_X86_64
+    BX_FUSED(PUSH_RRX, PUSH_RRX); BX_FUSED(PUSH_EqR, PUSH_RRX);
+    BX_FUSED(POP_RRX, POP_RRX);   BX_FUSED(POP_EqR, POP_RRX);
+#endif
+  }
+  return NULL;
+}
+
+static BxExecutePtr_tR fusedArith(unsigned ia_opcode)
+{
+  switch(ia_opcode) {
+    BX_FUSED(ADD_GdEdR, ADD_GdEdR); BX_FUSED(SUB_GdEdR, SUB_GdEdR);
+    BX_FUSED(CMP_GdEdR, CMP_GdEdR); BX_FUSED(AND_GdEdR, AND_GdEdR);
+    BX_FUSED(OR_GdEdR, OR_GdEdR);   BX_FUSED(XOR_GdEdR, XOR_GdEdR);
+    BX_FUSED(TEST_EdGdR, TEST_EdGdR);
+#if BX_SUPPORT_X86_64
+    BX_FUSED(ADD_GqEqR, ADD_GqEqR); BX_FUSED(SUB_GqEqR, SUB_GqEqR);
+    BX_FUSED(CMP_GqEqR, CMP_GqEqR); BX_FUSED(AND_GqEqR, AND_GqEqR);
+    BX_FUSED(OR_GqEqR, OR_GqEqR);   BX_FUSED(XOR_GqEqR, XOR_GqEqR);
+    BX_FUSED(TEST_EqGqR, TEST_EqGqR);
+#endif
+  }
+  return NULL;
+}
+
+#undef BX_FUSED
+
+// What each instruction can be in a pair: the kind of pair it may start,
+// and if it may end one; built on the first use, see fuseTrace()
+#define BX_PAIR_FIRST_MASK  0x07
+#define BX_PAIR_JCC         0x08
+#define BX_PAIR_KILLS_FLAGS 0x10
+#define BX_PAIR_ALU         0x20
+
+static Bit8u BxPairRoles[BX_IA_LAST];
+
+static void initPairRoles(void)
+{
+  for (unsigned ia_opcode = 0; ia_opcode < BX_IA_LAST; ia_opcode++) {
+    Bit8u roles = fusableFirst(ia_opcode);
+    if (fusedJcc(ia_opcode)) roles |= BX_PAIR_JCC;
+    if (killsFlags(ia_opcode)) roles |= BX_PAIR_KILLS_FLAGS;
+    if (fusedArith(ia_opcode)) roles |= BX_PAIR_ALU;
+    BxPairRoles[ia_opcode] = roles;
+  }
+}
+
+// Pairs of instructions of the trace executed by one handler. The second
+// instruction is packed into the first one: the fields its handler uses go
+// to fields unused by the first one, its length to b1. The first one keeps
+// its own handler in execute2 and gets the handler of the pair, which runs
+// both, see fusedPairFirst(). The trace gets one instruction less, so the
+// cpu loop needs no check.
+//
+// A register ALU operation followed by one overwriting all its flags gets
+// a handler computing it without the flags instead, which keeps the
+// handler of the second instruction in execute2, see BX_DEAD_FLAGS_HANDLER.
+//
+// Pending events (traps, breakpoints, SMC) stop the pair after the first
+// instruction, the cpu loop handles them and restarts at the second one.
+// An interrupt raised by the tick between the two is recognized after the
+// pair, as on the CPUs fusing such pairs. A pair counts as one instruction
+// of the SMP quantum.
+void BX_CPU_C::fuseTrace(bxICacheEntry_c *entry)
+{
+  static bx_bool roles_ready = 0;
+  if (! roles_ready) {
+    initPairRoles();
+    roles_ready = 1;
+  }
+
+  bxInstruction_c *i = entry->i, *last = i + entry->tlen, *dst = i;
+
+  for (; i < last; i++, dst++) {
+    if (dst != i) *dst = *i;
+
+    // not the pairs copied from another trace by mergeTraces()
+    bxInstruction_c *next = i+1;
+    if (next == last || i->execute2 != NULL || next->execute2 != NULL)
+      continue;
+
+    unsigned first = i->getIaOpcode(), second = next->getIaOpcode();
+    unsigned roles = BxPairRoles[first] & BX_PAIR_FIRST_MASK;
+    if (roles == BX_FUSABLE_NONE) continue;
+    roles |= BxPairRoles[second] & ~BX_PAIR_FIRST_MASK;
+
+    BxExecutePtr_tR execute = NULL, execute2 = i->execute;
+
+    switch(roles & BX_PAIR_FIRST_MASK) {
+      case BX_FUSABLE_ARITH:
+        // register form, the displacement and the sib fields are not used
+        if (roles & BX_PAIR_JCC) {
+          execute = fusedJcc(second);
+          dst->modRMForm.displ32u = next->Id();
+        }
+        else if ((roles & BX_PAIR_KILLS_FLAGS) && (execute = deadFlags(first)) != NULL) {
+          dst->setSibBase(next->nnn());
+          dst->setSibIndex(next->rm());
+          dst->modRMForm.displ32u = next->Id();
+          execute2 = next->execute;
+        }
+        break;
+      case BX_FUSABLE_PUSH:
+      case BX_FUSABLE_POP:
+        // the register is in the opcode or rm, nnn is not used
+        if ((BxPairRoles[second] & BX_PAIR_FIRST_MASK) == (roles & BX_PAIR_FIRST_MASK)) {
+          execute = fusedStack(second);
+          dst->setNnn(next->opcodeReg());
+        }
+        break;
+      case BX_FUSABLE_LOAD:
+        // no immediate
+        if (roles & BX_PAIR_ALU) {
+          execute = fusedArith(second);
+          dst->modRMForm.Iw = next->nnn() | (next->rm() << 8);
+        }
+        break;
+    }
+
+    if (execute) {
+      dst->execute2 = execute2;
+      dst->execute = execute;
+      dst->setB1(next->ilen());
+      i++;
+    }
+  }
+
+  entry->tlen = dst - entry->i;
+}
+
+#endif
+
 #else // BX_SUPPORT_TRACE_CACHE == 0
 
 bx_bool BX_CPU_C::fetchInstruction(bxInstruction_c *iStorage, Bit32u eipBiased)
@@ -44,8 +44,12 @@ class bxPageWriteStampTable
 #define PHY_MEM_PAGES (1024*1024)
 
 public:
+  // Number of writes which invalidated cached code of a page
+  Bit64u smcInvalidations;
+
   bxPageWriteStampTable() {
     pageWriteStampTable = new Bit32u[PHY_MEM_PAGES];
+    smcInvalidations = 0;
     resetWriteStamps();
   }
  ~bxPageWriteStampTable() { delete [] pageWriteStampTable; }
@@ -79,6 +83,7 @@ public:
   {
     Bit32u index = hash(pAddr);
     if (pageWriteStampTable[index] & ICacheWriteStampFetchModeMask) {
+      smcInvalidations++;
 #if BX_SUPPORT_TRACE_CACHE
       handleSMC(pAddr); // one of the CPUs might be running trace from this page
 #endif
@@ -107,6 +112,15 @@ extern bxPageWriteStampTable pageWriteStampTable;
   #define BX_MAX_TRACE_LENGTH 32
 #endif
 
+// Frequent pairs of instructions of a trace (compare and branch, push and
+// push, load and ALU ...) are executed by one dispatch of the cpu loop.
+// Not with the debuggers or instrumentation, they see every instruction.
+#if BX_SUPPORT_TRACE_CACHE && !BX_DEBUGGER && !BX_GDBSTUB && !BX_INSTRUMENTATION
+  #define BX_SUPPORT_FUSED_PAIRS 1
+#else
+  #define BX_SUPPORT_FUSED_PAIRS 0
+#endif
+
 struct bxICacheEntry_c
 {
   bx_phy_address pAddr; // Physical address of the instruction
@@ -137,9 +151,10 @@ public:
   } pageSplitIndex[BX_ICACHE_PAGE_SPLIT_ENTRIES];
   int nextPageSplitIndex;
 #endif
+  Bit64u flushes;
 
 public:
-  bxICache_c() { flushICacheEntries(); }
+  bxICache_c() { flushICacheEntries(); flushes = 0; }
 
   BX_CPP_INLINE unsigned hash(bx_phy_address pAddr, unsigned fetchModeMask) const
   {
@@ -194,6 +209,8 @@ BX_CPP_INLINE void bxICache_c::flushICacheEntries(void)
   for (i=0; i<BxICacheEntries; i++, e++)
     e->writeStamp = ICacheWriteStampInvalid;
 
+  flushes++;
+
 #if BX_SUPPORT_TRACE_CACHE
   for (i=0;i<BX_ICACHE_PAGE_SPLIT_ENTRIES;i++)
     pageSplitIndex[i].ppf = BX_ICACHE_INVALID_PHY_ADDRESS;
@@ -172,6 +172,34 @@ void BX_CPU_C::initialize(void)
 #if BX_WITH_WX
   register_wx_state();
 #endif
+
+  register_stats();
+}
+
+void BX_CPU_C::register_stats(void)
+{
+  char name[16];
+
+  memset(&BX_CPU_THIS_PTR stats, 0, sizeof(BX_CPU_THIS_PTR stats));
+  BX_CPU_THIS_PTR iCache.flushes = 0;
+
+  bx_list_c *stats = (bx_list_c*) SIM->get_param(BXPN_STATS);
+  sprintf(name, "cpu%d", BX_CPU_ID);
+  if (stats->get_by_name(name) != NULL) return;
+
+  bx_list_c *list = new bx_list_c(stats, name, name, 8);
+  new bx_shadow_num_c(list, "icache_hits", &BX_CPU_THIS_PTR stats.icache_hits);
+  new bx_shadow_num_c(list, "icache_misses", &BX_CPU_THIS_PTR stats.icache_misses);
+  new bx_shadow_num_c(list, "icache_flushes", &BX_CPU_THIS_PTR iCache.flushes);
+  new bx_shadow_num_c(list, "tlb_misses", &BX_CPU_THIS_PTR stats.tlb_misses);
+  new bx_shadow_num_c(list, "page_walks", &BX_CPU_THIS_PTR stats.page_walks);
+  new bx_shadow_num_c(list, "async_events", &BX_CPU_THIS_PTR stats.async_events);
+  new bx_shadow_num_c(list, "idle_skips", &BX_CPU_THIS_PTR stats.idle_skips);
+  new bx_shadow_num_c(list, "idle_ticks", &BX_CPU_THIS_PTR stats.idle_ticks);
+
+  // the page write stamps are shared by all CPUs
+  if (SIM->get_param(BXPN_STATS_SMC) == NULL)
+    new bx_shadow_num_c(stats, "smc_invalidations", &pageWriteStampTable.smcInvalidations);
 }
 
 #if BX_WITH_WX
@@ -1077,6 +1105,11 @@ void BX_CPU_C::reset(unsigned source)
   BX_CPU_THIS_PTR ignore_bad_msrs = SIM->get_param_bool(BXPN_IGNORE_BAD_MSRS)->get();
 #endif
 
+  // other CPUs may end the idle loop of this one at any time
+  BX_CPU_THIS_PTR idle_skip = SIM->get_param_bool(BXPN_IDLE_SKIP)->get() &&
+                              BX_SMP_PROCESSORS == 1;
+  memset(&BX_CPU_THIS_PTR idle, 0, sizeof(BX_CPU_THIS_PTR idle));
+
   BX_INSTR_RESET(BX_CPU_ID, source);
 }
 
@@ -29,23 +29,20 @@ class bxInstruction_c;
 // <TAG-TYPE-EXECUTEPTR-START>
 #if BX_USE_CPU_SMF
 typedef void (BX_CPP_AttrRegparmN(1) *BxExecutePtr_tR)(bxInstruction_c *);
-typedef bx_address (BX_CPP_AttrRegparmN(1) *BxResolvePtr_tR)(bxInstruction_c *);
 #else
 typedef void (BX_CPU_C::*BxExecutePtr_tR)(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
-typedef bx_address (BX_CPU_C::*BxResolvePtr_tR)(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
 #endif
 // <TAG-TYPE-EXECUTEPTR-END>
 
 // <TAG-CLASS-INSTRUCTION-START>
 class bxInstruction_c {
 public:
-  // Function pointers; a function to resolve the modRM address
-  // given the current state of the CPU and the instruction data,
-  // and a function to execute the instruction after resolving
-  // the memory address (if any).
+  // Function pointers; a function to execute the instruction and a
+  // function to execute it after resolving the memory address (if any).
+  // The modRM address is computed from the instruction data by
+  // BX_CPU_RESOLVE_ADDR.
   BxExecutePtr_tR execute;
   BxExecutePtr_tR execute2;
-  BxResolvePtr_tR ResolveModrm;
 
   struct {
     //  15..0 opcode
@@ -40,72 +40,86 @@
 //
 
 #if BX_SupportRepeatSpeedups
-Bit32u BX_CPU_C::FastRepINSW(bxInstruction_c *i, bx_address dstOff, Bit16u port, Bit32u wordCount)
+// Restrict the element count so that the string offset register does not
+// wrap around the end of the address space in the middle of the transfer
+static Bit32u FastRepOffsetLimit(bxInstruction_c *i, bx_address offset, unsigned len, bx_bool df, Bit32u count)
 {
-  Bit32u wordsFitDst;
-  signed int pointerDelta;
-  Bit8u *hostAddrDst;
-  unsigned count;
+  Bit32u elemsFit;
+
+#if BX_SUPPORT_X86_64
+  if (i->as64L()) return count;
+#endif
+
+  Bit64u addrMask = i->as32L() ? BX_CONST64(0xffffffff) : 0xffff;
+  if (df) {
+    // Counting downward
+    elemsFit = (Bit32u)(offset / len) + 1;
+  }
+  else {
+    // Counting upward
+    elemsFit = (Bit32u)((addrMask - offset + 1) / len);
+  }
 
-  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
+  return (count > elemsFit) ? elemsFit : count;
+}
+
+Bit32u BX_CPU_C::FastRepINS(bxInstruction_c *i, bx_address dstOff, Bit16u port, unsigned len, Bit32u count)
+{
+  Bit32u elemsFitDst;
+  Bit8u *hostAddrDst;
 
-  bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[BX_SEG_REG_ES];
-  if (!(dstSegPtr->cache.valid & SegAccessWOK))
-    return 0;
-  if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
-    return 0;
+#if BX_SUPPORT_X86_64
+  if (BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64)
+#endif
+  {
+    bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[BX_SEG_REG_ES];
+    if (!(dstSegPtr->cache.valid & SegAccessWOK))
+      return 0;
+    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
+      return 0;
+  }
 
   bx_address laddrDst = BX_CPU_THIS_PTR get_laddr(BX_SEG_REG_ES, dstOff);
-  // check that the address is word aligned
-  if (laddrDst & 1) return 0;
+  // check that the address is aligned to the element size, so no
+  // element could cross the page boundary
+  if (laddrDst & (len-1)) return 0;
+#if BX_SUPPORT_X86_64
+  if (! IsCanonical(laddrDst)) return 0;
+#endif
 
   hostAddrDst = v2h_write_byte(laddrDst, BX_CPU_THIS_PTR user_pl);
   // Check that native host access was not vetoed for that page
   if (!hostAddrDst) return 0;
 
-  // See how many words can fit in the rest of this page.
+  // See how many elements can fit in the rest of this page.
   if (BX_CPU_THIS_PTR get_DF()) {
     // Counting downward
-    // 1st word must cannot cross page boundary because it is word aligned
-    wordsFitDst = (2 + (PAGE_OFFSET(laddrDst))) >> 1;
-    pointerDelta = -2;
+    elemsFitDst = (len + PAGE_OFFSET(laddrDst)) / len;
   }
   else {
     // Counting upward
-    wordsFitDst = (0x1000 - PAGE_OFFSET(laddrDst)) >> 1;
-    pointerDelta =  2;
+    elemsFitDst = (0x1000 - PAGE_OFFSET(laddrDst)) / len;
   }
 
-  // Restrict word count to the number that will fit in this page.
-  if (wordCount > wordsFitDst)
-      wordCount = wordsFitDst;
+  // Restrict element count to the number that will fit in this page.
+  if (count > elemsFitDst)
+    count = elemsFitDst;
+  count = FastRepOffsetLimit(i, dstOff, len, BX_CPU_THIS_PTR get_DF(), count);
+  if (count > bx_pc_system.getNumCpuTicksLeftNextEvent())
+    count = bx_pc_system.getNumCpuTicksLeftNextEvent();
 
   // If after all the restrictions, there is anything left to do...
-  if (wordCount) {
-    for (count=0; count<wordCount; ) {
-      bx_devices.bulkIOQuantumsTransferred = 0;
-      if (BX_CPU_THIS_PTR get_DF()==0) { // Only do accel for DF=0
-        bx_devices.bulkIOHostAddr = hostAddrDst;
-        bx_devices.bulkIOQuantumsRequested = (wordCount - count);
-      }
-      else
-        bx_devices.bulkIOQuantumsRequested = 0;
-      Bit16u temp16 = BX_INP(port, 2);
-      if (bx_devices.bulkIOQuantumsTransferred) {
-        hostAddrDst = bx_devices.bulkIOHostAddr;
-        count += bx_devices.bulkIOQuantumsTransferred;
-      }
-      else {
-        WriteHostWordToLittleEndian(hostAddrDst, temp16);
-        hostAddrDst += pointerDelta;
-        count++;
-      }
-      // Terminate early if there was an event.
-      if (BX_CPU_THIS_PTR async_event) break;
+  if (count) {
+    if (BX_CPU_THIS_PTR get_DF()) {
+      // The device delivers elements in ascending order, store them backwards
+      Bit8u buffer[0x1000];
+      count = BX_BULK_INP(port, buffer, len, count);
+      for (unsigned n=0; n<count; n++)
+        memcpy(hostAddrDst - n*len, buffer + n*len, len);
+    }
+    else {
+      count = BX_BULK_INP(port, hostAddrDst, len, count);
     }
-
-    // Reset for next non-bulk IO
-    bx_devices.bulkIOQuantumsRequested = 0;
 
     return count;
   }
@@ -113,74 +127,63 @@ Bit32u BX_CPU_C::FastRepINSW(bxInstruction_c *i, bx_address dstOff, Bit16u port,
   return 0;
 }
 
-Bit32u BX_CPU_C::FastRepOUTSW(bxInstruction_c *i, unsigned srcSeg, bx_address srcOff, Bit16u port, Bit32u wordCount)
+Bit32u BX_CPU_C::FastRepOUTS(bxInstruction_c *i, unsigned srcSeg, bx_address srcOff, Bit16u port, unsigned len, Bit32u count)
 {
-  Bit32u wordsFitSrc;
-  signed int pointerDelta;
+  Bit32u elemsFitSrc;
   Bit8u *hostAddrSrc;
-  unsigned count;
-
-  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
 
-  bx_segment_reg_t *srcSegPtr = &BX_CPU_THIS_PTR sregs[srcSeg];
-  if (!(srcSegPtr->cache.valid & SegAccessROK))
-    return 0;
-  if ((srcOff | 0xfff) > srcSegPtr->cache.u.segment.limit_scaled)
-    return 0;
+#if BX_SUPPORT_X86_64
+  if (BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64)
+#endif
+  {
+    bx_segment_reg_t *srcSegPtr = &BX_CPU_THIS_PTR sregs[srcSeg];
+    if (!(srcSegPtr->cache.valid & SegAccessROK))
+      return 0;
+    if ((srcOff | 0xfff) > srcSegPtr->cache.u.segment.limit_scaled)
+      return 0;
+  }
 
   bx_address laddrSrc = BX_CPU_THIS_PTR get_laddr(srcSeg, srcOff);
-  // check that the address is word aligned
-  if (laddrSrc & 1) return 0;
+  // check that the address is aligned to the element size, so no
+  // element could cross the page boundary
+  if (laddrSrc & (len-1)) return 0;
+#if BX_SUPPORT_X86_64
+  if (! IsCanonical(laddrSrc)) return 0;
+#endif
 
   hostAddrSrc = v2h_read_byte(laddrSrc, BX_CPU_THIS_PTR user_pl);
-
   // Check that native host access was not vetoed for that page
   if (!hostAddrSrc) return 0;
 
-  // See how many words can fit in the rest of this page.
+  // See how many elements can fit in the rest of this page.
   if (BX_CPU_THIS_PTR get_DF()) {
     // Counting downward
-    // 1st word must cannot cross page boundary because it is word aligned
-    wordsFitSrc = (2 + (PAGE_OFFSET(laddrSrc))) >> 1;
-    pointerDelta = (unsigned) -2;
+    elemsFitSrc = (len + PAGE_OFFSET(laddrSrc)) / len;
   }
   else {
     // Counting upward
-    wordsFitSrc = (0x1000 - PAGE_OFFSET(laddrSrc)) >> 1;
-    pointerDelta =  2;
+    elemsFitSrc = (0x1000 - PAGE_OFFSET(laddrSrc)) / len;
   }
 
-  // Restrict word count to the number that will fit in this page.
-  if (wordCount > wordsFitSrc)
-      wordCount = wordsFitSrc;
+  // Restrict element count to the number that will fit in this page.
+  if (count > elemsFitSrc)
+    count = elemsFitSrc;
+  count = FastRepOffsetLimit(i, srcOff, len, BX_CPU_THIS_PTR get_DF(), count);
+  if (count > bx_pc_system.getNumCpuTicksLeftNextEvent())
+    count = bx_pc_system.getNumCpuTicksLeftNextEvent();
 
   // If after all the restrictions, there is anything left to do...
-  if (wordCount) {
-    for (count=0; count<wordCount; ) {
-      bx_devices.bulkIOQuantumsTransferred = 0;
-      if (BX_CPU_THIS_PTR get_DF()==0) { // Only do accel for DF=0
-        bx_devices.bulkIOHostAddr = hostAddrSrc;
-        bx_devices.bulkIOQuantumsRequested = (wordCount - count);
-      }
-      else
-        bx_devices.bulkIOQuantumsRequested = 0;
-      Bit16u temp16;
-      ReadHostWordFromLittleEndian(hostAddrSrc, temp16);
-      BX_OUTP(port, temp16, 2);
-      if (bx_devices.bulkIOQuantumsTransferred) {
-        hostAddrSrc = bx_devices.bulkIOHostAddr;
-        count += bx_devices.bulkIOQuantumsTransferred;
-      }
-      else {
-        hostAddrSrc += pointerDelta;
-        count++;
-      }
-      // Terminate early if there was an event.
-      if (BX_CPU_THIS_PTR async_event) break;
+  if (count) {
+    if (BX_CPU_THIS_PTR get_DF()) {
+      // The device consumes elements in ascending order, gather them backwards
+      Bit8u buffer[0x1000];
+      for (unsigned n=0; n<count; n++)
+        memcpy(buffer + n*len, hostAddrSrc - n*len, len);
+      count = BX_BULK_OUTP(port, buffer, len, count);
+    }
+    else {
+      count = BX_BULK_OUTP(port, hostAddrSrc, len, count);
     }
-
-    // Reset for next non-bulk IO
-    bx_devices.bulkIOQuantumsRequested = 0;
 
     return count;
   }
@@ -219,6 +222,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::REP_INSB_YbDX(bxInstruction_c *i)
 // 16-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSB16_YbDX(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u byteCount = FastRepINS(i, DI, DX, 1, CX);
+    if (byteCount) {
+      // Decrement the ticks count and CX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(byteCount-1);
+      CX -= (byteCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        DI -= byteCount;
+      else
+        DI += byteCount;
+      return;
+    }
+  }
+#endif
+
   // trigger any segment or page faults before reading from IO port
   Bit8u value8 = read_RMW_virtual_byte_32(BX_SEG_REG_ES, DI);
 
@@ -235,6 +258,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSB16_YbDX(bxInstruction_c *i)
 // 32-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSB32_YbDX(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u byteCount = FastRepINS(i, EDI, DX, 1, ECX);
+    if (byteCount) {
+      // Decrement the ticks count and ECX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(byteCount-1);
+      RCX = ECX - (byteCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        RDI = EDI - byteCount;
+      else
+        RDI = EDI + byteCount;
+      return;
+    }
+  }
+#endif
+
   // trigger any segment or page faults before reading from IO port
   Bit8u value8 = read_RMW_virtual_byte(BX_SEG_REG_ES, EDI);
 
@@ -256,6 +299,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSB32_YbDX(bxInstruction_c *i)
 // 64-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSB64_YbDX(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u byteCount = FastRepINS(i, RDI, DX, 1, (RCX > 0x1000) ? 0x1000 : (Bit32u) RCX);
+    if (byteCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(byteCount-1);
+      RCX -= (byteCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        RDI -= byteCount;
+      else
+        RDI += byteCount;
+      return;
+    }
+  }
+#endif
+
   // trigger any segment or page faults before reading from IO port
   Bit8u value8 = read_RMW_virtual_byte_64(BX_SEG_REG_ES, RDI);
 
@@ -296,6 +359,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::REP_INSW_YwDX(bxInstruction_c *i)
 // 16-bit operand size, 16-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSW16_YwDX(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u wordCount = FastRepINS(i, DI, DX, 2, CX);
+    if (wordCount) {
+      // Decrement the ticks count and CX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(wordCount-1);
+      CX -= (wordCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        DI -= wordCount << 1;
+      else
+        DI += wordCount << 1;
+      return;
+    }
+  }
+#endif
+
   // trigger any segment or page faults before reading from IO port
   Bit16u value16 = read_RMW_virtual_word_32(BX_SEG_REG_ES, DI);
 
@@ -312,52 +395,37 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSW16_YwDX(bxInstruction_c *i)
 // 16-bit operand size, 32-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSW32_YwDX(bxInstruction_c *i)
 {
-  Bit16u value16=0;
-  Bit32u edi = EDI;
-  unsigned incr = 2;
-
 #if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
   /* If conditions are right, we can transfer IO to physical memory
    * in a batch, rather than one instruction at a time.
    */
-  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
-  {
-    Bit32u wordCount = ECX;
-    BX_ASSERT(wordCount > 0);
-    wordCount = FastRepINSW(i, edi, DX, wordCount);
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u wordCount = FastRepINS(i, EDI, DX, 2, ECX);
     if (wordCount) {
-      // Decrement the ticks count by the number of iterations, minus
-      // one, since the main cpu loop will decrement one.  Also,
-      // the count is predecremented before examined, so defintely
-      // don't roll it under zero.
+      // Decrement the ticks count and ECX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
       BX_TICKN(wordCount-1);
       RCX = ECX - (wordCount-1);
-      incr = wordCount << 1; // count * 2.
-    }
-    else {
-      // trigger any segment or page faults before reading from IO port
-      value16 = read_RMW_virtual_word(BX_SEG_REG_ES, edi);
-
-      value16 = BX_INP(DX, 2);
-
-      write_RMW_virtual_word(value16);
+      if (BX_CPU_THIS_PTR get_DF())
+        RDI = EDI - (wordCount << 1);
+      else
+        RDI = EDI + (wordCount << 1);
+      return;
     }
   }
-  else
 #endif
-  {
-    // trigger any segment or page faults before reading from IO port
-    value16 = read_RMW_virtual_word_32(BX_SEG_REG_ES, edi);
 
-    value16 = BX_INP(DX, 2);
+  // trigger any segment or page faults before reading from IO port
+  Bit16u value16 = read_RMW_virtual_word(BX_SEG_REG_ES, EDI);
 
-    write_RMW_virtual_word(value16);
-  }
+  value16 = BX_INP(DX, 2);
+
+  write_RMW_virtual_word(value16);
 
   if (BX_CPU_THIS_PTR get_DF())
-    RDI = EDI - incr;
+    RDI = EDI - 2;
   else
-    RDI = EDI + incr;
+    RDI = EDI + 2;
 }
 
 #if BX_SUPPORT_X86_64
@@ -365,6 +433,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSW32_YwDX(bxInstruction_c *i)
 // 16-bit operand size, 64-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSW64_YwDX(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u wordCount = FastRepINS(i, RDI, DX, 2, (RCX > 0x1000) ? 0x1000 : (Bit32u) RCX);
+    if (wordCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(wordCount-1);
+      RCX -= (wordCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        RDI -= (wordCount << 1);
+      else
+        RDI += (wordCount << 1);
+      return;
+    }
+  }
+#endif
+
   // trigger any segment or page faults before reading from IO port
   Bit16u value16 = read_RMW_virtual_word_64(BX_SEG_REG_ES, RDI);
 
@@ -405,6 +493,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::REP_INSD_YdDX(bxInstruction_c *i)
 // 32-bit operand size, 16-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSD16_YdDX(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u dwordCount = FastRepINS(i, DI, DX, 4, CX);
+    if (dwordCount) {
+      // Decrement the ticks count and CX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(dwordCount-1);
+      CX -= (dwordCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        DI -= dwordCount << 2;
+      else
+        DI += dwordCount << 2;
+      return;
+    }
+  }
+#endif
+
   // trigger any segment or page faults before reading from IO port
   Bit32u value32 = read_RMW_virtual_dword_32(BX_SEG_REG_ES, DI);
 
@@ -421,6 +529,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSD16_YdDX(bxInstruction_c *i)
 // 32-bit operand size, 32-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSD32_YdDX(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u dwordCount = FastRepINS(i, EDI, DX, 4, ECX);
+    if (dwordCount) {
+      // Decrement the ticks count and ECX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(dwordCount-1);
+      RCX = ECX - (dwordCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        RDI = EDI - (dwordCount << 2);
+      else
+        RDI = EDI + (dwordCount << 2);
+      return;
+    }
+  }
+#endif
+
   // trigger any segment or page faults before reading from IO port
   Bit32u value32 = read_RMW_virtual_dword(BX_SEG_REG_ES, EDI);
 
@@ -439,6 +567,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSD32_YdDX(bxInstruction_c *i)
 // 32-bit operand size, 64-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSD64_YdDX(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u dwordCount = FastRepINS(i, RDI, DX, 4, (RCX > 0x1000) ? 0x1000 : (Bit32u) RCX);
+    if (dwordCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(dwordCount-1);
+      RCX -= (dwordCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        RDI -= (dwordCount << 2);
+      else
+        RDI += (dwordCount << 2);
+      return;
+    }
+  }
+#endif
+
   // trigger any segment or page faults before reading from IO port
   Bit32u value32 = read_RMW_virtual_dword_64(BX_SEG_REG_ES, RDI);
 
@@ -483,6 +631,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::REP_OUTSB_DXXb(bxInstruction_c *i)
 // 16-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSB16_DXXb(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer physical memory to IO
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u byteCount = FastRepOUTS(i, i->seg(), SI, DX, 1, CX);
+    if (byteCount) {
+      // Decrement the ticks count and CX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(byteCount-1);
+      CX -= (byteCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        SI -= byteCount;
+      else
+        SI += byteCount;
+      return;
+    }
+  }
+#endif
+
   Bit8u value8 = read_virtual_byte_32(i->seg(), SI);
   BX_OUTP(DX, value8, 1);
 
@@ -495,6 +663,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSB16_DXXb(bxInstruction_c *i)
 // 32-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSB32_DXXb(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer physical memory to IO
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u byteCount = FastRepOUTS(i, i->seg(), ESI, DX, 1, ECX);
+    if (byteCount) {
+      // Decrement the ticks count and ECX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(byteCount-1);
+      RCX = ECX - (byteCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        RSI = ESI - byteCount;
+      else
+        RSI = ESI + byteCount;
+      return;
+    }
+  }
+#endif
+
   Bit8u value8 = read_virtual_byte(i->seg(), ESI);
   BX_OUTP(DX, value8, 1);
 
@@ -509,6 +697,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSB32_DXXb(bxInstruction_c *i)
 // 64-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSB64_DXXb(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer physical memory to IO
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u byteCount = FastRepOUTS(i, i->seg(), RSI, DX, 1, (RCX > 0x1000) ? 0x1000 : (Bit32u) RCX);
+    if (byteCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(byteCount-1);
+      RCX -= (byteCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        RSI -= byteCount;
+      else
+        RSI += byteCount;
+      return;
+    }
+  }
+#endif
+
   Bit8u value8 = read_virtual_byte_64(i->seg(), RSI);
   BX_OUTP(DX, value8, 1);
 
@@ -545,6 +753,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::REP_OUTSW_DXXw(bxInstruction_c *i)
 // 16-bit operand size, 16-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSW16_DXXw(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer physical memory to IO
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u wordCount = FastRepOUTS(i, i->seg(), SI, DX, 2, CX);
+    if (wordCount) {
+      // Decrement the ticks count and CX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(wordCount-1);
+      CX -= (wordCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        SI -= wordCount << 1;
+      else
+        SI += wordCount << 1;
+      return;
+    }
+  }
+#endif
+
   Bit16u value16 = read_virtual_word_32(i->seg(), SI);
   BX_OUTP(DX, value16, 2);
 
@@ -557,40 +785,33 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSW16_DXXw(bxInstruction_c *i)
 // 16-bit operand size, 32-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSW32_DXXw(bxInstruction_c *i)
 {
-  Bit16u value16;
-  Bit32u esi = ESI;
-  unsigned incr = 2;
-
 #if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
-  /* If conditions are right, we can transfer IO to physical memory
+  /* If conditions are right, we can transfer physical memory to IO
    * in a batch, rather than one instruction at a time.
    */
   if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
-    Bit32u wordCount = ECX;
-    wordCount = FastRepOUTSW(i, i->seg(), esi, DX, wordCount);
+    Bit32u wordCount = FastRepOUTS(i, i->seg(), ESI, DX, 2, ECX);
     if (wordCount) {
-      // Decrement eCX.  Note, the main loop will decrement 1 also, so
-      // decrement by one less than expected, like the case above.
-      BX_TICKN(wordCount-1); // Main cpu loop also decrements one more.
+      // Decrement the ticks count and ECX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(wordCount-1);
       RCX = ECX - (wordCount-1);
-      incr = wordCount << 1; // count * 2.
-    }
-    else {
-      value16 = read_virtual_word(i->seg(), esi);
-      BX_OUTP(DX, value16, 2);
+      if (BX_CPU_THIS_PTR get_DF())
+        RSI = ESI - (wordCount << 1);
+      else
+        RSI = ESI + (wordCount << 1);
+      return;
     }
   }
-  else
 #endif
-  {
-    value16 = read_virtual_word(i->seg(), esi);
-    BX_OUTP(DX, value16, 2);
-  }
+
+  Bit16u value16 = read_virtual_word(i->seg(), ESI);
+  BX_OUTP(DX, value16, 2);
 
   if (BX_CPU_THIS_PTR get_DF())
-    RSI = ESI - incr;
+    RSI = ESI - 2;
   else
-    RSI = ESI + incr;
+    RSI = ESI + 2;
 }
 
 #if BX_SUPPORT_X86_64
@@ -598,6 +819,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSW32_DXXw(bxInstruction_c *i)
 // 16-bit operand size, 64-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSW64_DXXw(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer physical memory to IO
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u wordCount = FastRepOUTS(i, i->seg(), RSI, DX, 2, (RCX > 0x1000) ? 0x1000 : (Bit32u) RCX);
+    if (wordCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(wordCount-1);
+      RCX -= (wordCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        RSI -= (wordCount << 1);
+      else
+        RSI += (wordCount << 1);
+      return;
+    }
+  }
+#endif
+
   Bit16u value16 = read_virtual_word_64(i->seg(), RSI);
   BX_OUTP(DX, value16, 2);
 
@@ -634,6 +875,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::REP_OUTSD_DXXd(bxInstruction_c *i)
 // 32-bit operand size, 16-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSD16_DXXd(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer physical memory to IO
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u dwordCount = FastRepOUTS(i, i->seg(), SI, DX, 4, CX);
+    if (dwordCount) {
+      // Decrement the ticks count and CX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(dwordCount-1);
+      CX -= (dwordCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        SI -= dwordCount << 2;
+      else
+        SI += dwordCount << 2;
+      return;
+    }
+  }
+#endif
+
   Bit32u value32 = read_virtual_dword_32(i->seg(), SI);
   BX_OUTP(DX, value32, 4);
 
@@ -646,6 +907,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSD16_DXXd(bxInstruction_c *i)
 // 32-bit operand size, 32-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSD32_DXXd(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer physical memory to IO
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u dwordCount = FastRepOUTS(i, i->seg(), ESI, DX, 4, ECX);
+    if (dwordCount) {
+      // Decrement the ticks count and ECX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(dwordCount-1);
+      RCX = ECX - (dwordCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        RSI = ESI - (dwordCount << 2);
+      else
+        RSI = ESI + (dwordCount << 2);
+      return;
+    }
+  }
+#endif
+
   Bit32u value32 = read_virtual_dword(i->seg(), ESI);
   BX_OUTP(DX, value32, 4);
 
@@ -660,6 +941,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSD32_DXXd(bxInstruction_c *i)
 // 32-bit operand size, 64-bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::OUTSD64_DXXd(bxInstruction_c *i)
 {
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer physical memory to IO
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event) {
+    Bit32u dwordCount = FastRepOUTS(i, i->seg(), RSI, DX, 4, (RCX > 0x1000) ? 0x1000 : (Bit32u) RCX);
+    if (dwordCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the repeat loop will decrement one more.
+      BX_TICKN(dwordCount-1);
+      RCX -= (dwordCount-1);
+      if (BX_CPU_THIS_PTR get_DF())
+        RSI -= (dwordCount << 2);
+      else
+        RSI += (dwordCount << 2);
+      return;
+    }
+  }
+#endif
+
   Bit32u value32 = read_virtual_dword_64(i->seg(), RSI);
   BX_OUTP(DX, value32, 4);
 
@@ -28,21 +28,21 @@
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LOAD_Eb(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   TMP8L = read_virtual_byte(i->seg(), eaddr);
   BX_CPU_CALL_METHOD(i->execute2, (i));
 }
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LOAD_Ew(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   TMP16 = read_virtual_word(i->seg(), eaddr);
   BX_CPU_CALL_METHOD(i->execute2, (i));
 }
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LOAD_Ed(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   TMP32 = read_virtual_dword(i->seg(), eaddr);
   BX_CPU_CALL_METHOD(i->execute2, (i));
 }
@@ -50,7 +50,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LOAD_Ed(bxInstruction_c *i)
 #if BX_SUPPORT_X86_64
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LOAD_Eq(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   TMP64 = read_virtual_qword_64(i->seg(), eaddr);
   BX_CPU_CALL_METHOD(i->execute2, (i));
 }
@@ -33,7 +33,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::XOR_EdGdM(bxInstruction_c *i)
 {
   Bit32u op1_32, op2_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op2_32 = BX_READ_32BIT_REG(i->nnn());
@@ -70,7 +70,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::XOR_EdIdM(bxInstruction_c *i)
 {
   Bit32u op1_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op1_32 ^= i->Id();
@@ -92,7 +92,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::OR_EdIdM(bxInstruction_c *i)
 {
   Bit32u op1_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op1_32 |= i->Id();
@@ -114,7 +114,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::NOT_EdM(bxInstruction_c *i)
 {
   Bit32u op1_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op1_32 = ~op1_32;
@@ -132,7 +132,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::OR_EdGdM(bxInstruction_c *i)
 {
   Bit32u op1_32, op2_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op2_32 = BX_READ_32BIT_REG(i->nnn());
@@ -170,7 +170,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::AND_EdGdM(bxInstruction_c *i)
 {
   Bit32u op1_32, op2_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op2_32 = BX_READ_32BIT_REG(i->nnn());
@@ -208,7 +208,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::AND_EdIdM(bxInstruction_c *i)
 {
   Bit32u op1_32;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_32 = read_RMW_virtual_dword(i->seg(), eaddr);
   op1_32 &= i->Id();
@@ -254,3 +254,25 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::TEST_EdIdR(bxInstruction_c *i)
   op1_32 &= i->Id();
   SET_FLAGS_OSZAPC_LOGIC_32(op1_32);
 }
+
+#if BX_SUPPORT_FUSED_PAIRS
+// fused with the load of its source operand before it, see fuseTrace()
+BX_FUSED_ALU_HANDLER(AND_GdEdR)
+BX_FUSED_ALU_HANDLER(OR_GdEdR)
+BX_FUSED_ALU_HANDLER(XOR_GdEdR)
+BX_FUSED_ALU_HANDLER(TEST_EdGdR)
+
+// without the flags the instruction after it overwrites, see fuseTrace()
+BX_DEAD_FLAGS_HANDLER(AND_GdEdR, BX_WRITE_32BIT_REGZ(i->nnn(), BX_READ_32BIT_REG(i->nnn()) & BX_READ_32BIT_REG(i->rm())))
+BX_DEAD_FLAGS_HANDLER(AND_EdIdR, BX_WRITE_32BIT_REGZ(i->rm(), BX_READ_32BIT_REG(i->rm()) & i->Id()))
+BX_DEAD_FLAGS_HANDLER(AND_EAXId, RAX = EAX & i->Id())
+BX_DEAD_FLAGS_HANDLER(OR_GdEdR, BX_WRITE_32BIT_REGZ(i->nnn(), BX_READ_32BIT_REG(i->nnn()) | BX_READ_32BIT_REG(i->rm())))
+BX_DEAD_FLAGS_HANDLER(OR_EdIdR, BX_WRITE_32BIT_REGZ(i->rm(), BX_READ_32BIT_REG(i->rm()) | i->Id()))
+BX_DEAD_FLAGS_HANDLER(OR_EAXId, RAX = EAX | i->Id())
+BX_DEAD_FLAGS_HANDLER(XOR_GdEdR, BX_WRITE_32BIT_REGZ(i->nnn(), BX_READ_32BIT_REG(i->nnn()) ^ BX_READ_32BIT_REG(i->rm())))
+BX_DEAD_FLAGS_HANDLER(XOR_EdIdR, BX_WRITE_32BIT_REGZ(i->rm(), BX_READ_32BIT_REG(i->rm()) ^ i->Id()))
+BX_DEAD_FLAGS_HANDLER(XOR_EAXId, RAX = EAX ^ i->Id())
+BX_DEAD_FLAGS_HANDLER(TEST_EdGdR, {})
+BX_DEAD_FLAGS_HANDLER(TEST_EdIdR, {})
+BX_DEAD_FLAGS_HANDLER(TEST_EAXId, {})
+#endif
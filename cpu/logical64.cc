@@ -30,7 +30,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::XOR_EqGqM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
   op2_64 = BX_READ_64BIT_REG(i->nnn());
@@ -71,7 +71,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::XOR_EqIdM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64 = (Bit32s) i->Id();
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
   op1_64 ^= op2_64;
@@ -95,7 +95,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::OR_EqIdM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64 = (Bit32s) i->Id();
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
   op1_64 |= op2_64;
@@ -119,7 +119,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::NOT_EqM(bxInstruction_c *i)
 {
   Bit64u op1_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
   op1_64 = ~op1_64;
@@ -137,7 +137,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::OR_EqGqM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
   op2_64 = BX_READ_64BIT_REG(i->nnn());
@@ -178,7 +178,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::AND_EqGqM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
   op2_64 = BX_READ_64BIT_REG(i->nnn());
@@ -218,7 +218,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::AND_EqIdM(bxInstruction_c *i)
 {
   Bit64u op1_64, op2_64 = (Bit32s) i->Id();
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   op1_64 = read_RMW_virtual_qword_64(i->seg(), eaddr);
   op1_64 &= op2_64;
@@ -271,4 +271,26 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::TEST_EqIdR(bxInstruction_c *i)
   SET_FLAGS_OSZAPC_LOGIC_64(op1_64);
 }
 
+#if BX_SUPPORT_FUSED_PAIRS
+// fused with the load of its source operand before it, see fuseTrace()
+BX_FUSED_ALU_HANDLER(AND_GqEqR)
+BX_FUSED_ALU_HANDLER(OR_GqEqR)
+BX_FUSED_ALU_HANDLER(XOR_GqEqR)
+BX_FUSED_ALU_HANDLER(TEST_EqGqR)
+
+// without the flags the instruction after it overwrites, see fuseTrace()
+BX_DEAD_FLAGS_HANDLER(AND_GqEqR, BX_WRITE_64BIT_REG(i->nnn(), BX_READ_64BIT_REG(i->nnn()) & BX_READ_64BIT_REG(i->rm())))
+BX_DEAD_FLAGS_HANDLER(AND_EqIdR, BX_WRITE_64BIT_REG(i->rm(), BX_READ_64BIT_REG(i->rm()) & (Bit32s) i->Id()))
+BX_DEAD_FLAGS_HANDLER(AND_RAXId, RAX &= (Bit32s) i->Id())
+BX_DEAD_FLAGS_HANDLER(OR_GqEqR, BX_WRITE_64BIT_REG(i->nnn(), BX_READ_64BIT_REG(i->nnn()) | BX_READ_64BIT_REG(i->rm())))
+BX_DEAD_FLAGS_HANDLER(OR_EqIdR, BX_WRITE_64BIT_REG(i->rm(), BX_READ_64BIT_REG(i->rm()) | (Bit32s) i->Id()))
+BX_DEAD_FLAGS_HANDLER(OR_RAXId, RAX |= (Bit32s) i->Id())
+BX_DEAD_FLAGS_HANDLER(XOR_GqEqR, BX_WRITE_64BIT_REG(i->nnn(), BX_READ_64BIT_REG(i->nnn()) ^ BX_READ_64BIT_REG(i->rm())))
+BX_DEAD_FLAGS_HANDLER(XOR_EqIdR, BX_WRITE_64BIT_REG(i->rm(), BX_READ_64BIT_REG(i->rm()) ^ (Bit32s) i->Id()))
+BX_DEAD_FLAGS_HANDLER(XOR_RAXId, RAX ^= (Bit32s) i->Id())
+BX_DEAD_FLAGS_HANDLER(TEST_EqGqR, {})
+BX_DEAD_FLAGS_HANDLER(TEST_EqIdR, {})
+BX_DEAD_FLAGS_HANDLER(TEST_RAXId, {})
+#endif
+
 #endif /* if BX_SUPPORT_X86_64 */
@@ -224,12 +224,6 @@
 // - Processor running at CPL=0,1,2 maps to U/S=0
 //   Processor running at CPL=3     maps to U/S=1
 
-#if BX_SUPPORT_X86_64
-  #define BX_INVALID_TLB_ENTRY BX_CONST64(0xffffffffffffffff)
-#else
-  #define BX_INVALID_TLB_ENTRY 0xffffffff
-#endif
-
 // bit [11] of the TLB lpf used for TLB_HostPtr valid indication
 #define TLB_LPFOf(laddr) AlignedAccessLPFOf(laddr, 0x7ff)
 
@@ -379,6 +373,8 @@ void BX_CPU_C::TLB_flush(void)
     BX_CPU_THIS_PTR TLB.entry[n].lpf = BX_INVALID_TLB_ENTRY;
   }
 
+  invalidate_data_pages();
+
 #if BX_CPU_LEVEL >= 5
   BX_CPU_THIS_PTR TLB.split_large = 0;  // flush whole TLB
 #endif
@@ -412,6 +408,8 @@ void BX_CPU_C::TLB_flushNonGlobal(void)
     }
   }
 
+  invalidate_data_pages();
+
 #if BX_SUPPORT_MONITOR_MWAIT
   // invalidating of the TLB might change translation for monitored page
   // and cause subsequent MWAIT instruction to wait forever
@@ -426,6 +424,8 @@ void BX_CPU_C::TLB_invlpg(bx_address laddr)
 
   BX_DEBUG(("TLB_invlpg(0x"FMT_ADDRX"): invalidate TLB entry", laddr));
 
+  invalidate_data_pages();
+
 #if BX_CPU_LEVEL >= 5
   bx_bool large = 0;
 
@@ -469,7 +469,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INVLPG(bxInstruction_c* i)
     exception(BX_GP_EXCEPTION, 0);
   }
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   bx_address laddr = get_laddr(i->seg(), eaddr);
 
 #if BX_SUPPORT_VMX
@@ -983,9 +983,12 @@ bx_phy_address BX_CPU_C::translate_linear(bx_address laddr, unsigned curr_pl, un
     // generate an exception if one is warranted.
   }
 
+  BX_CPU_THIS_PTR stats.tlb_misses++;
+
   if(BX_CPU_THIS_PTR cr0.get_PG())
   {
     InstrTLB_Increment(tlbMisses);
+    BX_CPU_THIS_PTR stats.page_walks++;
 
     BX_DEBUG(("page walk for address 0x" FMT_LIN_ADDRX, laddr));
 
@@ -1174,6 +1177,10 @@ bx_phy_address BX_CPU_C::translate_linear(bx_address laddr, unsigned curr_pl, un
     // All access allowed also via direct pointer
 #if BX_X86_DEBUGGER
     if (! hwbreakpoint_check(laddr))
+#endif
+#if BX_DEBUGGER
+    // keep accesses to watched pages on the slow path
+    if (! bx_dbg_watched_page(ppf))
 #endif
        tlbEntry->lpf = lpf; // allow direct access with HostPtr
   }
@@ -50,12 +50,15 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PAUSE(bxInstruction_c *i)
 #if BX_SUPPORT_VMX
   VMexit_PAUSE(i);
 #endif
+
+  if (BX_CPU_THIS_PTR idle_skip)
+    checkPauseSpin();
 }
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::PREFETCH(bxInstruction_c *i)
 {
 #if BX_INSTRUMENTATION
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   BX_INSTR_PREFETCH_HINT(BX_CPU_ID, i->nnn(), i->seg(), eaddr);
 #endif
 }
@@ -194,7 +197,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CLFLUSH(bxInstruction_c *i)
 {
   bx_segment_reg_t *seg = &BX_CPU_THIS_PTR sregs[i->seg()];
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   bx_address laddr = BX_CPU_THIS_PTR get_laddr(i->seg(), eaddr);
 
 #if BX_SUPPORT_X86_64
@@ -30,7 +30,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LES_GwMp(bxInstruction_c *i)
 {
   BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
 
-  Bit32u eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  Bit32u eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u reg_16 = read_virtual_word_32(i->seg(), eaddr);
   Bit16u es     = read_virtual_word_32(i->seg(), eaddr + 2);
@@ -45,7 +45,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LES_GdMp(bxInstruction_c *i)
 {
   BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
 
-  Bit32u eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  Bit32u eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u es = read_virtual_word_32(i->seg(), eaddr + 4);
   Bit32u reg_32 = read_virtual_dword_32(i->seg(), eaddr);
@@ -60,7 +60,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LDS_GwMp(bxInstruction_c *i)
 {
   BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
 
-  Bit32u eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  Bit32u eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u reg_16 = read_virtual_word_32(i->seg(), eaddr);
   Bit16u ds     = read_virtual_word_32(i->seg(), eaddr + 2);
@@ -75,7 +75,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LDS_GdMp(bxInstruction_c *i)
 {
   BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
 
-  Bit32u eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  Bit32u eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u ds = read_virtual_word_32(i->seg(), eaddr + 4);
   Bit32u reg_32 = read_virtual_dword_32(i->seg(), eaddr);
@@ -87,7 +87,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LDS_GdMp(bxInstruction_c *i)
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LFS_GwMp(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u reg_16 = read_virtual_word(i->seg(), eaddr);
   Bit16u fs     = read_virtual_word(i->seg(), eaddr + 2);
@@ -99,7 +99,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LFS_GwMp(bxInstruction_c *i)
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LFS_GdMp(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u fs = read_virtual_word(i->seg(), eaddr + 4);
   Bit32u reg_32 = read_virtual_dword(i->seg(), eaddr);
@@ -112,7 +112,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LFS_GdMp(bxInstruction_c *i)
 #if BX_SUPPORT_X86_64
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LFS_GqMp(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u fs = read_virtual_word_64(i->seg(), eaddr + 8);
   Bit64u reg_64 = read_virtual_qword_64(i->seg(), eaddr);
@@ -125,7 +125,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LFS_GqMp(bxInstruction_c *i)
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LGS_GwMp(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u reg_16 = read_virtual_word(i->seg(), eaddr);
   Bit16u gs     = read_virtual_word(i->seg(), eaddr + 2);
@@ -137,7 +137,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LGS_GwMp(bxInstruction_c *i)
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LGS_GdMp(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u gs = read_virtual_word(i->seg(), eaddr + 4);
   Bit32u reg_32 = read_virtual_dword(i->seg(), eaddr);
@@ -150,7 +150,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LGS_GdMp(bxInstruction_c *i)
 #if BX_SUPPORT_X86_64
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LGS_GqMp(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u gs = read_virtual_word_64(i->seg(), eaddr + 8);
   Bit64u reg_64 = read_virtual_qword_64(i->seg(), eaddr);
@@ -163,7 +163,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LGS_GqMp(bxInstruction_c *i)
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LSS_GwMp(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u reg_16 = read_virtual_word(i->seg(), eaddr);
   Bit16u ss     = read_virtual_word(i->seg(), eaddr + 2);
@@ -175,7 +175,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LSS_GwMp(bxInstruction_c *i)
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LSS_GdMp(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u ss = read_virtual_word(i->seg(), eaddr + 4);
   Bit32u reg_32 = read_virtual_dword(i->seg(), eaddr);
@@ -188,7 +188,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LSS_GdMp(bxInstruction_c *i)
 #if BX_SUPPORT_X86_64
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::LSS_GqMp(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit16u ss = read_virtual_word_64(i->seg(), eaddr + 8);
   Bit64u reg_64 = read_virtual_qword_64(i->seg(), eaddr);
@@ -0,0 +1,140 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//   Copyright (c) 2010 The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef BX_SIMD_HOST_H
+#define BX_SIMD_HOST_H
+
+// SSE/MMX instructions executed by the matching host instruction, see
+// BX_SUPPORT_HOST_SSE2 in config.h. The handlers keep their portable code
+// for the other hosts.
+
+#if BX_SUPPORT_HOST_SSE2
+
+#include <emmintrin.h>
+#if BX_SUPPORT_HOST_SSSE3
+#include <tmmintrin.h>
+#endif
+#if BX_SUPPORT_HOST_SSE4_1
+#include <smmintrin.h>
+#endif
+#if BX_SUPPORT_HOST_SSE4_2
+#include <nmmintrin.h>
+#endif
+
+// XMM register to/from host register
+#define HOST_XMM(reg)            _mm_loadu_si128((const __m128i*) &(reg))
+#define HOST_XMM_STORE(reg, val) _mm_storeu_si128((__m128i*) &(reg), (val))
+
+// MMX register to/from the low half of a host register
+#define HOST_MMX(reg)            _mm_loadl_epi64((const __m128i*) &(reg))
+#define HOST_MMX_STORE(reg, val) _mm_storel_epi64((__m128i*) &(reg), (val))
+
+// dst = op(src1, src2)
+#define HOST_XMM_OP(dst, src1, src2, op) \
+  HOST_XMM_STORE(dst, op(HOST_XMM(src1), HOST_XMM(src2)))
+#define HOST_MMX_OP(dst, src1, src2, op) \
+  HOST_MMX_STORE(dst, op(HOST_MMX(src1), HOST_MMX(src2)))
+
+// dst = op(src), used by the shifts by an immediate count
+#define HOST_XMM_SHIFT_IMM(dst, src, count, op) \
+  HOST_XMM_STORE(dst, op(HOST_XMM(src), _mm_cvtsi32_si128(count)))
+#define HOST_MMX_SHIFT_IMM(dst, src, count, op) \
+  HOST_MMX_STORE(dst, op(HOST_MMX(src), _mm_cvtsi32_si128(count)))
+
+// Floating point SSE instructions: the host computes the same results and
+// exception flags as softfloat as long as all exceptions are masked and
+// MXCSR is otherwise in its reset state (round to nearest, no DAZ/FTZ), in
+// the guest and in the host. Other cases are left to softfloat.
+BX_CPP_INLINE bx_bool host_fp_begin(Bit32u guest_mxcsr)
+{
+  if ((guest_mxcsr & ~(MXCSR_EXCEPTIONS | MXCSR_MISALIGNED_EXCEPTION_MASK)) != MXCSR_RESET)
+    return 0;
+
+  unsigned host_mxcsr = _mm_getcsr();
+  if ((host_mxcsr & ~MXCSR_EXCEPTIONS) != MXCSR_RESET)
+    return 0;
+  // the host flags are sticky, clear those the guest does not have set
+  // yet (rarely needed, the guest usually has PE set as the host has)
+  if (host_mxcsr & ~guest_mxcsr & MXCSR_EXCEPTIONS)
+    _mm_setcsr(host_mxcsr & guest_mxcsr);
+
+  return 1;
+}
+
+// host exception flags after the instruction, those not set in the guest
+// MXCSR yet were raised by it
+BX_CPP_INLINE unsigned host_fp_end(void)
+{
+  return _mm_getcsr() & MXCSR_EXCEPTIONS;
+}
+
+// keeps the compiler from moving the computation of a value across the
+// MXCSR accesses
+#define HOST_FP_BARRIER(val) __asm__ __volatile__("" : "+x" (val))
+
+#define HOST_PS(reg)   _mm_castsi128_ps(HOST_XMM(reg))
+#define HOST_PD(reg)   _mm_castsi128_pd(HOST_XMM(reg))
+#define HOST_SS(val)   _mm_castsi128_ps(_mm_cvtsi32_si128(val))
+#define HOST_SD(val)   _mm_castsi128_pd(HOST_MMX(val))
+
+// dst = op(src1, src2), packed or in the low element of a register
+#define HOST_PS_OP(dst, src1, src2, op) {                        \
+  __m128 result = op(HOST_PS(src1), HOST_PS(src2));              \
+  HOST_FP_BARRIER(result);                                       \
+  HOST_XMM_STORE(dst, _mm_castps_si128(result));                 \
+}
+#define HOST_PD_OP(dst, src1, src2, op) {                        \
+  __m128d result = op(HOST_PD(src1), HOST_PD(src2));             \
+  HOST_FP_BARRIER(result);                                       \
+  HOST_XMM_STORE(dst, _mm_castpd_si128(result));                 \
+}
+#define HOST_SS_OP(dst, src1, src2, op) {                        \
+  __m128 result = op(HOST_SS(src1), HOST_SS(src2));              \
+  HOST_FP_BARRIER(result);                                       \
+  (dst) = _mm_cvtsi128_si32(_mm_castps_si128(result));           \
+}
+#define HOST_SD_OP(dst, src1, src2, op) {                        \
+  __m128d result = op(HOST_SD(src1), HOST_SD(src2));             \
+  HOST_FP_BARRIER(result);                                       \
+  HOST_MMX_STORE(dst, _mm_castpd_si128(result));                 \
+}
+
+// dst = op(src)
+#define HOST_PS_OP1(dst, src, op) {                              \
+  __m128 result = op(HOST_PS(src));                              \
+  HOST_FP_BARRIER(result);                                       \
+  HOST_XMM_STORE(dst, _mm_castps_si128(result));                 \
+}
+#define HOST_PD_OP1(dst, src, op) {                              \
+  __m128d result = op(HOST_PD(src));                             \
+  HOST_FP_BARRIER(result);                                       \
+  HOST_XMM_STORE(dst, _mm_castpd_si128(result));                 \
+}
+#define HOST_SS_OP1(dst, src, op) {                              \
+  __m128 result = op(HOST_SS(src));                              \
+  HOST_FP_BARRIER(result);                                       \
+  (dst) = _mm_cvtsi128_si32(_mm_castps_si128(result));           \
+}
+
+#endif
+
+#endif
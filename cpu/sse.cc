@@ -24,6 +24,7 @@
 #define NEED_CPU_REG_SHORTCUTS 1
 #include "bochs.h"
 #include "cpu.h"
+#include "simd_host.h"
 #define LOG_THIS BX_CPU_THIS_PTR
 
 /* ********************************************** */
@@ -43,11 +44,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSHUFB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(result, op1, op2, _mm_shuffle_epi8);
+#else
   for(unsigned j=0; j<16; j++)
   {
     unsigned mask = op2.xmmubyte(j);
@@ -56,6 +60,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSHUFB_VdqWdq(bxInstruction_c *i)
     else
       result.xmmubyte(j) = op1.xmmubyte(mask & 0xf);
   }
+#endif
 
   BX_WRITE_XMM_REG(i->nnn(), result);
 #endif
@@ -74,11 +79,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHADDW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(result, op1, op2, _mm_hadd_epi16);
+#else
   result.xmm16u(0) = op1.xmm16u(0) + op1.xmm16u(1);
   result.xmm16u(1) = op1.xmm16u(2) + op1.xmm16u(3);
   result.xmm16u(2) = op1.xmm16u(4) + op1.xmm16u(5);
@@ -88,6 +96,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHADDW_VdqWdq(bxInstruction_c *i)
   result.xmm16u(5) = op2.xmm16u(2) + op2.xmm16u(3);
   result.xmm16u(6) = op2.xmm16u(4) + op2.xmm16u(5);
   result.xmm16u(7) = op2.xmm16u(6) + op2.xmm16u(7);
+#endif
 
   BX_WRITE_XMM_REG(i->nnn(), result);
 #endif
@@ -106,15 +115,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHADDD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(result, op1, op2, _mm_hadd_epi32);
+#else
   result.xmm32u(0) = op1.xmm32u(0) + op1.xmm32u(1);
   result.xmm32u(1) = op1.xmm32u(2) + op1.xmm32u(3);
   result.xmm32u(2) = op2.xmm32u(0) + op2.xmm32u(1);
   result.xmm32u(3) = op2.xmm32u(2) + op2.xmm32u(3);
+#endif
 
   BX_WRITE_XMM_REG(i->nnn(), result);
 #endif
@@ -133,11 +146,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHADDSW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(result, op1, op2, _mm_hadds_epi16);
+#else
   result.xmm16s(0) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(0)) + Bit32s(op1.xmm16s(1)));
   result.xmm16s(1) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(2)) + Bit32s(op1.xmm16s(3)));
   result.xmm16s(2) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(4)) + Bit32s(op1.xmm16s(5)));
@@ -147,6 +163,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHADDSW_VdqWdq(bxInstruction_c *i)
   result.xmm16s(5) = SaturateDwordSToWordS(Bit32s(op2.xmm16s(2)) + Bit32s(op2.xmm16s(3)));
   result.xmm16s(6) = SaturateDwordSToWordS(Bit32s(op2.xmm16s(4)) + Bit32s(op2.xmm16s(5)));
   result.xmm16s(7) = SaturateDwordSToWordS(Bit32s(op2.xmm16s(6)) + Bit32s(op2.xmm16s(7)));
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -166,11 +183,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMADDUBSW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(result, op1, op2, _mm_maddubs_epi16);
+#else
   for(unsigned j=0; j<8; j++)
   {
     Bit32s temp = Bit32s(op1.xmmubyte(j*2+0))*Bit32s(op2.xmmsbyte(j*2+0)) +
@@ -178,6 +198,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMADDUBSW_VdqWdq(bxInstruction_c *i)
 
     result.xmm16s(j) = SaturateDwordSToWordS(temp);
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -197,11 +218,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHSUBSW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(result, op1, op2, _mm_hsubs_epi16);
+#else
   result.xmm16s(0) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(0)) - Bit32s(op1.xmm16s(1)));
   result.xmm16s(1) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(2)) - Bit32s(op1.xmm16s(3)));
   result.xmm16s(2) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(4)) - Bit32s(op1.xmm16s(5)));
@@ -211,6 +235,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHSUBSW_VdqWdq(bxInstruction_c *i)
   result.xmm16s(5) = SaturateDwordSToWordS(Bit32s(op2.xmm16s(2)) - Bit32s(op2.xmm16s(3)));
   result.xmm16s(6) = SaturateDwordSToWordS(Bit32s(op2.xmm16s(4)) - Bit32s(op2.xmm16s(5)));
   result.xmm16s(7) = SaturateDwordSToWordS(Bit32s(op2.xmm16s(6)) - Bit32s(op2.xmm16s(7)));
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -230,11 +255,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHSUBW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(result, op1, op2, _mm_hsub_epi16);
+#else
   result.xmm16u(0) = op1.xmm16u(0) - op1.xmm16u(1);
   result.xmm16u(1) = op1.xmm16u(2) - op1.xmm16u(3);
   result.xmm16u(2) = op1.xmm16u(4) - op1.xmm16u(5);
@@ -244,6 +272,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHSUBW_VdqWdq(bxInstruction_c *i)
   result.xmm16u(5) = op2.xmm16u(2) - op2.xmm16u(3);
   result.xmm16u(6) = op2.xmm16u(4) - op2.xmm16u(5);
   result.xmm16u(7) = op2.xmm16u(6) - op2.xmm16u(7);
+#endif
 
   BX_WRITE_XMM_REG(i->nnn(), result);
 #endif
@@ -262,15 +291,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHSUBD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(result, op1, op2, _mm_hsub_epi32);
+#else
   result.xmm32u(0) = op1.xmm32u(0) - op1.xmm32u(1);
   result.xmm32u(1) = op1.xmm32u(2) - op1.xmm32u(3);
   result.xmm32u(2) = op2.xmm32u(0) - op2.xmm32u(1);
   result.xmm32u(3) = op2.xmm32u(2) - op2.xmm32u(3);
+#endif
 
   BX_WRITE_XMM_REG(i->nnn(), result);
 #endif
@@ -289,15 +322,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSIGNB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(op1, op1, op2, _mm_sign_epi8);
+#else
   for(unsigned j=0; j<16; j++) {
     int sign = (op2.xmmsbyte(j) > 0) - (op2.xmmsbyte(j) < 0);
     op1.xmmsbyte(j) *= sign;
   }
+#endif
 
   BX_WRITE_XMM_REG(i->nnn(), op1);
 #endif
@@ -316,15 +353,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSIGNW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(op1, op1, op2, _mm_sign_epi16);
+#else
   for(unsigned j=0; j<8; j++) {
     int sign = (op2.xmm16s(j) > 0) - (op2.xmm16s(j) < 0);
     op1.xmm16s(j) *= sign;
   }
+#endif
 
   BX_WRITE_XMM_REG(i->nnn(), op1);
 #endif
@@ -343,15 +384,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSIGND_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(op1, op1, op2, _mm_sign_epi32);
+#else
   for(unsigned j=0; j<4; j++) {
     int sign = (op2.xmm32s(j) > 0) - (op2.xmm32s(j) < 0);
     op1.xmm32s(j) *= sign;
   }
+#endif
 
   BX_WRITE_XMM_REG(i->nnn(), op1);
 #endif
@@ -370,11 +415,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULHRSW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_OP(op1, op1, op2, _mm_mulhrs_epi16);
+#else
   op1.xmm16u(0) = (((op1.xmm16s(0) * op2.xmm16s(0)) >> 14) + 1) >> 1;
   op1.xmm16u(1) = (((op1.xmm16s(1) * op2.xmm16s(1)) >> 14) + 1) >> 1;
   op1.xmm16u(2) = (((op1.xmm16s(2) * op2.xmm16s(2)) >> 14) + 1) >> 1;
@@ -383,6 +431,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULHRSW_VdqWdq(bxInstruction_c *i)
   op1.xmm16u(5) = (((op1.xmm16s(5) * op2.xmm16s(5)) >> 14) + 1) >> 1;
   op1.xmm16u(6) = (((op1.xmm16s(6) * op2.xmm16s(6)) >> 14) + 1) >> 1;
   op1.xmm16u(7) = (((op1.xmm16s(7) * op2.xmm16s(7)) >> 14) + 1) >> 1;
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -401,11 +450,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PABSB_VdqWdq(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_STORE(op, _mm_abs_epi8(HOST_XMM(op)));
+#else
   if(op.xmmsbyte(0x0) < 0) op.xmmubyte(0x0) = -op.xmmsbyte(0x0);
   if(op.xmmsbyte(0x1) < 0) op.xmmubyte(0x1) = -op.xmmsbyte(0x1);
   if(op.xmmsbyte(0x2) < 0) op.xmmubyte(0x2) = -op.xmmsbyte(0x2);
@@ -422,6 +474,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PABSB_VdqWdq(bxInstruction_c *i)
   if(op.xmmsbyte(0xd) < 0) op.xmmubyte(0xd) = -op.xmmsbyte(0xd);
   if(op.xmmsbyte(0xe) < 0) op.xmmubyte(0xe) = -op.xmmsbyte(0xe);
   if(op.xmmsbyte(0xf) < 0) op.xmmubyte(0xf) = -op.xmmsbyte(0xf);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op);
@@ -440,11 +493,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PABSW_VdqWdq(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_STORE(op, _mm_abs_epi16(HOST_XMM(op)));
+#else
   if(op.xmm16s(0) < 0) op.xmm16u(0) = -op.xmm16s(0);
   if(op.xmm16s(1) < 0) op.xmm16u(1) = -op.xmm16s(1);
   if(op.xmm16s(2) < 0) op.xmm16u(2) = -op.xmm16s(2);
@@ -453,6 +509,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PABSW_VdqWdq(bxInstruction_c *i)
   if(op.xmm16s(5) < 0) op.xmm16u(5) = -op.xmm16s(5);
   if(op.xmm16s(6) < 0) op.xmm16u(6) = -op.xmm16s(6);
   if(op.xmm16s(7) < 0) op.xmm16u(7) = -op.xmm16s(7);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op);
@@ -471,15 +528,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PABSD_VdqWdq(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
 
+#if BX_SUPPORT_HOST_SSSE3
+  HOST_XMM_STORE(op, _mm_abs_epi32(HOST_XMM(op)));
+#else
   if(op.xmm32s(0) < 0) op.xmm32u(0) = -op.xmm32s(0);
   if(op.xmm32s(1) < 0) op.xmm32u(1) = -op.xmm32s(1);
   if(op.xmm32s(2) < 0) op.xmm32u(2) = -op.xmm32s(2);
   if(op.xmm32s(3) < 0) op.xmm32u(3) = -op.xmm32s(3);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op);
@@ -500,7 +561,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PBLENDVB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -527,7 +588,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::BLENDVPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -556,7 +617,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::BLENDVPD_VpdWpd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -583,7 +644,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PTEST_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -611,13 +672,17 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULDQ_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(result, op1, op2, _mm_mul_epi32);
+#else
   result.xmm64s(0) = Bit64s(op1.xmm32s(0)) * Bit64s(op2.xmm32s(0));
   result.xmm64s(1) = Bit64s(op1.xmm32s(2)) * Bit64s(op2.xmm32s(2));
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -637,16 +702,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PCMPEQQ_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(op1, op1, op2, _mm_cmpeq_epi64);
+#else
   op1.xmm64u(0) = (op1.xmm64u(0) == op2.xmm64u(0)) ?
         BX_CONST64(0xffffffffffffffff) : 0;
 
   op1.xmm64u(1) = (op1.xmm64u(1) == op2.xmm64u(1)) ?
         BX_CONST64(0xffffffffffffffff) : 0;
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -666,11 +735,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PACKUSDW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(result, op1, op2, _mm_packus_epi32);
+#else
   result.xmm16u(0) = SaturateDwordSToWordU(op1.xmm32s(0));
   result.xmm16u(1) = SaturateDwordSToWordU(op1.xmm32s(1));
   result.xmm16u(2) = SaturateDwordSToWordU(op1.xmm32s(2));
@@ -679,6 +751,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PACKUSDW_VdqWdq(bxInstruction_c *i)
   result.xmm16u(5) = SaturateDwordSToWordU(op2.xmm32s(1));
   result.xmm16u(6) = SaturateDwordSToWordU(op2.xmm32s(2));
   result.xmm16u(7) = SaturateDwordSToWordU(op2.xmm32s(3));
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -698,16 +771,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PCMPGTQ_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
-  op1.xmm64u(0) = (op1.xmm64u(0) > op2.xmm64u(0)) ?
+#if BX_SUPPORT_HOST_SSE4_2
+  HOST_XMM_OP(op1, op1, op2, _mm_cmpgt_epi64);
+#else
+  op1.xmm64u(0) = (op1.xmm64s(0) > op2.xmm64s(0)) ?
         BX_CONST64(0xffffffffffffffff) : 0;
 
-  op1.xmm64u(1) = (op1.xmm64u(1) > op2.xmm64u(1)) ?
+  op1.xmm64u(1) = (op1.xmm64s(1) > op2.xmm64s(1)) ?
         BX_CONST64(0xffffffffffffffff) : 0;
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -727,14 +804,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMINSB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(op1, op1, op2, _mm_min_epi8);
+#else
   for(unsigned j=0; j<16; j++) {
     if(op2.xmmsbyte(j) < op1.xmmsbyte(j)) op1.xmmubyte(j) = op2.xmmubyte(j);
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -754,15 +835,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMINSD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(op1, op1, op2, _mm_min_epi32);
+#else
   if(op2.xmm32s(0) < op1.xmm32s(0)) op1.xmm32u(0) = op2.xmm32u(0);
   if(op2.xmm32s(1) < op1.xmm32s(1)) op1.xmm32u(1) = op2.xmm32u(1);
   if(op2.xmm32s(2) < op1.xmm32s(2)) op1.xmm32u(2) = op2.xmm32u(2);
   if(op2.xmm32s(3) < op1.xmm32s(3)) op1.xmm32u(3) = op2.xmm32u(3);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -782,11 +867,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMINUW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(op1, op1, op2, _mm_min_epu16);
+#else
   if(op2.xmm16u(0) < op1.xmm16u(0)) op1.xmm16u(0) = op2.xmm16u(0);
   if(op2.xmm16u(1) < op1.xmm16u(1)) op1.xmm16u(1) = op2.xmm16u(1);
   if(op2.xmm16u(2) < op1.xmm16u(2)) op1.xmm16u(2) = op2.xmm16u(2);
@@ -795,6 +883,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMINUW_VdqWdq(bxInstruction_c *i)
   if(op2.xmm16u(5) < op1.xmm16u(5)) op1.xmm16u(5) = op2.xmm16u(5);
   if(op2.xmm16u(6) < op1.xmm16u(6)) op1.xmm16u(6) = op2.xmm16u(6);
   if(op2.xmm16u(7) < op1.xmm16u(7)) op1.xmm16u(7) = op2.xmm16u(7);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -814,15 +903,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMINUD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(op1, op1, op2, _mm_min_epu32);
+#else
   if(op2.xmm32u(0) < op1.xmm32u(0)) op1.xmm32u(0) = op2.xmm32u(0);
   if(op2.xmm32u(1) < op1.xmm32u(1)) op1.xmm32u(1) = op2.xmm32u(1);
   if(op2.xmm32u(2) < op1.xmm32u(2)) op1.xmm32u(2) = op2.xmm32u(2);
   if(op2.xmm32u(3) < op1.xmm32u(3)) op1.xmm32u(3) = op2.xmm32u(3);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -842,14 +935,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMAXSB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(op1, op1, op2, _mm_max_epi8);
+#else
   for(unsigned j=0; j<16; j++) {
     if(op2.xmmsbyte(j) > op1.xmmsbyte(j)) op1.xmmubyte(j) = op2.xmmubyte(j);
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -869,15 +966,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMAXSD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(op1, op1, op2, _mm_max_epi32);
+#else
   if(op2.xmm32s(0) > op1.xmm32s(0)) op1.xmm32u(0) = op2.xmm32u(0);
   if(op2.xmm32s(1) > op1.xmm32s(1)) op1.xmm32u(1) = op2.xmm32u(1);
   if(op2.xmm32s(2) > op1.xmm32s(2)) op1.xmm32u(2) = op2.xmm32u(2);
   if(op2.xmm32s(3) > op1.xmm32s(3)) op1.xmm32u(3) = op2.xmm32u(3);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -897,11 +998,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMAXUW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(op1, op1, op2, _mm_max_epu16);
+#else
   if(op2.xmm16u(0) > op1.xmm16u(0)) op1.xmm16u(0) = op2.xmm16u(0);
   if(op2.xmm16u(1) > op1.xmm16u(1)) op1.xmm16u(1) = op2.xmm16u(1);
   if(op2.xmm16u(2) > op1.xmm16u(2)) op1.xmm16u(2) = op2.xmm16u(2);
@@ -910,6 +1014,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMAXUW_VdqWdq(bxInstruction_c *i)
   if(op2.xmm16u(5) > op1.xmm16u(5)) op1.xmm16u(5) = op2.xmm16u(5);
   if(op2.xmm16u(6) > op1.xmm16u(6)) op1.xmm16u(6) = op2.xmm16u(6);
   if(op2.xmm16u(7) > op1.xmm16u(7)) op1.xmm16u(7) = op2.xmm16u(7);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -929,15 +1034,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMAXUD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(op1, op1, op2, _mm_max_epu32);
+#else
   if(op2.xmm32u(0) > op1.xmm32u(0)) op1.xmm32u(0) = op2.xmm32u(0);
   if(op2.xmm32u(1) > op1.xmm32u(1)) op1.xmm32u(1) = op2.xmm32u(1);
   if(op2.xmm32u(2) > op1.xmm32u(2)) op1.xmm32u(2) = op2.xmm32u(2);
   if(op2.xmm32u(3) > op1.xmm32u(3)) op1.xmm32u(3) = op2.xmm32u(3);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -957,11 +1066,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULLD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_OP(op1, op1, op2, _mm_mullo_epi32);
+#else
   Bit64s product1 = Bit64s(op1.xmm32s(0)) * Bit64s(op2.xmm32s(0));
   Bit64s product2 = Bit64s(op1.xmm32s(1)) * Bit64s(op2.xmm32s(1));
   Bit64s product3 = Bit64s(op1.xmm32s(2)) * Bit64s(op2.xmm32s(2));
@@ -971,6 +1083,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULLD_VdqWdq(bxInstruction_c *i)
   op1.xmm32u(1) = (Bit32u)(product2 & 0xFFFFFFFF);
   op1.xmm32u(2) = (Bit32u)(product3 & 0xFFFFFFFF);
   op1.xmm32u(3) = (Bit32u)(product4 & 0xFFFFFFFF);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -990,11 +1103,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHMINPOSUW_VdqWdq(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
 
+#if BX_SUPPORT_HOST_SSE4_1
+  HOST_XMM_STORE(result, _mm_minpos_epu16(HOST_XMM(op)));
+#else
   unsigned min = 0;
 
   for (unsigned j=1; j < 8; j++) {
@@ -1005,6 +1121,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PHMINPOSUW_VdqWdq(bxInstruction_c *i)
   result.xmm16u(1) = min;
   result.xmm32u(1) = 0;
   result.xmm64u(1) = 0;
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -1025,7 +1142,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::BLENDPS_VpsWpsIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -1054,7 +1171,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::BLENDPD_VpdWpdIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -1081,7 +1198,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PBLENDW_VdqWdqIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -1114,7 +1231,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PEXTRB_EbdVdqIb(bxInstruction_c *i)
     BX_WRITE_32BIT_REGZ(i->rm(), result);
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     write_virtual_byte(i->seg(), eaddr, result);
   }
@@ -1135,7 +1252,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PEXTRW_EwdVdqIb(bxInstruction_c *i)
     BX_WRITE_32BIT_REGZ(i->rm(), result);
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     write_virtual_word(i->seg(), eaddr, result);
   }
@@ -1160,7 +1277,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PEXTRD_EdVdqIb(bxInstruction_c *i)
        BX_WRITE_64BIT_REG(i->rm(), result);
      }
      else {
-       bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+       bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
        /* pointer, segment address pair */
        write_virtual_qword_64(i->seg(), eaddr, result);
      }
@@ -1175,7 +1292,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PEXTRD_EdVdqIb(bxInstruction_c *i)
        BX_WRITE_32BIT_REGZ(i->rm(), result);
      }
      else {
-       bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+       bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
        /* pointer, segment address pair */
        write_virtual_dword(i->seg(), eaddr, result);
      }
@@ -1197,7 +1314,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::EXTRACTPS_EdVpsIb(bxInstruction_c *i)
     BX_WRITE_32BIT_REGZ(i->rm(), result);
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     write_virtual_dword(i->seg(), eaddr, result);
   }
@@ -1218,7 +1335,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PINSRB_VdqEbIb(bxInstruction_c *i)
     op2 = BX_READ_16BIT_REG(i->rm()); // won't allow reading of AH/CH/BH/DH
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_byte(i->seg(), eaddr);
   }
@@ -1246,7 +1363,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSERTPS_VpsWssIb(bxInstruction_c *i)
     op2 = temp.xmm32u((control >> 6) & 3);
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_dword(i->seg(), eaddr);
   }
@@ -1281,7 +1398,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PINSRD_VdqEdIb(bxInstruction_c *i)
       op2 = BX_READ_64BIT_REG(i->rm());
     }
     else {
-      bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+      bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
       /* pointer, segment address pair */
       op2 = read_virtual_qword_64(i->seg(), eaddr);
     }
@@ -1298,7 +1415,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PINSRD_VdqEdIb(bxInstruction_c *i)
       op2 = BX_READ_32BIT_REG(i->rm());
     }
     else {
-      bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+      bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
       /* pointer, segment address pair */
       op2 = read_virtual_dword(i->seg(), eaddr);
     }
@@ -1324,7 +1441,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MPSADBW_VdqWdqIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -1363,11 +1480,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUNPCKLBW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_unpacklo_epi8);
+#else
   result.xmmubyte(0x0) = op1.xmmubyte(0);
   result.xmmubyte(0x1) = op2.xmmubyte(0);
   result.xmmubyte(0x2) = op1.xmmubyte(1);
@@ -1384,6 +1504,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUNPCKLBW_VdqWdq(bxInstruction_c *i)
   result.xmmubyte(0xD) = op2.xmmubyte(6);
   result.xmmubyte(0xE) = op1.xmmubyte(7);
   result.xmmubyte(0xF) = op2.xmmubyte(7);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -1403,11 +1524,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUNPCKLWD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_unpacklo_epi16);
+#else
   result.xmm16u(0) = op1.xmm16u(0);
   result.xmm16u(1) = op2.xmm16u(0);
   result.xmm16u(2) = op1.xmm16u(1);
@@ -1416,6 +1540,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUNPCKLWD_VdqWdq(bxInstruction_c *i)
   result.xmm16u(5) = op2.xmm16u(2);
   result.xmm16u(6) = op1.xmm16u(3);
   result.xmm16u(7) = op2.xmm16u(3);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -1436,7 +1561,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::UNPCKLPS_VpsWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -1464,11 +1589,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PACKSSWB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_packs_epi16);
+#else
   result.xmmsbyte(0x0) = SaturateWordSToByteS(op1.xmm16s(0));
   result.xmmsbyte(0x1) = SaturateWordSToByteS(op1.xmm16s(1));
   result.xmmsbyte(0x2) = SaturateWordSToByteS(op1.xmm16s(2));
@@ -1486,6 +1614,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PACKSSWB_VdqWdq(bxInstruction_c *i)
   result.xmmsbyte(0xD) = SaturateWordSToByteS(op2.xmm16s(5));
   result.xmmsbyte(0xE) = SaturateWordSToByteS(op2.xmm16s(6));
   result.xmmsbyte(0xF) = SaturateWordSToByteS(op2.xmm16s(7));
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -1505,14 +1634,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PCMPGTB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_cmpgt_epi8);
+#else
   for(unsigned j=0; j<16; j++) {
     op1.xmmubyte(j) = (op1.xmmsbyte(j) > op2.xmmsbyte(j)) ? 0xff : 0;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -1532,11 +1665,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PCMPGTW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_cmpgt_epi16);
+#else
   op1.xmm16u(0) = (op1.xmm16s(0) > op2.xmm16s(0)) ? 0xffff : 0;
   op1.xmm16u(1) = (op1.xmm16s(1) > op2.xmm16s(1)) ? 0xffff : 0;
   op1.xmm16u(2) = (op1.xmm16s(2) > op2.xmm16s(2)) ? 0xffff : 0;
@@ -1545,6 +1681,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PCMPGTW_VdqWdq(bxInstruction_c *i)
   op1.xmm16u(5) = (op1.xmm16s(5) > op2.xmm16s(5)) ? 0xffff : 0;
   op1.xmm16u(6) = (op1.xmm16s(6) > op2.xmm16s(6)) ? 0xffff : 0;
   op1.xmm16u(7) = (op1.xmm16s(7) > op2.xmm16s(7)) ? 0xffff : 0;
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -1564,15 +1701,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PCMPGTD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_cmpgt_epi32);
+#else
   op1.xmm32u(0) = (op1.xmm32s(0) > op2.xmm32s(0)) ? 0xffffffff : 0;
   op1.xmm32u(1) = (op1.xmm32s(1) > op2.xmm32s(1)) ? 0xffffffff : 0;
   op1.xmm32u(2) = (op1.xmm32s(2) > op2.xmm32s(2)) ? 0xffffffff : 0;
   op1.xmm32u(3) = (op1.xmm32s(3) > op2.xmm32s(3)) ? 0xffffffff : 0;
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -1592,11 +1733,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PACKUSWB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_packus_epi16);
+#else
   result.xmmubyte(0x0) = SaturateWordSToByteU(op1.xmm16s(0));
   result.xmmubyte(0x1) = SaturateWordSToByteU(op1.xmm16s(1));
   result.xmmubyte(0x2) = SaturateWordSToByteU(op1.xmm16s(2));
@@ -1614,6 +1758,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PACKUSWB_VdqWdq(bxInstruction_c *i)
   result.xmmubyte(0xD) = SaturateWordSToByteU(op2.xmm16s(5));
   result.xmmubyte(0xE) = SaturateWordSToByteU(op2.xmm16s(6));
   result.xmmubyte(0xF) = SaturateWordSToByteU(op2.xmm16s(7));
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -1633,11 +1778,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUNPCKHBW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_unpackhi_epi8);
+#else
   result.xmmubyte(0x0) = op1.xmmubyte(0x8);
   result.xmmubyte(0x1) = op2.xmmubyte(0x8);
   result.xmmubyte(0x2) = op1.xmmubyte(0x9);
@@ -1654,6 +1802,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUNPCKHBW_VdqWdq(bxInstruction_c *i)
   result.xmmubyte(0xD) = op2.xmmubyte(0xE);
   result.xmmubyte(0xE) = op1.xmmubyte(0xF);
   result.xmmubyte(0xF) = op2.xmmubyte(0xF);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -1673,11 +1822,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUNPCKHWD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_unpackhi_epi16);
+#else
   result.xmm16u(0) = op1.xmm16u(4);
   result.xmm16u(1) = op2.xmm16u(4);
   result.xmm16u(2) = op1.xmm16u(5);
@@ -1686,6 +1838,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUNPCKHWD_VdqWdq(bxInstruction_c *i)
   result.xmm16u(5) = op2.xmm16u(6);
   result.xmm16u(6) = op1.xmm16u(7);
   result.xmm16u(7) = op2.xmm16u(7);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -1706,7 +1859,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::UNPCKHPS_VpsWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -1734,11 +1887,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PACKSSDW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_packs_epi32);
+#else
   result.xmm16s(0) = SaturateDwordSToWordS(op1.xmm32s(0));
   result.xmm16s(1) = SaturateDwordSToWordS(op1.xmm32s(1));
   result.xmm16s(2) = SaturateDwordSToWordS(op1.xmm32s(2));
@@ -1748,6 +1904,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PACKSSDW_VdqWdq(bxInstruction_c *i)
   result.xmm16s(5) = SaturateDwordSToWordS(op2.xmm32s(1));
   result.xmm16s(6) = SaturateDwordSToWordS(op2.xmm32s(2));
   result.xmm16s(7) = SaturateDwordSToWordS(op2.xmm32s(3));
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -1768,12 +1925,16 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUNPCKLQDQ_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_unpacklo_epi64);
+#else
   op1.xmm64u(1) = op2.xmm64u(0);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -1794,13 +1955,17 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUNPCKHQDQ_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_unpackhi_epi64);
+#else
   result.xmm64u(0) = op1.xmm64u(1);
   result.xmm64u(1) = op2.xmm64u(1);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -1821,7 +1986,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSHUFD_VdqWdqIb(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -1850,7 +2015,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSHUFHW_VdqWdqIb(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -1880,7 +2045,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSHUFLW_VdqWdqIb(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -1909,14 +2074,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PCMPEQB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_cmpeq_epi8);
+#else
   for(unsigned j=0; j<16; j++) {
     op1.xmmubyte(j) = (op1.xmmubyte(j) == op2.xmmubyte(j)) ? 0xff : 0;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -1936,11 +2105,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PCMPEQW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_cmpeq_epi16);
+#else
   op1.xmm16u(0) = (op1.xmm16u(0) == op2.xmm16u(0)) ? 0xffff : 0;
   op1.xmm16u(1) = (op1.xmm16u(1) == op2.xmm16u(1)) ? 0xffff : 0;
   op1.xmm16u(2) = (op1.xmm16u(2) == op2.xmm16u(2)) ? 0xffff : 0;
@@ -1949,6 +2121,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PCMPEQW_VdqWdq(bxInstruction_c *i)
   op1.xmm16u(5) = (op1.xmm16u(5) == op2.xmm16u(5)) ? 0xffff : 0;
   op1.xmm16u(6) = (op1.xmm16u(6) == op2.xmm16u(6)) ? 0xffff : 0;
   op1.xmm16u(7) = (op1.xmm16u(7) == op2.xmm16u(7)) ? 0xffff : 0;
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -1968,15 +2141,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PCMPEQD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_cmpeq_epi32);
+#else
   op1.xmm32u(0) = (op1.xmm32u(0) == op2.xmm32u(0)) ? 0xffffffff : 0;
   op1.xmm32u(1) = (op1.xmm32u(1) == op2.xmm32u(1)) ? 0xffffffff : 0;
   op1.xmm32u(2) = (op1.xmm32u(2) == op2.xmm32u(2)) ? 0xffffffff : 0;
   op1.xmm32u(3) = (op1.xmm32u(3) == op2.xmm32u(3)) ? 0xffffffff : 0;
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -1998,7 +2175,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PINSRW_VdqEwIb(bxInstruction_c *i)
     op2 = BX_READ_16BIT_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_word(i->seg(), eaddr);
   }
@@ -2038,7 +2215,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SHUFPS_VpsWpsIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2067,7 +2244,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SHUFPD_VpdWpdIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2093,11 +2270,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_srl_epi16);
+#else
   if(op2.xmm64u(0) > 15)  /* looking only to low 64 bits */
   {
     op1.xmm64u(0) = 0;
@@ -2116,6 +2296,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLW_VdqWdq(bxInstruction_c *i)
     op1.xmm16u(6) >>= shift;
     op1.xmm16u(7) >>= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2135,11 +2316,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_srl_epi32);
+#else
   if(op2.xmm64u(0) > 31)  /* looking only to low 64 bits */
   {
     op1.xmm64u(0) = 0;
@@ -2154,6 +2338,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLD_VdqWdq(bxInstruction_c *i)
     op1.xmm32u(2) >>= shift;
     op1.xmm32u(3) >>= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2173,11 +2358,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLQ_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_srl_epi64);
+#else
   if(op2.xmm64u(0) > 63)  /* looking only to low 64 bits */
   {
     op1.xmm64u(0) = 0;
@@ -2190,6 +2378,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLQ_VdqWdq(bxInstruction_c *i)
     op1.xmm64u(0) >>= shift;
     op1.xmm64u(1) >>= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2209,13 +2398,17 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PADDQ_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_add_epi64);
+#else
   op1.xmm64u(0) += op2.xmm64u(0);
   op1.xmm64u(1) += op2.xmm64u(1);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2235,11 +2428,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULLW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_mullo_epi16);
+#else
   Bit32u product1 = Bit32u(op1.xmm16u(0)) * Bit32u(op2.xmm16u(0));
   Bit32u product2 = Bit32u(op1.xmm16u(1)) * Bit32u(op2.xmm16u(1));
   Bit32u product3 = Bit32u(op1.xmm16u(2)) * Bit32u(op2.xmm16u(2));
@@ -2257,6 +2453,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULLW_VdqWdq(bxInstruction_c *i)
   op1.xmm16u(5) = product6 & 0xffff;
   op1.xmm16u(6) = product7 & 0xffff;
   op1.xmm16u(7) = product8 & 0xffff;
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2276,11 +2473,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBUSB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_subs_epu8);
+#else
   result.xmm64u(0) = result.xmm64u(1) = 0;
 
   for(unsigned j=0; j<16; j++)
@@ -2290,6 +2490,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBUSB_VdqWdq(bxInstruction_c *i)
           result.xmmubyte(j) = op1.xmmubyte(j) - op2.xmmubyte(j);
       }
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -2309,11 +2510,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBUSW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_subs_epu16);
+#else
   result.xmm64u(0) = result.xmm64u(1) = 0;
 
   for(unsigned j=0; j<8; j++)
@@ -2323,6 +2527,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBUSW_VdqWdq(bxInstruction_c *i)
            result.xmm16u(j) = op1.xmm16u(j) - op2.xmm16u(j);
       }
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -2342,14 +2547,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMINUB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_min_epu8);
+#else
   for(unsigned j=0; j<16; j++) {
     if(op2.xmmubyte(j) < op1.xmmubyte(j)) op1.xmmubyte(j) = op2.xmmubyte(j);
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2371,7 +2580,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ANDPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2397,14 +2606,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PADDUSB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_adds_epu8);
+#else
   for(unsigned j=0; j<16; j++) {
     op1.xmmubyte(j) = SaturateWordSToByteU(Bit16s(op1.xmmubyte(j)) + Bit16s(op2.xmmubyte(j)));
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2424,11 +2637,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PADDUSW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_adds_epu16);
+#else
   op1.xmm16u(0) = SaturateDwordSToWordU(Bit32s(op1.xmm16u(0)) + Bit32s(op2.xmm16u(0)));
   op1.xmm16u(1) = SaturateDwordSToWordU(Bit32s(op1.xmm16u(1)) + Bit32s(op2.xmm16u(1)));
   op1.xmm16u(2) = SaturateDwordSToWordU(Bit32s(op1.xmm16u(2)) + Bit32s(op2.xmm16u(2)));
@@ -2437,6 +2653,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PADDUSW_VdqWdq(bxInstruction_c *i)
   op1.xmm16u(5) = SaturateDwordSToWordU(Bit32s(op1.xmm16u(5)) + Bit32s(op2.xmm16u(5)));
   op1.xmm16u(6) = SaturateDwordSToWordU(Bit32s(op1.xmm16u(6)) + Bit32s(op2.xmm16u(6)));
   op1.xmm16u(7) = SaturateDwordSToWordU(Bit32s(op1.xmm16u(7)) + Bit32s(op2.xmm16u(7)));
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2456,14 +2673,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMAXUB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_max_epu8);
+#else
   for(unsigned j=0; j<16; j++) {
     if(op2.xmmubyte(j) > op1.xmmubyte(j)) op1.xmmubyte(j) = op2.xmmubyte(j);
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2485,7 +2706,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ANDNPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2511,14 +2732,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PAVGB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_avg_epu8);
+#else
   for(unsigned j=0; j<16; j++) {
     op1.xmmubyte(j) = (op1.xmmubyte(j) + op2.xmmubyte(j) + 1) >> 1;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2538,11 +2763,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRAW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_sra_epi16);
+#else
   if(op2.xmm64u(0) == 0) return;
 
   if(op2.xmm64u(0) > 15)  /* looking only to low 64 bits */
@@ -2569,6 +2797,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRAW_VdqWdq(bxInstruction_c *i)
     result.xmm16u(6) = (Bit16u)(op1.xmm16s(6) >> shift);
     result.xmm16u(7) = (Bit16u)(op1.xmm16s(7) >> shift);
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -2588,11 +2817,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRAD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_sra_epi32);
+#else
   if(op2.xmm64u(0) == 0) return;
 
   if(op2.xmm64u(0) > 31)  /* looking only to low 64 bits */
@@ -2611,6 +2843,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRAD_VdqWdq(bxInstruction_c *i)
     result.xmm32u(2) = (Bit32u)(op1.xmm32s(2) >> shift);
     result.xmm32u(3) = (Bit32u)(op1.xmm32s(3) >> shift);
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -2630,11 +2863,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PAVGW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_avg_epu16);
+#else
   op1.xmm16u(0) = (op1.xmm16u(0) + op2.xmm16u(0) + 1) >> 1;
   op1.xmm16u(1) = (op1.xmm16u(1) + op2.xmm16u(1) + 1) >> 1;
   op1.xmm16u(2) = (op1.xmm16u(2) + op2.xmm16u(2) + 1) >> 1;
@@ -2643,6 +2879,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PAVGW_VdqWdq(bxInstruction_c *i)
   op1.xmm16u(5) = (op1.xmm16u(5) + op2.xmm16u(5) + 1) >> 1;
   op1.xmm16u(6) = (op1.xmm16u(6) + op2.xmm16u(6) + 1) >> 1;
   op1.xmm16u(7) = (op1.xmm16u(7) + op2.xmm16u(7) + 1) >> 1;
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2662,11 +2899,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULHUW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_mulhi_epu16);
+#else
   Bit32u product1 = Bit32u(op1.xmm16u(0)) * Bit32u(op2.xmm16u(0));
   Bit32u product2 = Bit32u(op1.xmm16u(1)) * Bit32u(op2.xmm16u(1));
   Bit32u product3 = Bit32u(op1.xmm16u(2)) * Bit32u(op2.xmm16u(2));
@@ -2684,6 +2924,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULHUW_VdqWdq(bxInstruction_c *i)
   op1.xmm16u(5) = (Bit16u)(product6 >> 16);
   op1.xmm16u(6) = (Bit16u)(product7 >> 16);
   op1.xmm16u(7) = (Bit16u)(product8 >> 16);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2703,11 +2944,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULHW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_mulhi_epi16);
+#else
   Bit32s product1 = Bit32s(op1.xmm16s(0)) * Bit32s(op2.xmm16s(0));
   Bit32s product2 = Bit32s(op1.xmm16s(1)) * Bit32s(op2.xmm16s(1));
   Bit32s product3 = Bit32s(op1.xmm16s(2)) * Bit32s(op2.xmm16s(2));
@@ -2725,6 +2969,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULHW_VdqWdq(bxInstruction_c *i)
   op1.xmm16u(5) = (Bit16u)(product6 >> 16);
   op1.xmm16u(6) = (Bit16u)(product7 >> 16);
   op1.xmm16u(7) = (Bit16u)(product8 >> 16);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2744,14 +2989,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBSB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_subs_epi8);
+#else
   for(unsigned j=0; j<16; j++) {
     op1.xmmsbyte(j) = SaturateWordSToByteS(Bit16s(op1.xmmsbyte(j)) - Bit16s(op2.xmmsbyte(j)));
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2771,11 +3020,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBSW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_subs_epi16);
+#else
   op1.xmm16s(0) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(0)) - Bit32s(op2.xmm16s(0)));
   op1.xmm16s(1) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(1)) - Bit32s(op2.xmm16s(1)));
   op1.xmm16s(2) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(2)) - Bit32s(op2.xmm16s(2)));
@@ -2784,6 +3036,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBSW_VdqWdq(bxInstruction_c *i)
   op1.xmm16s(5) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(5)) - Bit32s(op2.xmm16s(5)));
   op1.xmm16s(6) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(6)) - Bit32s(op2.xmm16s(6)));
   op1.xmm16s(7) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(7)) - Bit32s(op2.xmm16s(7)));
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2803,11 +3056,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMINSW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_min_epi16);
+#else
   if(op2.xmm16s(0) < op1.xmm16s(0)) op1.xmm16s(0) = op2.xmm16s(0);
   if(op2.xmm16s(1) < op1.xmm16s(1)) op1.xmm16s(1) = op2.xmm16s(1);
   if(op2.xmm16s(2) < op1.xmm16s(2)) op1.xmm16s(2) = op2.xmm16s(2);
@@ -2816,6 +3072,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMINSW_VdqWdq(bxInstruction_c *i)
   if(op2.xmm16s(5) < op1.xmm16s(5)) op1.xmm16s(5) = op2.xmm16s(5);
   if(op2.xmm16s(6) < op1.xmm16s(6)) op1.xmm16s(6) = op2.xmm16s(6);
   if(op2.xmm16s(7) < op1.xmm16s(7)) op1.xmm16s(7) = op2.xmm16s(7);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2837,7 +3094,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ORPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2863,14 +3120,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PADDSB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_adds_epi8);
+#else
   for(unsigned j=0; j<16; j++) {
     op1.xmmsbyte(j) = SaturateWordSToByteS(Bit16s(op1.xmmsbyte(j)) + Bit16s(op2.xmmsbyte(j)));
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2890,11 +3151,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PADDSW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_adds_epi16);
+#else
   op1.xmm16s(0) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(0)) + Bit32s(op2.xmm16s(0)));
   op1.xmm16s(1) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(1)) + Bit32s(op2.xmm16s(1)));
   op1.xmm16s(2) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(2)) + Bit32s(op2.xmm16s(2)));
@@ -2903,6 +3167,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PADDSW_VdqWdq(bxInstruction_c *i)
   op1.xmm16s(5) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(5)) + Bit32s(op2.xmm16s(5)));
   op1.xmm16s(6) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(6)) + Bit32s(op2.xmm16s(6)));
   op1.xmm16s(7) = SaturateDwordSToWordS(Bit32s(op1.xmm16s(7)) + Bit32s(op2.xmm16s(7)));
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2922,11 +3187,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMAXSW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_max_epi16);
+#else
   if(op2.xmm16s(0) > op1.xmm16s(0)) op1.xmm16s(0) = op2.xmm16s(0);
   if(op2.xmm16s(1) > op1.xmm16s(1)) op1.xmm16s(1) = op2.xmm16s(1);
   if(op2.xmm16s(2) > op1.xmm16s(2)) op1.xmm16s(2) = op2.xmm16s(2);
@@ -2935,6 +3203,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMAXSW_VdqWdq(bxInstruction_c *i)
   if(op2.xmm16s(5) > op1.xmm16s(5)) op1.xmm16s(5) = op2.xmm16s(5);
   if(op2.xmm16s(6) > op1.xmm16s(6)) op1.xmm16s(6) = op2.xmm16s(6);
   if(op2.xmm16s(7) > op1.xmm16s(7)) op1.xmm16s(7) = op2.xmm16s(7);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -2956,7 +3225,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::XORPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2982,11 +3251,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_sll_epi16);
+#else
   if(op2.xmm64u(0) > 15)  /* looking only to low 64 bits */
   {
     op1.xmm64u(0) = 0;
@@ -3005,6 +3277,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLW_VdqWdq(bxInstruction_c *i)
     op1.xmm16u(6) <<= shift;
     op1.xmm16u(7) <<= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -3024,11 +3297,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_sll_epi32);
+#else
   if(op2.xmm64u(0) > 31)  /* looking only to low 64 bits */
   {
     op1.xmm64u(0) = 0;
@@ -3043,6 +3319,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLD_VdqWdq(bxInstruction_c *i)
     op1.xmm32u(2) <<= shift;
     op1.xmm32u(3) <<= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -3062,11 +3339,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLQ_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_sll_epi64);
+#else
   if(op2.xmm64u(0) > 63)  /* looking only to low 64 bits */
   {
     op1.xmm64u(0) = 0;
@@ -3079,6 +3359,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLQ_VdqWdq(bxInstruction_c *i)
     op1.xmm64u(0) <<= shift;
     op1.xmm64u(1) <<= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -3098,13 +3379,17 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMULUDQ_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_mul_epu32);
+#else
   result.xmm64u(0) = Bit64u(op1.xmm32u(0)) * Bit64u(op2.xmm32u(0));
   result.xmm64u(1) = Bit64u(op1.xmm32u(2)) * Bit64u(op2.xmm32u(2));
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -3124,11 +3409,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMADDWD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(result, op1, op2, _mm_madd_epi16);
+#else
   for(unsigned j=0; j<4; j++)
   {
     if(op1.xmm32u(j) == 0x80008000 && op2.xmm32u(j) == 0x80008000) {
@@ -3140,6 +3428,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PMADDWD_VdqWdq(bxInstruction_c *i)
         Bit32s(op1.xmm16s(2*j+1)) * Bit32s(op2.xmm16s(2*j+1));
     }
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), result);
@@ -3153,18 +3442,22 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSADBW_VdqWdq(bxInstruction_c *i)
   BX_CPU_THIS_PTR prepareSSE();
 
   BxPackedXmmRegister op1 = BX_READ_XMM_REG(i->nnn()), op2;
-  Bit16u temp1 = 0, temp2 = 0;
 
   /* op2 is a register or memory reference */
   if (i->modC0()) {
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_sad_epu8);
+#else
+  Bit16u temp1 = 0, temp2 = 0;
+
   temp1 += abs(op1.xmmubyte(0x0) - op2.xmmubyte(0x0));
   temp1 += abs(op1.xmmubyte(0x1) - op2.xmmubyte(0x1));
   temp1 += abs(op1.xmmubyte(0x2) - op2.xmmubyte(0x2));
@@ -3185,6 +3478,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSADBW_VdqWdq(bxInstruction_c *i)
 
   op1.xmm64u(0) = Bit64u(temp1);
   op1.xmm64u(1) = Bit64u(temp2);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -3204,14 +3498,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_sub_epi8);
+#else
   for(unsigned j=0; j<16; j++) {
     op1.xmmubyte(j) -= op2.xmmubyte(j);
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -3231,11 +3529,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_sub_epi16);
+#else
   op1.xmm16u(0) -= op2.xmm16u(0);
   op1.xmm16u(1) -= op2.xmm16u(1);
   op1.xmm16u(2) -= op2.xmm16u(2);
@@ -3244,6 +3545,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBW_VdqWdq(bxInstruction_c *i)
   op1.xmm16u(5) -= op2.xmm16u(5);
   op1.xmm16u(6) -= op2.xmm16u(6);
   op1.xmm16u(7) -= op2.xmm16u(7);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -3263,15 +3565,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_sub_epi32);
+#else
   op1.xmm32u(0) -= op2.xmm32u(0);
   op1.xmm32u(1) -= op2.xmm32u(1);
   op1.xmm32u(2) -= op2.xmm32u(2);
   op1.xmm32u(3) -= op2.xmm32u(3);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -3291,13 +3597,17 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSUBQ_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_sub_epi64);
+#else
   op1.xmm64u(0) -= op2.xmm64u(0);
   op1.xmm64u(1) -= op2.xmm64u(1);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -3317,14 +3627,18 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PADDB_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_add_epi8);
+#else
   for(unsigned j=0; j<16; j++) {
     op1.xmmubyte(j) += op2.xmmubyte(j);
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -3344,11 +3658,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PADDW_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_add_epi16);
+#else
   op1.xmm16u(0) += op2.xmm16u(0);
   op1.xmm16u(1) += op2.xmm16u(1);
   op1.xmm16u(2) += op2.xmm16u(2);
@@ -3357,6 +3674,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PADDW_VdqWdq(bxInstruction_c *i)
   op1.xmm16u(5) += op2.xmm16u(5);
   op1.xmm16u(6) += op2.xmm16u(6);
   op1.xmm16u(7) += op2.xmm16u(7);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -3376,15 +3694,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PADDD_VdqWdq(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_OP(op1, op1, op2, _mm_add_epi32);
+#else
   op1.xmm32u(0) += op2.xmm32u(0);
   op1.xmm32u(1) += op2.xmm32u(1);
   op1.xmm32u(2) += op2.xmm32u(2);
   op1.xmm32u(3) += op2.xmm32u(3);
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->nnn(), op1);
@@ -3400,6 +3722,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLW_UdqIb(bxInstruction_c *i)
   BxPackedXmmRegister op = BX_READ_XMM_REG(i->rm());
   Bit8u shift = i->Ib();
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_SHIFT_IMM(op, op, shift, _mm_srl_epi16);
+#else
   if(shift > 15) {
     op.xmm64u(0) = 0;
     op.xmm64u(1) = 0;
@@ -3414,6 +3739,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLW_UdqIb(bxInstruction_c *i)
     op.xmm16u(6) >>= shift;
     op.xmm16u(7) >>= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->rm(), op);
@@ -3431,6 +3757,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRAW_UdqIb(bxInstruction_c *i)
 
   if(shift == 0) return;
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_SHIFT_IMM(result, op, shift, _mm_sra_epi16);
+#else
   if(shift > 15) {
     result.xmm16u(0) = (op.xmm16u(0) & 0x8000) ? 0xffff : 0;
     result.xmm16u(1) = (op.xmm16u(1) & 0x8000) ? 0xffff : 0;
@@ -3451,6 +3780,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRAW_UdqIb(bxInstruction_c *i)
     result.xmm16u(6) = (Bit16u)(op.xmm16s(6) >> shift);
     result.xmm16u(7) = (Bit16u)(op.xmm16s(7) >> shift);
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->rm(), result);
@@ -3466,6 +3796,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLW_UdqIb(bxInstruction_c *i)
   BxPackedXmmRegister op = BX_READ_XMM_REG(i->rm());
   Bit8u shift = i->Ib();
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_SHIFT_IMM(op, op, shift, _mm_sll_epi16);
+#else
   if(shift > 15) {
     op.xmm64u(0) = 0;
     op.xmm64u(1) = 0;
@@ -3480,6 +3813,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLW_UdqIb(bxInstruction_c *i)
     op.xmm16u(6) <<= shift;
     op.xmm16u(7) <<= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->rm(), op);
@@ -3495,6 +3829,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLD_UdqIb(bxInstruction_c *i)
   BxPackedXmmRegister op = BX_READ_XMM_REG(i->rm());
   Bit8u shift = i->Ib();
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_SHIFT_IMM(op, op, shift, _mm_srl_epi32);
+#else
   if(shift > 31) {
     op.xmm64u(0) = 0;
     op.xmm64u(1) = 0;
@@ -3505,6 +3842,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLD_UdqIb(bxInstruction_c *i)
     op.xmm32u(2) >>= shift;
     op.xmm32u(3) >>= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->rm(), op);
@@ -3522,6 +3860,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRAD_UdqIb(bxInstruction_c *i)
 
   if(shift == 0) return;
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_SHIFT_IMM(result, op, shift, _mm_sra_epi32);
+#else
   if(shift > 31) {
     result.xmm32u(0) = (op.xmm32u(0) & 0x80000000) ? 0xffffffff : 0;
     result.xmm32u(1) = (op.xmm32u(1) & 0x80000000) ? 0xffffffff : 0;
@@ -3534,6 +3875,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRAD_UdqIb(bxInstruction_c *i)
     result.xmm32u(2) = (Bit32u)(op.xmm32s(2) >> shift);
     result.xmm32u(3) = (Bit32u)(op.xmm32s(3) >> shift);
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->rm(), result);
@@ -3549,6 +3891,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLD_UdqIb(bxInstruction_c *i)
   BxPackedXmmRegister op = BX_READ_XMM_REG(i->rm());
   Bit8u shift = i->Ib();
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_SHIFT_IMM(op, op, shift, _mm_sll_epi32);
+#else
   if(shift > 31) {
     op.xmm64u(0) = 0;
     op.xmm64u(1) = 0;
@@ -3559,6 +3904,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLD_UdqIb(bxInstruction_c *i)
     op.xmm32u(2) <<= shift;
     op.xmm32u(3) <<= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->rm(), op);
@@ -3574,6 +3920,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLQ_UdqIb(bxInstruction_c *i)
   BxPackedXmmRegister op = BX_READ_XMM_REG(i->rm());
   Bit8u shift = i->Ib();
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_SHIFT_IMM(op, op, shift, _mm_srl_epi64);
+#else
   if(shift > 63) {
     op.xmm64u(0) = 0;
     op.xmm64u(1) = 0;
@@ -3582,6 +3931,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSRLQ_UdqIb(bxInstruction_c *i)
     op.xmm64u(0) >>= shift;
     op.xmm64u(1) >>= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->rm(), op);
@@ -3617,6 +3967,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLQ_UdqIb(bxInstruction_c *i)
   BxPackedXmmRegister op = BX_READ_XMM_REG(i->rm());
   Bit8u shift = i->Ib();
 
+#if BX_SUPPORT_HOST_SSE2
+  HOST_XMM_SHIFT_IMM(op, op, shift, _mm_sll_epi64);
+#else
   if(shift > 63) {
     op.xmm64u(0) = 0;
     op.xmm64u(1) = 0;
@@ -3625,6 +3978,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PSLLQ_UdqIb(bxInstruction_c *i)
     op.xmm64u(0) <<= shift;
     op.xmm64u(1) <<= shift;
   }
+#endif
 
   /* now write result back to destination */
   BX_WRITE_XMM_REG(i->rm(), op);
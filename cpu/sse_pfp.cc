@@ -24,6 +24,7 @@
 #define NEED_CPU_REG_SHORTCUTS 1
 #include "bochs.h"
 #include "cpu.h"
+#include "simd_host.h"
 #define LOG_THIS BX_CPU_THIS_PTR
 
 #if BX_CPU_LEVEL >= 6
@@ -116,7 +117,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTPI2PS_VpsQqM(bxInstruction_c *i)
   BxPackedXmmRegister result;
 
   // do not cause transition to MMX state if no MMX register touched
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   MMXUQ(op) = read_virtual_qword(i->seg(), eaddr);
 
   float_status_t status_word;
@@ -164,7 +165,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTPI2PD_VpdQqM(bxInstruction_c *i)
   BxPackedXmmRegister result;
 
   // do not cause transition to MMX state if no MMX register touched
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   MMXUQ(op) = read_virtual_qword(i->seg(), eaddr);
 
   result.xmm64u(0) = int32_to_float64(MMXUD0(op));
@@ -209,7 +210,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTSI2SD_VsdEdM(bxInstruction_c *i)
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
   float64 result;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
 #if BX_SUPPORT_X86_64
   if (i->os64L())   /* 64 bit operand size */
@@ -266,7 +267,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTSI2SS_VssEdM(bxInstruction_c *i)
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
   float32 result;
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
 #if BX_SUPPORT_X86_64
   if (i->os64L())   /* 64 bit operand size */
@@ -308,7 +309,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTTPS2PI_PqWps(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_qword(i->seg(), eaddr);
   }
@@ -355,7 +356,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTTPD2PI_PqWpd(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -395,7 +396,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTTSD2SI_GdWsd(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_qword(i->seg(), eaddr);
   }
@@ -440,7 +441,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTTSS2SI_GdWss(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_dword(i->seg(), eaddr);
   }
@@ -490,7 +491,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTPS2PI_PqWps(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_qword(i->seg(), eaddr);
   }
@@ -538,7 +539,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTPD2PI_PqWpd(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -579,7 +580,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTSD2SI_GdWsd(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_qword(i->seg(), eaddr);
   }
@@ -624,7 +625,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTSS2SI_GdWss(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_dword(i->seg(), eaddr);
   }
@@ -668,7 +669,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTPS2PD_VpsWps(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_qword(i->seg(), eaddr);
   }
@@ -711,7 +712,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTPD2PS_VpdWpd(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -754,7 +755,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTSD2SS_VsdWsd(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_qword(i->seg(), eaddr);
   }
@@ -786,7 +787,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTSS2SD_VssWss(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_dword(i->seg(), eaddr);
   }
@@ -819,7 +820,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTDQ2PS_VpsWdq(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -856,7 +857,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTPS2DQ_VdqWps(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -899,7 +900,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTTPS2DQ_VdqWps(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -942,7 +943,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTTPD2DQ_VqWpd(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -983,7 +984,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTPD2DQ_VqWpd(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -1023,7 +1024,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CVTDQ2PD_VpdWq(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_qword(i->seg(), eaddr);
   }
@@ -1055,7 +1056,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::UCOMISS_VssWss(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_dword(i->seg(), eaddr);
   }
@@ -1092,7 +1093,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::UCOMISD_VsdWsd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_qword(i->seg(), eaddr);
   }
@@ -1129,7 +1130,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::COMISS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_dword(i->seg(), eaddr);
   }
@@ -1166,7 +1167,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::COMISD_VpdWpd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_qword(i->seg(), eaddr);
   }
@@ -1203,11 +1204,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SQRTPS_VpsWps(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PS_OP1(op, op, _mm_sqrt_ps);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1246,11 +1256,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SQRTPD_VpdWpd(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PD_OP1(op, op, _mm_sqrt_pd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1285,11 +1304,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SQRTSD_VsdWsd(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_qword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SD_OP(op, op, op, _mm_sqrt_sd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_QWORD(i->nnn(), op);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
   if (MXCSR.get_DAZ()) op = float64_denormal_to_zero(op);
@@ -1316,11 +1344,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SQRTSS_VssWss(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_dword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SS_OP1(op, op, _mm_sqrt_ss);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_DWORD(i->nnn(), op);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
   if (MXCSR.get_DAZ()) op = float32_denormal_to_zero(op);
@@ -1347,11 +1384,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADDPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PS_OP(op1, op1, op2, _mm_add_ps);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1394,11 +1440,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADDPD_VpdWpd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PD_OP(op1, op1, op2, _mm_add_pd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1435,11 +1490,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADDSD_VsdWsd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_qword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SD_OP(op1, op1, op2, _mm_add_sd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_QWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1472,11 +1536,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADDSS_VssWss(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_dword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SS_OP(op1, op1, op2, _mm_add_ss);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_DWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1509,11 +1582,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MULPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PS_OP(op1, op1, op2, _mm_mul_ps);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1556,11 +1638,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MULPD_VpdWpd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PD_OP(op1, op1, op2, _mm_mul_pd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1597,11 +1688,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MULSD_VsdWsd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_qword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SD_OP(op1, op1, op2, _mm_mul_sd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_QWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1634,11 +1734,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MULSS_VssWss(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_dword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SS_OP(op1, op1, op2, _mm_mul_ss);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_DWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1671,11 +1780,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SUBPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PS_OP(op1, op1, op2, _mm_sub_ps);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1718,11 +1836,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SUBPD_VpdWpd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PD_OP(op1, op1, op2, _mm_sub_pd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1759,11 +1886,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SUBSD_VsdWsd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_qword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SD_OP(op1, op1, op2, _mm_sub_sd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_QWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1796,11 +1932,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SUBSS_VssWss(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_dword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SS_OP(op1, op1, op2, _mm_sub_ss);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_DWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1833,11 +1978,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MINPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PS_OP(op1, op1, op2, _mm_min_ps);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
   int rc;
@@ -1885,11 +2039,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MINPD_VpdWpd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PD_OP(op1, op1, op2, _mm_min_pd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
   int rc;
@@ -1929,11 +2092,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MINSD_VsdWsd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_qword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SD_OP(op1, op1, op2, _mm_min_sd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_QWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -1967,11 +2139,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MINSS_VssWss(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_dword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SS_OP(op1, op1, op2, _mm_min_ss);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_DWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -2005,11 +2186,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::DIVPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PS_OP(op1, op1, op2, _mm_div_ps);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -2052,11 +2242,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::DIVPD_VpdWpd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PD_OP(op1, op1, op2, _mm_div_pd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -2093,11 +2292,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::DIVSD_VsdWsd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_qword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SD_OP(op1, op1, op2, _mm_div_sd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_QWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -2130,11 +2338,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::DIVSS_VssWss(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_dword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SS_OP(op1, op1, op2, _mm_div_ss);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_DWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -2167,11 +2384,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MAXPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PS_OP(op1, op1, op2, _mm_max_ps);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
   int rc;
@@ -2219,11 +2445,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MAXPD_VpdWpd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_PD_OP(op1, op1, op2, _mm_max_pd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
   int rc;
@@ -2263,11 +2498,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MAXSD_VsdWsd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_qword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SD_OP(op1, op1, op2, _mm_max_sd);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_QWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -2301,11 +2545,20 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MAXSS_VssWss(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_dword(i->seg(), eaddr);
   }
 
+#if BX_SUPPORT_HOST_SSE2
+  if (host_fp_begin(MXCSR.mxcsr)) {
+    HOST_SS_OP(op1, op1, op2, _mm_max_ss);
+    MXCSR.set_exceptions(host_fp_end());
+    BX_WRITE_XMM_REG_LO_DWORD(i->nnn(), op1);
+    return;
+  }
+#endif
+
   float_status_t status_word;
   mxcsr_to_softfloat_status_word(status_word, MXCSR);
 
@@ -2339,7 +2592,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::HADDPD_VpdWpd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2380,7 +2633,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::HADDPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2427,7 +2680,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::HSUBPD_VpdWpd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2468,7 +2721,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::HSUBPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2515,7 +2768,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPPS_VpsWpsIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2589,7 +2842,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPPD_VpdWpdIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2651,7 +2904,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPSD_VsdWsdIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_qword(i->seg(), eaddr);
   }
@@ -2708,7 +2961,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPSS_VssWssIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op2 = read_virtual_dword(i->seg(), eaddr);
   }
@@ -2765,7 +3018,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADDSUBPD_VpdWpd(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2806,7 +3059,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ADDSUBPS_VpsWps(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -2849,7 +3102,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ROUNDPS_VpsWpsIb(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -2896,7 +3149,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ROUNDPD_VpdWpdIb(bxInstruction_c *i)
     op = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op);
   }
@@ -2939,7 +3192,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ROUNDSS_VssWssIb(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_DWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_dword(i->seg(), eaddr);
   }
@@ -2978,7 +3231,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::ROUNDSD_VsdWsdIb(bxInstruction_c *i)
     op = BX_READ_XMM_REG_LO_QWORD(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     op = read_virtual_qword(i->seg(), eaddr);
   }
@@ -3022,7 +3275,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::DPPS_VpsWpsIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -3087,7 +3340,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::DPPD_VpdWpdIb(bxInstruction_c *i)
     op2 = BX_READ_XMM_REG(i->rm());
   }
   else {
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     /* pointer, segment address pair */
     readVirtualDQwordAligned(i->seg(), eaddr, (Bit8u *) &op2);
   }
@@ -38,7 +38,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::POP_EdM(bxInstruction_c *i)
   // Note: there is one little weirdism here.  It is possible to use
   // ESP in the modrm addressing. If used, the value of ESP after the
   // pop is used to calculate the address.
-  Bit32u eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  Bit32u eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   write_virtual_dword_32(i->seg(), eaddr, val32);
 
@@ -239,7 +239,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUSH_Id(bxInstruction_c *i)
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUSH_EdM(bxInstruction_c *i)
 {
-  Bit32u eaddr = (Bit32u) BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  Bit32u eaddr = (Bit32u) BX_CPU_RESOLVE_ADDR(i);
 
   Bit32u op1_32 = read_virtual_dword_32(i->seg(), eaddr);
 
@@ -395,3 +395,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LEAVE32(bxInstruction_c *i)
 
   EBP = value32;
 }
+
+#if BX_SUPPORT_FUSED_PAIRS
+// second one of two pushes or pops, see fuseTrace()
+BX_FUSED_STACK_HANDLER(PUSH_ERX)
+BX_FUSED_STACK_HANDLER(POP_ERX)
+#endif
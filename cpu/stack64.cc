@@ -35,7 +35,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::POP_EqM(bxInstruction_c *i)
   // Note: there is one little weirdism here.  It is possible to use
   // RSP in the modrm addressing. If used, the value of RSP after the
   // pop is used to calculate the address.
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   write_virtual_qword_64(i->seg(), eaddr, val64);
 
@@ -84,7 +84,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUSH64_Id(bxInstruction_c *i)
 
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::PUSH_EqM(bxInstruction_c *i)
 {
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
 
   Bit64u op1_64 = read_virtual_qword_64(i->seg(), eaddr);
 
@@ -136,4 +136,10 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LEAVE64(bxInstruction_c *i)
   RBP = temp64;
 }
 
+#if BX_SUPPORT_FUSED_PAIRS
+// second one of two pushes or pops, see fuseTrace()
+BX_FUSED_STACK_HANDLER(PUSH_RRX)
+BX_FUSED_STACK_HANDLER(POP_RRX)
+#endif
+
 #endif /* if BX_SUPPORT_X86_64 */
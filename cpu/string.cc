@@ -31,6 +31,12 @@
 #define RCX ECX
 #endif
 
+#if BX_SUPPORT_X86_64
+// RCX limited to the most iterations which fit in a page, for the fast
+// REP paths
+#define BX_REP_COUNT64 ((RCX > 0x1000) ? 0x1000 : (Bit32u) RCX)
+#endif
+
 //
 // Repeat Speedups methods
 //
@@ -43,19 +49,20 @@ Bit32u BX_CPU_C::FastRepMOVSB(bxInstruction_c *i, unsigned srcSeg, bx_address sr
   bx_address laddrDst, laddrSrc;
   Bit8u *hostAddrSrc, *hostAddrDst;
 
-  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
-
-  bx_segment_reg_t *srcSegPtr = &BX_CPU_THIS_PTR sregs[srcSeg];
-  if (!(srcSegPtr->cache.valid & SegAccessROK))
-    return 0;
-  if ((srcOff | 0xfff) > srcSegPtr->cache.u.segment.limit_scaled)
-    return 0;
+  // no segment limits in 64-bit mode
+  if (BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64) {
+    bx_segment_reg_t *srcSegPtr = &BX_CPU_THIS_PTR sregs[srcSeg];
+    if (!(srcSegPtr->cache.valid & SegAccessROK))
+      return 0;
+    if ((srcOff | 0xfff) > srcSegPtr->cache.u.segment.limit_scaled)
+      return 0;
 
-  bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
-  if (!(dstSegPtr->cache.valid & SegAccessWOK))
-    return 0;
-  if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
-    return 0;
+    bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
+    if (!(dstSegPtr->cache.valid & SegAccessWOK))
+      return 0;
+    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
+      return 0;
+  }
 
   laddrSrc = BX_CPU_THIS_PTR get_laddr(srcSeg, srcOff);
 
@@ -113,19 +120,20 @@ Bit32u BX_CPU_C::FastRepMOVSW(bxInstruction_c *i, unsigned srcSeg, bx_address sr
   bx_address laddrDst, laddrSrc;
   Bit8u *hostAddrSrc, *hostAddrDst;
 
-  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
-
-  bx_segment_reg_t *srcSegPtr = &BX_CPU_THIS_PTR sregs[srcSeg];
-  if (!(srcSegPtr->cache.valid & SegAccessROK))
-    return 0;
-  if ((srcOff | 0xfff) > srcSegPtr->cache.u.segment.limit_scaled)
-    return 0;
+  // no segment limits in 64-bit mode
+  if (BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64) {
+    bx_segment_reg_t *srcSegPtr = &BX_CPU_THIS_PTR sregs[srcSeg];
+    if (!(srcSegPtr->cache.valid & SegAccessROK))
+      return 0;
+    if ((srcOff | 0xfff) > srcSegPtr->cache.u.segment.limit_scaled)
+      return 0;
 
-  bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
-  if (!(dstSegPtr->cache.valid & SegAccessWOK))
-    return 0;
-  if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
-    return 0;
+    bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
+    if (!(dstSegPtr->cache.valid & SegAccessWOK))
+      return 0;
+    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
+      return 0;
+  }
 
   laddrSrc = BX_CPU_THIS_PTR get_laddr(srcSeg, srcOff);
 
@@ -186,19 +194,20 @@ Bit32u BX_CPU_C::FastRepMOVSD(bxInstruction_c *i, unsigned srcSeg, bx_address sr
   bx_address laddrDst, laddrSrc;
   Bit8u *hostAddrSrc, *hostAddrDst;
 
-  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
-
-  bx_segment_reg_t *srcSegPtr = &BX_CPU_THIS_PTR sregs[srcSeg];
-  if (!(srcSegPtr->cache.valid & SegAccessROK))
-    return 0;
-  if ((srcOff | 0xfff) > srcSegPtr->cache.u.segment.limit_scaled)
-    return 0;
+  // no segment limits in 64-bit mode
+  if (BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64) {
+    bx_segment_reg_t *srcSegPtr = &BX_CPU_THIS_PTR sregs[srcSeg];
+    if (!(srcSegPtr->cache.valid & SegAccessROK))
+      return 0;
+    if ((srcOff | 0xfff) > srcSegPtr->cache.u.segment.limit_scaled)
+      return 0;
 
-  bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
-  if (!(dstSegPtr->cache.valid & SegAccessWOK))
-    return 0;
-  if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
-    return 0;
+    bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
+    if (!(dstSegPtr->cache.valid & SegAccessWOK))
+      return 0;
+    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
+      return 0;
+  }
 
   laddrSrc = BX_CPU_THIS_PTR get_laddr(srcSeg, srcOff);
 
@@ -259,13 +268,14 @@ Bit32u BX_CPU_C::FastRepSTOSB(bxInstruction_c *i, unsigned dstSeg, bx_address ds
   bx_address laddrDst;
   Bit8u *hostAddrDst;
 
-  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
-
-  bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
-  if (!(dstSegPtr->cache.valid & SegAccessWOK))
-    return 0;
-  if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
-    return 0;
+  // no segment limits in 64-bit mode
+  if (BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64) {
+    bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
+    if (!(dstSegPtr->cache.valid & SegAccessWOK))
+      return 0;
+    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
+      return 0;
+  }
 
   laddrDst = BX_CPU_THIS_PTR get_laddr(dstSeg, dstOff);
 
@@ -313,13 +323,14 @@ Bit32u BX_CPU_C::FastRepSTOSW(bxInstruction_c *i, unsigned dstSeg, bx_address ds
   bx_address laddrDst;
   Bit8u *hostAddrDst;
 
-  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
-
-  bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
-  if (!(dstSegPtr->cache.valid & SegAccessWOK))
-    return 0;
-  if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
-    return 0;
+  // no segment limits in 64-bit mode
+  if (BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64) {
+    bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
+    if (!(dstSegPtr->cache.valid & SegAccessWOK))
+      return 0;
+    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
+      return 0;
+  }
 
   laddrDst = BX_CPU_THIS_PTR get_laddr(dstSeg, dstOff);
 
@@ -369,13 +380,14 @@ Bit32u BX_CPU_C::FastRepSTOSD(bxInstruction_c *i, unsigned dstSeg, bx_address ds
   bx_address laddrDst;
   Bit8u *hostAddrDst;
 
-  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
-
-  bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
-  if (!(dstSegPtr->cache.valid & SegAccessWOK))
-    return 0;
-  if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
-    return 0;
+  // no segment limits in 64-bit mode
+  if (BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64) {
+    bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
+    if (!(dstSegPtr->cache.valid & SegAccessWOK))
+      return 0;
+    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
+      return 0;
+  }
 
   laddrDst = BX_CPU_THIS_PTR get_laddr(dstSeg, dstOff);
 
@@ -417,6 +429,247 @@ Bit32u BX_CPU_C::FastRepSTOSD(bxInstruction_c *i, unsigned dstSeg, bx_address ds
 
   return 0;
 }
+
+#if BX_SUPPORT_X86_64
+Bit32u BX_CPU_C::FastRepMOVSQ(bxInstruction_c *i, unsigned srcSeg, bx_address srcOff, unsigned dstSeg, bx_address dstOff, Bit32u count)
+{
+  Bit32u qwordsFitSrc, qwordsFitDst;
+  signed int pointerDelta;
+  bx_address laddrDst, laddrSrc;
+  Bit8u *hostAddrSrc, *hostAddrDst;
+
+  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode == BX_MODE_LONG_64);
+
+  laddrSrc = BX_CPU_THIS_PTR get_laddr(srcSeg, srcOff);
+
+  hostAddrSrc = v2h_read_byte(laddrSrc, BX_CPU_THIS_PTR user_pl);
+  if (! hostAddrSrc) return 0;
+
+  laddrDst = BX_CPU_THIS_PTR get_laddr(dstSeg, dstOff);
+
+  hostAddrDst = v2h_write_byte(laddrDst, BX_CPU_THIS_PTR user_pl);
+  // Check that native host access was not vetoed for that page
+  if (!hostAddrDst) return 0;
+
+  // See how many qwords can fit in the rest of this page.
+  if (BX_CPU_THIS_PTR get_DF()) {
+    // Counting downward.
+    // Note: 1st qword must not cross page boundary.
+    if (((laddrSrc & 0xfff) > 0xff8) || ((laddrDst & 0xfff) > 0xff8))
+      return 0;
+    qwordsFitSrc = (8 + PAGE_OFFSET(laddrSrc)) >> 3;
+    qwordsFitDst = (8 + PAGE_OFFSET(laddrDst)) >> 3;
+    pointerDelta = (signed int) -8;
+  }
+  else {
+    // Counting upward.
+    qwordsFitSrc = (0x1000 - PAGE_OFFSET(laddrSrc)) >> 3;
+    qwordsFitDst = (0x1000 - PAGE_OFFSET(laddrDst)) >> 3;
+    pointerDelta = (signed int)  8;
+  }
+
+  // Restrict qword count to the number that will fit in either
+  // source or dest pages.
+  if (count > qwordsFitSrc)
+    count = qwordsFitSrc;
+  if (count > qwordsFitDst)
+    count = qwordsFitDst;
+  if (count > bx_pc_system.getNumCpuTicksLeftNextEvent())
+    count = bx_pc_system.getNumCpuTicksLeftNextEvent();
+
+  // If after all the restrictions, there is anything left to do...
+  if (count) {
+    // Transfer data directly using host addresses
+    for (unsigned j=0; j<count; j++) {
+      CopyHostQWordLittleEndian(hostAddrDst, hostAddrSrc);
+      hostAddrDst += pointerDelta;
+      hostAddrSrc += pointerDelta;
+    }
+
+    return count;
+  }
+
+  return 0;
+}
+
+Bit32u BX_CPU_C::FastRepSTOSQ(bxInstruction_c *i, unsigned dstSeg, bx_address dstOff, Bit64u val, Bit32u count)
+{
+  Bit32u qwordsFitDst;
+  signed int pointerDelta;
+  bx_address laddrDst;
+  Bit8u *hostAddrDst;
+
+  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode == BX_MODE_LONG_64);
+
+  laddrDst = BX_CPU_THIS_PTR get_laddr(dstSeg, dstOff);
+
+  hostAddrDst = v2h_write_byte(laddrDst, BX_CPU_THIS_PTR user_pl);
+  // Check that native host access was not vetoed for that page
+  if (!hostAddrDst) return 0;
+
+  // See how many qwords can fit in the rest of this page.
+  if (BX_CPU_THIS_PTR get_DF()) {
+    // Counting downward.
+    // Note: 1st qword must not cross page boundary.
+    if ((laddrDst & 0xfff) > 0xff8) return 0;
+    qwordsFitDst = (8 + PAGE_OFFSET(laddrDst)) >> 3;
+    pointerDelta = (signed int) -8;
+  }
+  else {
+    // Counting upward.
+    qwordsFitDst = (0x1000 - PAGE_OFFSET(laddrDst)) >> 3;
+    pointerDelta = (signed int)  8;
+  }
+
+  // Restrict qword count to the number that will fit in either
+  // source or dest pages.
+  if (count > qwordsFitDst)
+    count = qwordsFitDst;
+  if (count > bx_pc_system.getNumCpuTicksLeftNextEvent())
+    count = bx_pc_system.getNumCpuTicksLeftNextEvent();
+
+  // If after all the restrictions, there is anything left to do...
+  if (count) {
+    // Transfer data directly using host addresses
+    for (unsigned j=0; j<count; j++) {
+      WriteHostQWordToLittleEndian(hostAddrDst, val);
+      hostAddrDst += pointerDelta;
+    }
+
+    return count;
+  }
+
+  return 0;
+}
+#endif
+
+// REP SCASB and REP CMPSB: returns the number of bytes, up to count-1, which
+// do not end the repeat, the caller compares the next byte as usual to get
+// the flags of the last iteration.
+Bit32u BX_CPU_C::FastRepSCASB(bxInstruction_c *i, bx_address dstOff, Bit8u val, Bit32u count)
+{
+  Bit32u bytesFitDst, ticksLeft, n;
+  bx_address laddrDst;
+  Bit8u *hostAddrDst;
+
+  // no segment limits in 64-bit mode
+  if (BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64) {
+    bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[BX_SEG_REG_ES];
+    if (!(dstSegPtr->cache.valid & SegAccessROK))
+      return 0;
+    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
+      return 0;
+  }
+
+  laddrDst = BX_CPU_THIS_PTR get_laddr(BX_SEG_REG_ES, dstOff);
+
+  hostAddrDst = v2h_read_byte(laddrDst, BX_CPU_THIS_PTR user_pl);
+  if (! hostAddrDst) return 0;
+
+  // See how many bytes can be scanned in the rest of this page.
+  if (BX_CPU_THIS_PTR get_DF())
+    bytesFitDst = 1 + PAGE_OFFSET(laddrDst);
+  else
+    bytesFitDst = 0x1000 - PAGE_OFFSET(laddrDst);
+
+  count--;
+  if (count > bytesFitDst)
+    count = bytesFitDst;
+  // the caller ticks once more for the byte compared after the batch
+  ticksLeft = bx_pc_system.getNumCpuTicksLeftNextEvent();
+  if (count >= ticksLeft)
+    count = ticksLeft ? ticksLeft - 1 : 0;
+
+  if (i->repUsedValue() == 2) {
+    // REPNE: skip the bytes not equal to AL
+    if (BX_CPU_THIS_PTR get_DF()) {
+      for (n=0; n<count; n++, hostAddrDst--)
+        if (*hostAddrDst == val) break;
+    }
+    else {
+      Bit8u *found = (Bit8u*) memchr(hostAddrDst, val, count);
+      n = found ? (Bit32u)(found - hostAddrDst) : count;
+    }
+  }
+  else {
+    // REPE: skip the bytes equal to AL
+    signed int pointerDelta = BX_CPU_THIS_PTR get_DF() ? -1 : 1;
+    for (n=0; n<count; n++, hostAddrDst += pointerDelta)
+      if (*hostAddrDst != val) break;
+  }
+
+  return n;
+}
+
+Bit32u BX_CPU_C::FastRepCMPSB(bxInstruction_c *i, unsigned srcSeg, bx_address srcOff, bx_address dstOff, Bit32u count)
+{
+  Bit32u bytesFitSrc, bytesFitDst, ticksLeft, n;
+  signed int pointerDelta;
+  bx_address laddrDst, laddrSrc;
+  Bit8u *hostAddrSrc, *hostAddrDst;
+
+  // no segment limits in 64-bit mode
+  if (BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64) {
+    bx_segment_reg_t *srcSegPtr = &BX_CPU_THIS_PTR sregs[srcSeg];
+    if (!(srcSegPtr->cache.valid & SegAccessROK))
+      return 0;
+    if ((srcOff | 0xfff) > srcSegPtr->cache.u.segment.limit_scaled)
+      return 0;
+
+    bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[BX_SEG_REG_ES];
+    if (!(dstSegPtr->cache.valid & SegAccessROK))
+      return 0;
+    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
+      return 0;
+  }
+
+  laddrSrc = BX_CPU_THIS_PTR get_laddr(srcSeg, srcOff);
+
+  hostAddrSrc = v2h_read_byte(laddrSrc, BX_CPU_THIS_PTR user_pl);
+  if (! hostAddrSrc) return 0;
+
+  laddrDst = BX_CPU_THIS_PTR get_laddr(BX_SEG_REG_ES, dstOff);
+
+  hostAddrDst = v2h_read_byte(laddrDst, BX_CPU_THIS_PTR user_pl);
+  if (! hostAddrDst) return 0;
+
+  // See how many bytes can be compared in the rest of these pages.
+  if (BX_CPU_THIS_PTR get_DF()) {
+    bytesFitSrc = 1 + PAGE_OFFSET(laddrSrc);
+    bytesFitDst = 1 + PAGE_OFFSET(laddrDst);
+    pointerDelta = (signed int) -1;
+  }
+  else {
+    bytesFitSrc = 0x1000 - PAGE_OFFSET(laddrSrc);
+    bytesFitDst = 0x1000 - PAGE_OFFSET(laddrDst);
+    pointerDelta = (signed int)  1;
+  }
+
+  count--;
+  if (count > bytesFitSrc)
+    count = bytesFitSrc;
+  if (count > bytesFitDst)
+    count = bytesFitDst;
+  // the caller ticks once more for the byte compared after the batch
+  ticksLeft = bx_pc_system.getNumCpuTicksLeftNextEvent();
+  if (count >= ticksLeft)
+    count = ticksLeft ? ticksLeft - 1 : 0;
+
+  if (i->repUsedValue() == 2) {
+    // REPNE: skip the bytes which differ
+    for (n=0; n<count; n++, hostAddrSrc += pointerDelta, hostAddrDst += pointerDelta)
+      if (*hostAddrSrc == *hostAddrDst) break;
+  }
+  else {
+    // REPE: skip the bytes which are equal
+    if (pointerDelta > 0 && ! memcmp(hostAddrSrc, hostAddrDst, count))
+      return count;
+    for (n=0; n<count; n++, hostAddrSrc += pointerDelta, hostAddrDst += pointerDelta)
+      if (*hostAddrSrc != *hostAddrDst) break;
+  }
+
+  return n;
+}
 #endif
 
 //
@@ -564,21 +817,45 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MOVSB64_XbYb(bxInstruction_c *i)
 {
   Bit8u temp8;
 
+  Bit64u incr = 1;
+
   Bit64u rsi = RSI;
   Bit64u rdi = RDI;
 
-  temp8 = read_virtual_byte_64(i->seg(), rsi);
-  write_virtual_byte_64(BX_SEG_REG_ES, rdi, temp8);
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u byteCount = FastRepMOVSB(i, i->seg(), rsi, BX_SEG_REG_ES, rdi, BX_REP_COUNT64);
+    if (byteCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the main cpu loop will decrement one.
+      BX_TICKN(byteCount-1);
+      RCX -= byteCount-1;
+
+      incr = byteCount;
+    }
+    else {
+      temp8 = read_virtual_byte_64(i->seg(), rsi);
+      write_virtual_byte_64(BX_SEG_REG_ES, rdi, temp8);
+    }
+  }
+  else
+#endif
+  {
+    temp8 = read_virtual_byte_64(i->seg(), rsi);
+    write_virtual_byte_64(BX_SEG_REG_ES, rdi, temp8);
+  }
 
   if (BX_CPU_THIS_PTR get_DF()) {
-    /* decrement RSI, RDI */
-    rsi--;
-    rdi--;
+    rsi -= incr;
+    rdi -= incr;
   }
   else {
-    /* increment RSI, RDI */
-    rsi++;
-    rdi++;
+    rsi += incr;
+    rdi += incr;
   }
 
   RSI = rsi;
@@ -748,19 +1025,45 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MOVSD64_XdYd(bxInstruction_c *i)
 {
   Bit32u temp32;
 
+  Bit64u incr = 4;
+
   Bit64u rsi = RSI;
   Bit64u rdi = RDI;
 
-  temp32 = read_virtual_dword_64(i->seg(), rsi);
-  write_virtual_dword_64(BX_SEG_REG_ES, rdi, temp32);
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u dwordCount = FastRepMOVSD(i, i->seg(), rsi, BX_SEG_REG_ES, rdi, BX_REP_COUNT64);
+    if (dwordCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the main cpu loop will decrement one.
+      BX_TICKN(dwordCount-1);
+      RCX -= dwordCount-1;
+
+      incr = dwordCount << 2;
+    }
+    else {
+      temp32 = read_virtual_dword_64(i->seg(), rsi);
+      write_virtual_dword_64(BX_SEG_REG_ES, rdi, temp32);
+    }
+  }
+  else
+#endif
+  {
+    temp32 = read_virtual_dword_64(i->seg(), rsi);
+    write_virtual_dword_64(BX_SEG_REG_ES, rdi, temp32);
+  }
 
   if (BX_CPU_THIS_PTR get_DF()) {
-    rsi -= 4;
-    rdi -= 4;
+    rsi -= incr;
+    rdi -= incr;
   }
   else {
-    rsi += 4;
-    rdi += 4;
+    rsi += incr;
+    rdi += incr;
   }
 
   RSI = rsi;
@@ -772,19 +1075,45 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MOVSQ32_XqYq(bxInstruction_c *i)
 {
   Bit64u temp64;
 
+  Bit32u incr = 8;
+
   Bit32u esi = ESI;
   Bit32u edi = EDI;
 
-  temp64 = read_virtual_qword_64(i->seg(), esi);
-  write_virtual_qword_64(BX_SEG_REG_ES, edi, temp64);
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u qwordCount = FastRepMOVSQ(i, i->seg(), esi, BX_SEG_REG_ES, edi, ECX);
+    if (qwordCount) {
+      // Decrement the ticks count and eCX by the number of iterations,
+      // minus one, since the main cpu loop will decrement one.
+      BX_TICKN(qwordCount-1);
+      RCX = ECX - (qwordCount-1);
+
+      incr = qwordCount << 3;
+    }
+    else {
+      temp64 = read_virtual_qword_64(i->seg(), esi);
+      write_virtual_qword_64(BX_SEG_REG_ES, edi, temp64);
+    }
+  }
+  else
+#endif
+  {
+    temp64 = read_virtual_qword_64(i->seg(), esi);
+    write_virtual_qword_64(BX_SEG_REG_ES, edi, temp64);
+  }
 
   if (BX_CPU_THIS_PTR get_DF()) {
-    esi -= 8;
-    edi -= 8;
+    esi -= incr;
+    edi -= incr;
   }
   else {
-    esi += 8;
-    edi += 8;
+    esi += incr;
+    edi += incr;
   }
 
   // zero extension of RSI/RDI
@@ -797,19 +1126,45 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MOVSQ64_XqYq(bxInstruction_c *i)
 {
   Bit64u temp64;
 
+  Bit64u incr = 8;
+
   Bit64u rsi = RSI;
   Bit64u rdi = RDI;
 
-  temp64 = read_virtual_qword_64(i->seg(), rsi);
-  write_virtual_qword_64(BX_SEG_REG_ES, rdi, temp64);
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u qwordCount = FastRepMOVSQ(i, i->seg(), rsi, BX_SEG_REG_ES, rdi, BX_REP_COUNT64);
+    if (qwordCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the main cpu loop will decrement one.
+      BX_TICKN(qwordCount-1);
+      RCX -= qwordCount-1;
+
+      incr = qwordCount << 3;
+    }
+    else {
+      temp64 = read_virtual_qword_64(i->seg(), rsi);
+      write_virtual_qword_64(BX_SEG_REG_ES, rdi, temp64);
+    }
+  }
+  else
+#endif
+  {
+    temp64 = read_virtual_qword_64(i->seg(), rsi);
+    write_virtual_qword_64(BX_SEG_REG_ES, rdi, temp64);
+  }
 
   if (BX_CPU_THIS_PTR get_DF()) {
-    rsi -= 8;
-    rdi -= 8;
+    rsi -= incr;
+    rdi -= incr;
   }
   else {
-    rsi += 8;
-    rdi += 8;
+    rsi += incr;
+    rdi += incr;
   }
 
   RSI = rsi;
@@ -930,6 +1285,31 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPSB32_XbYb(bxInstruction_c *i)
   Bit32u esi = ESI;
   Bit32u edi = EDI;
 
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip the bytes which do not end
+   * the repeat in a batch, the last one is compared below.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u byteCount = FastRepCMPSB(i, i->seg(), esi, edi, ECX);
+    if (byteCount) {
+      // the main cpu loop decrements the ticks count and eCX for the
+      // byte compared below
+      BX_TICKN(byteCount);
+      RCX = ECX - byteCount;
+
+      if (BX_CPU_THIS_PTR get_DF()) {
+        esi -= byteCount;
+        edi -= byteCount;
+      }
+      else {
+        esi += byteCount;
+        edi += byteCount;
+      }
+    }
+  }
+#endif
+
   op1_8 = read_virtual_byte(i->seg(), esi);
   op2_8 = read_virtual_byte(BX_SEG_REG_ES, edi);
 
@@ -960,6 +1340,31 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPSB64_XbYb(bxInstruction_c *i)
   Bit64u rsi = RSI;
   Bit64u rdi = RDI;
 
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip the bytes which do not end
+   * the repeat in a batch, the last one is compared below.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u byteCount = FastRepCMPSB(i, i->seg(), rsi, rdi, BX_REP_COUNT64);
+    if (byteCount) {
+      // the main cpu loop decrements the ticks count and RCX for the
+      // byte compared below
+      BX_TICKN(byteCount);
+      RCX -= byteCount;
+
+      if (BX_CPU_THIS_PTR get_DF()) {
+        rsi -= byteCount;
+        rdi -= byteCount;
+      }
+      else {
+        rsi += byteCount;
+        rdi += byteCount;
+      }
+    }
+  }
+#endif
+
   op1_8 = read_virtual_byte_64(i->seg(), rsi);
   op2_8 = read_virtual_byte_64(BX_SEG_REG_ES, rdi);
 
@@ -1316,6 +1721,29 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SCASB32_ALXb(bxInstruction_c *i)
 
   Bit32u edi = EDI;
 
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip the bytes which do not end
+   * the repeat in a batch, the last one is compared below.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u byteCount = FastRepSCASB(i, edi, op1_8, ECX);
+    if (byteCount) {
+      // the main cpu loop decrements the ticks count and eCX for the
+      // byte compared below
+      BX_TICKN(byteCount);
+      RCX = ECX - byteCount;
+
+      if (BX_CPU_THIS_PTR get_DF()) {
+        edi -= byteCount;
+      }
+      else {
+        edi += byteCount;
+      }
+    }
+  }
+#endif
+
   op2_8 = read_virtual_byte(BX_SEG_REG_ES, edi);
   diff_8 = op1_8 - op2_8;
 
@@ -1340,6 +1768,29 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SCASB64_ALXb(bxInstruction_c *i)
 
   Bit64u rdi = RDI;
 
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip the bytes which do not end
+   * the repeat in a batch, the last one is compared below.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u byteCount = FastRepSCASB(i, rdi, op1_8, BX_REP_COUNT64);
+    if (byteCount) {
+      // the main cpu loop decrements the ticks count and RCX for the
+      // byte compared below
+      BX_TICKN(byteCount);
+      RCX -= byteCount;
+
+      if (BX_CPU_THIS_PTR get_DF()) {
+        rdi -= byteCount;
+      }
+      else {
+        rdi += byteCount;
+      }
+    }
+  }
+#endif
+
   op2_8 = read_virtual_byte_64(BX_SEG_REG_ES, rdi);
 
   diff_8 = op1_8 - op2_8;
@@ -1683,15 +2134,39 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSB32_YbAL(bxInstruction_c *i)
 // 64 bit address size
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSB64_YbAL(bxInstruction_c *i)
 {
+  Bit64u incr = 1;
   Bit64u rdi = RDI;
 
-  write_virtual_byte_64(BX_SEG_REG_ES, rdi, AL);
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u byteCount = FastRepSTOSB(i, BX_SEG_REG_ES, rdi, AL, BX_REP_COUNT64);
+    if (byteCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the main cpu loop will decrement one.
+      BX_TICKN(byteCount-1);
+      RCX -= byteCount-1;
+
+      incr = byteCount;
+    }
+    else {
+      write_virtual_byte_64(BX_SEG_REG_ES, rdi, AL);
+    }
+  }
+  else
+#endif
+  {
+    write_virtual_byte_64(BX_SEG_REG_ES, rdi, AL);
+  }
 
   if (BX_CPU_THIS_PTR get_DF()) {
-    rdi--;
+    rdi -= incr;
   }
   else {
-    rdi++;
+    rdi += incr;
   }
 
   RDI = rdi;
@@ -1772,15 +2247,39 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSD16_YdEAX(bxInstruction_c *i)
 /* 32 bit opsize mode, 32 bit address size */
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSD32_YdEAX(bxInstruction_c *i)
 {
+  Bit32u incr = 4;
   Bit32u edi = EDI;
 
-  write_virtual_dword(BX_SEG_REG_ES, edi, EAX);
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u dwordCount = FastRepSTOSD(i, BX_SEG_REG_ES, edi, EAX, ECX);
+    if (dwordCount) {
+      // Decrement the ticks count and eCX by the number of iterations,
+      // minus one, since the main cpu loop will decrement one.
+      BX_TICKN(dwordCount-1);
+      RCX = ECX - (dwordCount-1);
+
+      incr = dwordCount << 2;
+    }
+    else {
+      write_virtual_dword(BX_SEG_REG_ES, edi, EAX);
+    }
+  }
+  else
+#endif
+  {
+    write_virtual_dword(BX_SEG_REG_ES, edi, EAX);
+  }
 
   if (BX_CPU_THIS_PTR get_DF()) {
-    edi -= 4;
+    edi -= incr;
   }
   else {
-    edi += 4;
+    edi += incr;
   }
 
   // zero extension of RDI
@@ -1792,15 +2291,39 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSD32_YdEAX(bxInstruction_c *i)
 /* 32 bit opsize mode, 32 bit address size */
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSD64_YdEAX(bxInstruction_c *i)
 {
+  Bit64u incr = 4;
   Bit64u rdi = RDI;
 
-  write_virtual_dword_64(BX_SEG_REG_ES, rdi, EAX);
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u dwordCount = FastRepSTOSD(i, BX_SEG_REG_ES, rdi, EAX, BX_REP_COUNT64);
+    if (dwordCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the main cpu loop will decrement one.
+      BX_TICKN(dwordCount-1);
+      RCX -= dwordCount-1;
+
+      incr = dwordCount << 2;
+    }
+    else {
+      write_virtual_dword_64(BX_SEG_REG_ES, rdi, EAX);
+    }
+  }
+  else
+#endif
+  {
+    write_virtual_dword_64(BX_SEG_REG_ES, rdi, EAX);
+  }
 
   if (BX_CPU_THIS_PTR get_DF()) {
-    rdi -= 4;
+    rdi -= incr;
   }
   else {
-    rdi += 4;
+    rdi += incr;
   }
 
   RDI = rdi;
@@ -1809,15 +2332,39 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSD64_YdEAX(bxInstruction_c *i)
 /* 64 bit opsize mode, 32 bit address size */
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSQ32_YqRAX(bxInstruction_c *i)
 {
+  Bit32u incr = 8;
   Bit32u edi = EDI;
 
-  write_virtual_qword_64(BX_SEG_REG_ES, edi, RAX);
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u qwordCount = FastRepSTOSQ(i, BX_SEG_REG_ES, edi, RAX, ECX);
+    if (qwordCount) {
+      // Decrement the ticks count and eCX by the number of iterations,
+      // minus one, since the main cpu loop will decrement one.
+      BX_TICKN(qwordCount-1);
+      RCX = ECX - (qwordCount-1);
+
+      incr = qwordCount << 3;
+    }
+    else {
+      write_virtual_qword_64(BX_SEG_REG_ES, edi, RAX);
+    }
+  }
+  else
+#endif
+  {
+    write_virtual_qword_64(BX_SEG_REG_ES, edi, RAX);
+  }
 
   if (BX_CPU_THIS_PTR get_DF()) {
-    edi -= 8;
+    edi -= incr;
   }
   else {
-    edi += 8;
+    edi += incr;
   }
 
   // zero extension of RDI
@@ -1827,15 +2374,39 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSQ32_YqRAX(bxInstruction_c *i)
 /* 64 bit opsize mode, 64 bit address size */
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSQ64_YqRAX(bxInstruction_c *i)
 {
+  Bit64u incr = 8;
   Bit64u rdi = RDI;
 
-  write_virtual_qword_64(BX_SEG_REG_ES, rdi, RAX);
+#if (BX_SupportRepeatSpeedups) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u qwordCount = FastRepSTOSQ(i, BX_SEG_REG_ES, rdi, RAX, BX_REP_COUNT64);
+    if (qwordCount) {
+      // Decrement the ticks count and RCX by the number of iterations,
+      // minus one, since the main cpu loop will decrement one.
+      BX_TICKN(qwordCount-1);
+      RCX -= qwordCount-1;
+
+      incr = qwordCount << 3;
+    }
+    else {
+      write_virtual_qword_64(BX_SEG_REG_ES, rdi, RAX);
+    }
+  }
+  else
+#endif
+  {
+    write_virtual_qword_64(BX_SEG_REG_ES, rdi, RAX);
+  }
 
   if (BX_CPU_THIS_PTR get_DF()) {
-    rdi -= 8;
+    rdi -= incr;
   }
   else {
-    rdi += 8;
+    rdi += incr;
   }
 
   RDI = rdi;
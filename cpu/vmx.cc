@@ -125,6 +125,7 @@ void BX_CPU_C::VMwrite16(unsigned encoding, Bit16u val_16)
   if (BX_CPU_THIS_PTR vmcshostptr) {
     Bit16u *hostAddr = (Bit16u*) (BX_CPU_THIS_PTR vmcshostptr | offset);
     pageWriteStampTable.decWriteStamp(pAddr);
+    BX_MEM(0)->set_page_dirty((Bit8u*) hostAddr);
     WriteHostWordToLittleEndian(hostAddr, val_16);
   }
   else {
@@ -167,6 +168,7 @@ void BX_CPU_C::VMwrite32(unsigned encoding, Bit32u val_32)
   if (BX_CPU_THIS_PTR vmcshostptr) {
     Bit32u *hostAddr = (Bit32u*) (BX_CPU_THIS_PTR vmcshostptr | offset);
     pageWriteStampTable.decWriteStamp(pAddr);
+    BX_MEM(0)->set_page_dirty((Bit8u*) hostAddr);
     WriteHostDWordToLittleEndian(hostAddr, val_32);
   }
   else {
@@ -213,6 +215,7 @@ void BX_CPU_C::VMwrite64(unsigned encoding, Bit64u val_64)
   if (BX_CPU_THIS_PTR vmcshostptr) {
     Bit64u *hostAddr = (Bit64u*) (BX_CPU_THIS_PTR vmcshostptr | offset);
     pageWriteStampTable.decWriteStamp(pAddr);
+    BX_MEM(0)->set_page_dirty((Bit8u*) hostAddr);
     WriteHostQWordToLittleEndian(hostAddr, val_64);
   }
   else {
@@ -2166,7 +2169,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::VMXON(bxInstruction_c *i)
       exception(BX_GP_EXCEPTION, 0);
     }
 
-    bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+    bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
     Bit64u pAddr = read_virtual_qword(i->seg(), eaddr); // keep 64-bit
     if ((pAddr & 0xfff) != 0 || ! IsValidPhyAddr(pAddr)) {
       BX_ERROR(("VMXON: invalid or not page aligned physical address !"));
@@ -2506,7 +2509,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::VMPTRLD(bxInstruction_c *i)
     exception(BX_GP_EXCEPTION, 0);
   }
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   Bit64u pAddr = read_virtual_qword(i->seg(), eaddr); // keep 64-bit
   if ((pAddr & 0xfff) != 0 || ! IsValidPhyAddr(pAddr)) {
     BX_ERROR(("VMFAIL: invalid or not page aligned physical address !"));
@@ -2551,7 +2554,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::VMPTRST(bxInstruction_c *i)
     exception(BX_GP_EXCEPTION, 0);
   }
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   write_virtual_qword(i->seg(), eaddr, BX_CPU_THIS_PTR vmcsptr);
   VMsucceed();
 #else         
@@ -2864,7 +2867,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::VMREAD(bxInstruction_c *i)
        BX_WRITE_64BIT_REG(i->rm(), field_64);
     }
     else {
-       Bit64u eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+       Bit64u eaddr = BX_CPU_RESOLVE_ADDR(i);
        write_virtual_qword_64(i->seg(), eaddr, field_64);
     }
   }
@@ -2877,7 +2880,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::VMREAD(bxInstruction_c *i)
        BX_WRITE_32BIT_REGZ(i->rm(), field_32);
     }
     else {
-       Bit32u eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+       Bit32u eaddr = BX_CPU_RESOLVE_ADDR(i);
        write_virtual_dword_32(i->seg(), eaddr, field_32);
     }
   }
@@ -2923,7 +2926,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::VMWRITE(bxInstruction_c *i)
        val_64 = BX_READ_64BIT_REG(i->rm());
     }
     else {
-       Bit64u eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+       Bit64u eaddr = BX_CPU_RESOLVE_ADDR(i);
        val_64 = read_virtual_qword_64(i->seg(), eaddr);
     }
 
@@ -2943,7 +2946,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::VMWRITE(bxInstruction_c *i)
        val_32 = BX_READ_32BIT_REG(i->rm());
     }
     else {
-       Bit32u eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+       Bit32u eaddr = BX_CPU_RESOLVE_ADDR(i);
        val_32 = read_virtual_dword_32(i->seg(), eaddr);
     }
 
@@ -3232,7 +3235,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::VMCLEAR(bxInstruction_c *i)
     exception(BX_GP_EXCEPTION, 0);
   }
 
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   Bit64u pAddr = read_virtual_qword(i->seg(), eaddr); // keep 64-bit
   if ((pAddr & 0xfff) != 0 || ! IsValidPhyAddr(pAddr)) {
     BX_ERROR(("VMFAIL: VMCLEAR with invalid physical address!"));
@@ -3298,7 +3301,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INVEPT(bxInstruction_c *i)
   }
 
   BxPackedXmmRegister inv_eptp;
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   read_virtual_dqword(i->seg(), eaddr, (Bit8u *) &inv_eptp);
 
   switch(type) {
@@ -3359,7 +3362,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INVVPID(bxInstruction_c *i)
   }
 
   BxPackedXmmRegister invvpid_desc;
-  bx_address eaddr = BX_CPU_CALL_METHODR(i->ResolveModrm, (i));
+  bx_address eaddr = BX_CPU_RESOLVE_ADDR(i);
   read_virtual_dqword(i->seg(), eaddr, (Bit8u *) &invvpid_desc);
 
   if (invvpid_desc.xmm64u(0) > 0xffff) {
@@ -2540,6 +2540,128 @@ static floatx80 subFloatx80Sigs(floatx80 a, floatx80 b, int zSign, float_status_
             zSign, zExp, zSig0, zSig1, status);
 }
 
+#if BX_SUPPORT_HOST_X87
+
+/*----------------------------------------------------------------------------
+| Host x87 fast path for the division and the square root, by far the most
+| expensive operations in software. The host FPU, run with the precision and
+| rounding control of the guest, returns the same result as the software
+| implementation. Its sticky exception flags are not used: clearing them on
+| every instruction costs more than the division itself on some hosts. The
+| operands must be normal numbers and the result must be far enough from the
+| limits of the exponent range, then the only possible exception is the
+| inexact one, which is found from C1 (the last operation rounded up in
+| magnitude), if needed after a second operation rounding away from zero.
+| Anything else is left to the software implementation.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int host_x87_normal(floatx80 a)
+{
+    Bit32s aExp = extractFloatx80Exp(a);
+    return aExp != 0 && aExp != 0x7FFF && (extractFloatx80Frac(a) & BX_CONST64(0x8000000000000000));
+}
+
+BX_CPP_INLINE Bit16u host_x87_control_word(int rounding_mode, float_status_t &status)
+{
+    Bit16u cw = 0x3f | (rounding_mode << 10);
+    int precision = get_float_rounding_precision(status);
+    if (precision == 64) cw |= 0x200;
+    else if (precision != 32) cw |= 0x300;
+    return cw;
+}
+
+// z = a / b or z = sqrt(a) with the given control word, returns the host
+// status word read before the store (which clears C1)
+BX_CPP_INLINE Bit16u host_x87_div_op(floatx80 a, floatx80 b, floatx80 &z, Bit16u cw)
+{
+    Bit16u host_cw, sw;
+    __asm__ __volatile__(
+        "fnstcw %1\n\t"
+        "fldcw %3\n\t"
+        "fldt %5\n\t"
+        "fldt %4\n\t"
+        "fdivp\n\t"
+        "fnstsw %2\n\t"
+        "fstpt %0\n\t"
+        "fldcw %1"
+        : "=m" (z), "=m" (host_cw), "=m" (sw)
+        : "m" (cw), "m" (a), "m" (b)
+        : "st", "st(1)");
+    return sw;
+}
+
+BX_CPP_INLINE Bit16u host_x87_sqrt_op(floatx80 a, floatx80 &z, Bit16u cw)
+{
+    Bit16u host_cw, sw;
+    __asm__ __volatile__(
+        "fnstcw %1\n\t"
+        "fldcw %3\n\t"
+        "fldt %4\n\t"
+        "fsqrt\n\t"
+        "fnstsw %2\n\t"
+        "fstpt %0\n\t"
+        "fldcw %1"
+        : "=m" (z), "=m" (host_cw), "=m" (sw)
+        : "m" (cw), "m" (a)
+        : "st");
+    return sw;
+}
+
+#define HOST_X87_C1 0x0200
+
+// returns 0 if the result must be computed by the software implementation
+BX_CPP_INLINE int host_x87_result(floatx80 &z, Bit16u sw, float_status_t &status)
+{
+    Bit32s zExp = extractFloatx80Exp(z);
+    if (zExp < 2 || zExp > 0x7FFD) return 0;
+    if (sw & HOST_X87_C1) set_float_rounding_up(status);
+    return 1;
+}
+
+// rounding mode of a second operation which rounds up in magnitude if the
+// result is inexact, or -1 if the first one already did
+BX_CPP_INLINE int host_x87_inexact_check_mode(floatx80 z, float_status_t &status)
+{
+    int mode = extractFloatx80Sign(z) ? float_round_down : float_round_up;
+    return (get_float_rounding_mode(status) == mode) ? -1 : mode;
+}
+
+static int host_x87_div(floatx80 a, floatx80 b, floatx80 &z, float_status_t &status)
+{
+    if (status.float_exception_masks != 0x3f ||
+        ! host_x87_normal(a) || ! host_x87_normal(b)) return 0;
+
+    Bit16u sw = host_x87_div_op(a, b, z,
+        host_x87_control_word(get_float_rounding_mode(status), status));
+    if (! host_x87_result(z, sw, status)) return 0;
+    if (! (sw & HOST_X87_C1)) {
+        int mode = host_x87_inexact_check_mode(z, status);
+        floatx80 t;
+        if (mode >= 0 && (host_x87_div_op(a, b, t, host_x87_control_word(mode, status)) & HOST_X87_C1))
+            float_raise(status, float_flag_inexact);
+    }
+    return 1;
+}
+
+static int host_x87_sqrt(floatx80 a, floatx80 &z, float_status_t &status)
+{
+    if (status.float_exception_masks != 0x3f ||
+        ! host_x87_normal(a) || extractFloatx80Sign(a)) return 0;
+
+    Bit16u sw = host_x87_sqrt_op(a, z,
+        host_x87_control_word(get_float_rounding_mode(status), status));
+    if (! host_x87_result(z, sw, status)) return 0;
+    if (! (sw & HOST_X87_C1)) {
+        int mode = host_x87_inexact_check_mode(z, status);
+        floatx80 t;
+        if (mode >= 0 && (host_x87_sqrt_op(a, t, host_x87_control_word(mode, status)) & HOST_X87_C1))
+            float_raise(status, float_flag_inexact);
+    }
+    return 1;
+}
+
+#endif
+
 /*----------------------------------------------------------------------------
 | Returns the result of adding the extended double-precision floating-point
 | values `a' and `b'.  The operation is performed according to the IEC/IEEE
@@ -2652,6 +2774,11 @@ floatx80 floatx80_mul(floatx80 a, floatx80 b, float_status_t &status)
 
 floatx80 floatx80_div(floatx80 a, floatx80 b, float_status_t &status)
 {
+#if BX_SUPPORT_HOST_X87
+    floatx80 z;
+    if (host_x87_div(a, b, z, status)) return z;
+#endif
+
     int aSign, bSign, zSign;
     Bit32s aExp, bExp, zExp;
     Bit64u aSig, bSig, zSig0, zSig1;
@@ -2740,6 +2867,11 @@ floatx80 floatx80_div(floatx80 a, floatx80 b, float_status_t &status)
 
 floatx80 floatx80_sqrt(floatx80 a, float_status_t &status)
 {
+#if BX_SUPPORT_HOST_X87
+    floatx80 z;
+    if (host_x87_sqrt(a, z, status)) return z;
+#endif
+
     int aSign;
     Bit32s aExp, zExp;
     Bit64u aSig0, aSig1, zSig0, zSig1, doubleZSig0;
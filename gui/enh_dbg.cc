@@ -695,7 +695,7 @@ void ParseBkpt()
     int k;
     int j = 0;
     int i = bx_guard.iaddr.num_linear;
-    while (--i >= 0)
+    while (--i >= 0 && j < BX_DBG_MAX_LIN_BPOINTS)
     {
         if (bx_guard.iaddr.lin[i].enabled != FALSE)
         {
@@ -2679,6 +2679,7 @@ void SetWatchpoint(unsigned *num_watchpoints, bx_watchpoint *watchpoint)
             ++(*num_watchpoints);
         }
     }
+    bx_dbg_watchpoints_changed();
     Invalidate(DUMP_WND);   // redraw the MemDump window -- colors may have changed
 }
 
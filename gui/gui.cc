@@ -629,7 +629,11 @@ void bx_gui_c::save_restore_handler(void)
                             "Save Bochs state to folder...", "none",
                             bx_param_string_c::SELECT_FOLDER_DLG);
     if ((ret >= 0) && (strcmp(sr_path, "none"))) {
-      if (SIM->save_state(sr_path)) {
+      if (SIM->get_param_bool(BXPN_SAVE_LIVE)->get()) {
+        // the simulation goes on while the state is written
+        SIM->save_state_live(sr_path);
+      }
+      else if (SIM->save_state(sr_path)) {
         if (!SIM->ask_yes_no("WARNING",
               "The save function currently doesn't handle the state of hard drive images,\n"
               "so we don't recommend to continue, unless you are running a read-only\n"
@@ -52,6 +52,33 @@ typedef struct _user_option_t {
   struct _user_option_t *next;
 } user_option_t;
 
+typedef struct {
+  Bit8u *data;
+  Bit32u len, size;
+} bx_sr_buffer_t;
+
+// Binary format of the bochs root subtree files. The data blobs follow
+// the header page at page aligned offsets, the index of the subtree comes
+// last. An index record is the type and the name of a parameter followed
+// by its value: a Bit64s for numbers, the length and the bytes of strings,
+// the number of children of lists and the offset and size of the data
+// blob. Data saved by a custom handler has the blob offset 0.
+#define BX_SR_BINARY_MAGIC "BXSRBIN1"
+#define BX_SR_BINARY_ALIGN 4096
+
+typedef struct {
+  char   magic[8];
+  Bit64u index_offset;
+  Bit32u index_len;
+  Bit32u reserved;
+} bx_sr_binary_header_t;
+
+// values of a bochs root subtree at the last incremental save
+typedef struct {
+  bx_param_c *param;
+  bx_sr_buffer_t buf;
+} bx_sr_snapshot_t;
+
 class bx_real_sim_c : public bx_simulator_interface_c {
   bxevent_handler bxevent_callback;
   void *bxevent_callback_data;
@@ -66,6 +93,10 @@ class bx_real_sim_c : public bx_simulator_interface_c {
   int exit_code;
   unsigned param_id;
   bx_bool wx_debug_gui;
+  // last saved or restored checkpoint, the parent of an incremental save
+  char sr_parent[BX_PATHNAME_LEN];
+  int sr_num_snapshots;
+  bx_sr_snapshot_t *sr_snapshot;
 public:
   bx_real_sim_c();
   virtual ~bx_real_sim_c() {}
@@ -168,6 +199,7 @@ public:
   // save/restore support
   virtual void init_save_restore();
   virtual bx_bool save_state(const char *checkpoint_path);
+  virtual bx_bool save_state_live(const char *checkpoint_path);
   virtual bx_bool restore_config();
   virtual bx_bool restore_logopts();
   virtual bx_bool restore_hardware();
@@ -178,6 +210,14 @@ public:
 
 private:
   bx_bool save_sr_param(FILE *fp, bx_param_c *node, const char *sr_path, int level);
+  bx_bool save_sr_binary(FILE *fp, bx_param_c *node, const char *sr_path, bx_sr_buffer_t *index, Bit64u *offset);
+  bx_bool restore_sr_binary(FILE *fp, bx_list_c *base, int hint, const char *sr_path,
+                            const Bit8u *index, Bit32u len, Bit32u *pos);
+  bx_bool snapshot_sr_param(bx_param_c *node, bx_sr_buffer_t *snap);
+  void free_sr_snapshots();
+  bx_bool find_sr_checkpoint(const char *checkpoint_path, const char *name, char *sr_path);
+  bx_bool read_sr_parent(const char *checkpoint_path, char *parent);
+  bx_bool sr_parent_chain_has(const char *checkpoint_path);
 };
 
 #if BX_DEBUGGER && BX_DEBUGGER_GUI
@@ -317,6 +357,9 @@ bx_real_sim_c::bx_real_sim_c()
   exit_code = 0;
   param_id = BXP_NEW_PARAM_ID;
   user_options = NULL;
+  sr_parent[0] = 0;
+  sr_num_snapshots = 0;
+  sr_snapshot = NULL;
 }
 
 void bx_real_sim_c::reset_all_param()
@@ -893,6 +936,8 @@ void bx_real_sim_c::init_save_restore()
 {
   bx_list_c *list;
 
+  free_sr_snapshots();
+
   if ((list = get_bochs_root()) != NULL) {
     list->clear();
   } else {
@@ -903,6 +948,16 @@ void bx_real_sim_c::init_save_restore()
   }
 }
 
+void bx_real_sim_c::free_sr_snapshots()
+{
+  for (int i = 0; i < sr_num_snapshots; i++) {
+    if (sr_snapshot[i].buf.data != NULL) free(sr_snapshot[i].buf.data);
+  }
+  delete [] sr_snapshot;
+  sr_snapshot = NULL;
+  sr_num_snapshots = 0;
+}
+
 bx_bool bx_real_sim_c::save_state(const char *checkpoint_path)
 {
   char sr_file[BX_PATHNAME_LEN];
@@ -910,6 +965,10 @@ bx_bool bx_real_sim_c::save_state(const char *checkpoint_path)
   int i, dev, ndev = SIM->get_n_log_modules();
   int type, ntype = SIM->get_max_log_level();
 
+  if (sr_parent_chain_has(checkpoint_path)) {
+    BX_ERROR(("save_state(): '%s' is a parent of the checkpoint '%s'", checkpoint_path, sr_parent));
+    return 0;
+  }
   sprintf(sr_file, "%s/config", checkpoint_path);
   if (write_rc(sr_file, 1) < 0)
     return 0;
@@ -935,21 +994,103 @@ bx_bool bx_real_sim_c::save_state(const char *checkpoint_path)
   } else {
     return 0;
   }
+  // an incremental checkpoint only has the subtrees changed since the
+  // parent checkpoint, the others are found by following the parents
+  bx_bool incremental = get_param_bool(BXPN_SAVE_INCREMENTAL)->get() &&
+                        (sr_parent[0] != 0) && strcmp(sr_parent, checkpoint_path);
+  sprintf(sr_file, "%s/parent", checkpoint_path);
+  if (incremental) {
+    fp = fopen(sr_file, "w");
+    if (fp == NULL)
+      return 0;
+    fprintf(fp, "%s\n", sr_parent);
+    fclose(fp);
+  } else {
+    remove(sr_file);
+  }
   bx_list_c *sr_list = get_bochs_root();
   ndev = sr_list->get_size();
+  if (get_param_bool(BXPN_SAVE_INCREMENTAL)->get() && (sr_num_snapshots != ndev)) {
+    free_sr_snapshots();
+    sr_snapshot = new bx_sr_snapshot_t[ndev];
+    memset(sr_snapshot, 0, ndev * sizeof(bx_sr_snapshot_t));
+    sr_num_snapshots = ndev;
+  }
   for (dev=0; dev<ndev; dev++) {
     sprintf(sr_file, "%s/%s", checkpoint_path, sr_list->get(dev)->get_name());
+    if (get_param_bool(BXPN_SAVE_INCREMENTAL)->get()) {
+      bx_sr_snapshot_t snap;
+      memset(&snap, 0, sizeof(snap));
+      snap.param = sr_list->get(dev);
+      bx_bool complete = snapshot_sr_param(snap.param, &snap.buf);
+      bx_sr_snapshot_t *prev = &sr_snapshot[dev];
+      bx_bool unchanged = complete && (prev->param == snap.param) && (prev->buf.len == snap.buf.len) &&
+                          !memcmp(prev->buf.data, snap.buf.data, snap.buf.len);
+      if (prev->buf.data != NULL) free(prev->buf.data);
+      *prev = snap;
+      if (! complete) prev->param = NULL;
+      if (incremental && unchanged) {
+        remove(sr_file);
+        continue;
+      }
+    }
+    if (get_param_bool(BXPN_SAVE_BINARY)->get()) {
+      fp = fopen(sr_file, "wb");
+      if (fp == NULL)
+        return 0;
+      // the data blobs start after the header page, the index follows them
+      bx_sr_buffer_t index;
+      bx_sr_binary_header_t header;
+      Bit64u offset = BX_SR_BINARY_ALIGN;
+      memset(&index, 0, sizeof(index));
+      bx_bool ok = save_sr_binary(fp, sr_list->get(dev), checkpoint_path, &index, &offset);
+      memcpy(header.magic, BX_SR_BINARY_MAGIC, 8);
+      header.index_offset = offset;
+      header.index_len = index.len;
+      header.reserved = 0;
+      ok = ok && !fseek(fp, (long) offset, SEEK_SET) &&
+           fwrite(index.data, 1, index.len, fp) == index.len &&
+           !fseek(fp, 0, SEEK_SET) &&
+           fwrite(&header, sizeof(header), 1, fp) == 1;
+      if (index.data != NULL) free(index.data);
+      fclose(fp);
+      if (! ok)
+        return 0;
+      continue;
+    }
     fp = fopen(sr_file, "w");
     if (fp != NULL) {
-      save_sr_param(fp, sr_list->get(dev), checkpoint_path, 0);
+      bx_bool ok = save_sr_param(fp, sr_list->get(dev), checkpoint_path, 0);
       fclose(fp);
+      if (! ok)
+        return 0;
     } else {
       return 0;
     }
   }
+  strcpy(sr_parent, checkpoint_path);
   return 1;
 }
 
+// Start a live snapshot: the guest RAM is written in the background and
+// save_state() is called when little of it is left to write. Falls back
+// to saving the state right away if live snapshots are not supported.
+bx_bool bx_real_sim_c::save_state_live(const char *checkpoint_path)
+{
+  char sr_file[BX_PATHNAME_LEN];
+
+  if (sr_parent_chain_has(checkpoint_path)) {
+    BX_ERROR(("save_state_live(): '%s' is a parent of the checkpoint '%s'", checkpoint_path, sr_parent));
+    return 0;
+  }
+  sprintf(sr_file, "%s/memory.ram", checkpoint_path);
+  int rc = BX_MEM(0)->start_live_save(sr_file, checkpoint_path);
+  if (rc != 0)
+    return (rc > 0);
+  BX_INFO(("live snapshots not supported, saving the state now"));
+  return save_state(checkpoint_path);
+}
+
 bx_bool bx_real_sim_c::restore_config()
 {
   char config[BX_PATHNAME_LEN];
@@ -1039,7 +1180,7 @@ bx_bool bx_real_sim_c::restore_bochs_param(bx_list_c *root, const char *sr_path,
   char devstate[BX_PATHNAME_LEN], devdata[BX_PATHNAME_LEN];
   char line[512], buf[512], pname[80];
   char *ret, *ptr;
-  int i, j, p;
+  int i, j, p, rc;
   unsigned n;
   bx_param_c *param = NULL;
   FILE *fp, *fp2;
@@ -1052,6 +1193,24 @@ bx_bool bx_real_sim_c::restore_bochs_param(bx_list_c *root, const char *sr_path,
   sprintf(devstate, "%s/%s", sr_path, restore_name);
   BX_INFO(("restoring '%s'", devstate));
   bx_list_c *base = root;
+  fp = fopen(devstate, "rb");
+  if (fp != NULL) {
+    bx_sr_binary_header_t header;
+    if ((fread(&header, sizeof(header), 1, fp) == 1) &&
+        !memcmp(header.magic, BX_SR_BINARY_MAGIC, 8)) {
+      Bit8u *index = new Bit8u[header.index_len];
+      Bit32u pos = 0;
+      bx_bool ok = !fseek(fp, (long) header.index_offset, SEEK_SET) &&
+                   (fread(index, 1, header.index_len, fp) == header.index_len) &&
+                   restore_sr_binary(fp, root, -1, sr_path, index, header.index_len, &pos);
+      delete [] index;
+      fclose(fp);
+      if (! ok)
+        BX_ERROR(("restore_bochs_param(): error in binary state '%s'", devstate));
+      return ok;
+    }
+    fclose(fp);
+  }
   fp = fopen(devstate, "r");
   if (fp != NULL) {
     do {
@@ -1113,6 +1272,13 @@ bx_bool bx_real_sim_c::restore_bochs_param(bx_list_c *root, const char *sr_path,
                   break;
                 case BXT_PARAM_DATA:
                   sprintf(devdata, "%s/%s", sr_path, ptr);
+                  rc = ((bx_shadow_data_c*)param)->custom_restore(devdata);
+                  if (rc == BX_SR_DATA_FAILED) {
+                    fclose(fp);
+                    return 0;
+                  }
+                  if (rc == BX_SR_DATA_DONE)
+                    break;
                   fp2 = fopen(devdata, "rb");
                   if (fp2 != NULL) {
                     fread(((bx_shadow_data_c*)param)->getptr(), 1, ((bx_shadow_data_c*)param)->get_size(), fp2);
@@ -1141,20 +1307,89 @@ bx_bool bx_real_sim_c::restore_bochs_param(bx_list_c *root, const char *sr_path,
   return 1;
 }
 
+// Find the checkpoint holding the state of a subtree. Incremental
+// checkpoints leave out unchanged subtrees, these are taken from the
+// nearest parent checkpoint that has them.
+bx_bool bx_real_sim_c::find_sr_checkpoint(const char *checkpoint_path, const char *name, char *sr_path)
+{
+  char sr_file[BX_PATHNAME_LEN];
+  FILE *fp;
+
+  strcpy(sr_path, checkpoint_path);
+  for (int depth = 0; depth < BX_SR_MAX_CHAIN; depth++) {
+    sprintf(sr_file, "%s/%s", sr_path, name);
+    if ((fp = fopen(sr_file, "r")) != NULL) {
+      fclose(fp);
+      return 1;
+    }
+    if (! read_sr_parent(sr_path, sr_path))
+      return 0;
+  }
+  BX_ERROR(("find_sr_checkpoint(): chain of parent checkpoints too long"));
+  return 0;
+}
+
+// Read the parent of an incremental checkpoint, returns 0 for a full one
+bx_bool bx_real_sim_c::read_sr_parent(const char *checkpoint_path, char *parent)
+{
+  char sr_file[BX_PATHNAME_LEN];
+  char line[BX_PATHNAME_LEN];
+  FILE *fp;
+
+  sprintf(sr_file, "%s/parent", checkpoint_path);
+  if ((fp = fopen(sr_file, "r")) == NULL)
+    return 0;
+  if (fgets(line, BX_PATHNAME_LEN, fp) == NULL) {
+    fclose(fp);
+    return 0;
+  }
+  fclose(fp);
+  int len = strlen(line);
+  if ((len > 0) && (line[len-1] == '\n'))
+    line[len-1] = 0;
+  strcpy(parent, line);
+  return 1;
+}
+
+// Overwriting a parent of the last saved or restored checkpoint would
+// change the state of the checkpoints based on it, and a later incremental
+// save to it would make the chain of parents a loop.
+bx_bool bx_real_sim_c::sr_parent_chain_has(const char *checkpoint_path)
+{
+  char path[BX_PATHNAME_LEN];
+
+  if (sr_parent[0] == 0)
+    return 0;
+  strcpy(path, sr_parent);
+  for (int depth = 0; depth < BX_SR_MAX_CHAIN; depth++) {
+    if (! read_sr_parent(path, path))
+      return 0;
+    if (! strcmp(path, checkpoint_path))
+      return 1;
+  }
+  BX_ERROR(("chain of parent checkpoints of '%s' too long", sr_parent));
+  return 1;
+}
+
 bx_bool bx_real_sim_c::restore_hardware()
 {
+  char sr_path[BX_PATHNAME_LEN];
+  const char *restore_path = get_param_string(BXPN_RESTORE_PATH)->getptr();
   bx_list_c *sr_list = get_bochs_root();
   int ndev = sr_list->get_size();
   for (int dev=0; dev<ndev; dev++) {
-    if (!restore_bochs_param(sr_list, get_param_string(BXPN_RESTORE_PATH)->getptr(), sr_list->get(dev)->get_name()))
+    if (!find_sr_checkpoint(restore_path, sr_list->get(dev)->get_name(), sr_path))
+      strcpy(sr_path, restore_path);
+    if (!restore_bochs_param(sr_list, sr_path, sr_list->get(dev)->get_name()))
       return 0;
   }
+  strcpy(sr_parent, restore_path);
   return 1;
 }
 
 bx_bool bx_real_sim_c::save_sr_param(FILE *fp, bx_param_c *node, const char *sr_path, int level)
 {
-  int i;
+  int i, ret;
   Bit64s value;
   char tmpstr[BX_PATHNAME_LEN], tmpbyte[4];
   FILE *fp2;
@@ -1221,6 +1456,11 @@ bx_bool bx_real_sim_c::save_sr_param(FILE *fp, bx_param_c *node, const char *sr_
         sprintf(tmpstr, "%s/%s.%s", sr_path, node->get_parent()->get_name(), node->get_name());
       else
         sprintf(tmpstr, "%s.%s", node->get_parent()->get_name(), node->get_name());
+      ret = ((bx_shadow_data_c*)node)->custom_save(tmpstr);
+      if (ret == BX_SR_DATA_FAILED)
+        return 0;
+      if (ret == BX_SR_DATA_DONE)
+        break;
       fp2 = fopen(tmpstr, "wb");
       if (fp2 != NULL) {
         fwrite(((bx_shadow_data_c*)node)->getptr(), 1, ((bx_shadow_data_c*)node)->get_size(), fp2);
@@ -1232,7 +1472,8 @@ bx_bool bx_real_sim_c::save_sr_param(FILE *fp, bx_param_c *node, const char *sr_
         fprintf(fp, "{\n");
         bx_list_c *list = (bx_list_c*)node;
         for (i=0; i < list->get_size(); i++) {
-          save_sr_param(fp, list->get(i), sr_path, level+1);
+          if (! save_sr_param(fp, list->get(i), sr_path, level+1))
+            return 0;
         }
         for (i=0; i<level; i++)
           fprintf(fp, "  ");
@@ -1247,6 +1488,255 @@ bx_bool bx_real_sim_c::save_sr_param(FILE *fp, bx_param_c *node, const char *sr_
   return 1;
 }
 
+static bx_bool sr_buffer_read(const Bit8u *buf, Bit32u len, Bit32u *pos, void *data, Bit32u n)
+{
+  if (*pos + n > len)
+    return 0;
+  memcpy(data, buf + *pos, n);
+  *pos += n;
+  return 1;
+}
+
+static void sr_buffer_append(bx_sr_buffer_t *buf, const void *data, Bit32u len)
+{
+  if (buf->len + len > buf->size) {
+    buf->size = (buf->len + len) * 2;
+    buf->data = (Bit8u *) realloc(buf->data, buf->size);
+  }
+  memcpy(buf->data + buf->len, data, len);
+  buf->len += len;
+}
+
+bx_bool bx_real_sim_c::save_sr_binary(FILE *fp, bx_param_c *node, const char *sr_path, bx_sr_buffer_t *index, Bit64u *offset)
+{
+  static const Bit8u zero_block[BX_SR_BINARY_ALIGN] = {0};
+  char tmpstr[BX_PATHNAME_LEN];
+  Bit8u type = (Bit8u) node->get_type();
+  Bit8u name_len = (Bit8u) strlen(node->get_name());
+  Bit64s value;
+  Bit32u len;
+  int i;
+
+  sr_buffer_append(index, &type, 1);
+  sr_buffer_append(index, &name_len, 1);
+  sr_buffer_append(index, node->get_name(), name_len);
+  switch (node->get_type()) {
+    case BXT_PARAM_NUM:
+      // 32-bit values are truncated like in the text format
+      value = ((bx_param_num_c*)node)->get64();
+      if ((((bx_param_num_c*)node)->get_base() == BASE_DEC) &&
+          (((bx_param_num_c*)node)->get_min() < BX_MIN_BIT64U)) {
+        value = (Bit32s) value;
+      } else if ((Bit64u)((bx_param_num_c*)node)->get_max() <= BX_MAX_BIT32U) {
+        value = (Bit32u) value;
+      }
+      sr_buffer_append(index, &value, sizeof(value));
+      break;
+    case BXT_PARAM_BOOL:
+    case BXT_PARAM_ENUM:
+      value = ((bx_param_num_c*)node)->get64();
+      sr_buffer_append(index, &value, sizeof(value));
+      break;
+    case BXT_PARAM_STRING:
+      if (((bx_param_string_c*)node)->get_options() & bx_param_string_c::RAW_BYTES) {
+        len = ((bx_param_string_c*)node)->get_maxsize();
+      } else {
+        len = strlen(((bx_param_string_c*)node)->getptr()) + 1;
+      }
+      sr_buffer_append(index, &len, sizeof(len));
+      sr_buffer_append(index, ((bx_param_string_c*)node)->getptr(), len);
+      break;
+    case BXT_PARAM_DATA:
+      {
+        Bit64u blob = 0;
+        Bit8u *data = ((bx_shadow_data_c*)node)->getptr();
+        len = ((bx_shadow_data_c*)node)->get_size();
+        sprintf(tmpstr, "%s/%s.%s", sr_path, node->get_parent()->get_name(), node->get_name());
+        int ret = ((bx_shadow_data_c*)node)->custom_save(tmpstr);
+        if (ret == BX_SR_DATA_FAILED)
+          return 0;
+        if (ret == BX_SR_DATA_DEFAULT) {
+          // zero blocks are left as holes
+          blob = *offset;
+          for (Bit32u done = 0; done < len; done += BX_SR_BINARY_ALIGN) {
+            Bit32u n = len - done;
+            if (n > BX_SR_BINARY_ALIGN) n = BX_SR_BINARY_ALIGN;
+            if (! memcmp(data + done, zero_block, n))
+              continue;
+            if (fseek(fp, (long)(blob + done), SEEK_SET) || fwrite(data + done, 1, n, fp) != n)
+              return 0;
+          }
+          *offset = (blob + len + BX_SR_BINARY_ALIGN - 1) & ~((Bit64u) BX_SR_BINARY_ALIGN - 1);
+        }
+        sr_buffer_append(index, &blob, sizeof(blob));
+        sr_buffer_append(index, &len, sizeof(len));
+        break;
+      }
+    case BXT_LIST:
+      {
+        bx_list_c *list = (bx_list_c*)node;
+        len = list->get_size();
+        sr_buffer_append(index, &len, sizeof(len));
+        for (i=0; i < list->get_size(); i++) {
+          if (! save_sr_binary(fp, list->get(i), sr_path, index, offset))
+            return 0;
+        }
+        break;
+      }
+    default:
+      BX_ERROR(("save_sr_binary(): unknown parameter type"));
+      return 0;
+  }
+
+  return 1;
+}
+
+// Restore the parameter of the next index record. It is looked up in base,
+// where hint is its expected position. Records of unknown parameters are
+// skipped.
+bx_bool bx_real_sim_c::restore_sr_binary(FILE *fp, bx_list_c *base, int hint, const char *sr_path,
+                                         const Bit8u *index, Bit32u len, Bit32u *pos)
+{
+  char name[256], pname[80], devdata[BX_PATHNAME_LEN];
+  bx_param_c *param = NULL;
+  Bit8u type, name_len;
+  Bit64s value;
+  Bit32u n, i;
+
+  if (! sr_buffer_read(index, len, pos, &type, 1) ||
+      ! sr_buffer_read(index, len, pos, &name_len, 1) ||
+      ! sr_buffer_read(index, len, pos, name, name_len))
+    return 0;
+  name[name_len] = 0;
+
+  if (base != NULL) {
+    if ((hint >= 0) && (hint < base->get_size()) && !strcmp(base->get(hint)->get_name(), name))
+      param = base->get(hint);
+    else
+      param = base->get_by_name(name);
+  }
+  if ((param != NULL) && (param->get_type() != type))
+    param = NULL;
+  if (param == NULL) {
+    BX_ERROR(("restore_sr_binary(): unknown parameter '%s' skipped", name));
+  } else if (type != BXT_LIST) {
+    param->get_param_path(pname, 80);
+    BX_DEBUG(("restoring parameter '%s'", pname));
+  }
+
+  switch (type) {
+    case BXT_PARAM_NUM:
+    case BXT_PARAM_BOOL:
+    case BXT_PARAM_ENUM:
+      if (! sr_buffer_read(index, len, pos, &value, sizeof(value)))
+        return 0;
+      if (param != NULL)
+        ((bx_param_num_c*)param)->set(value);
+      break;
+    case BXT_PARAM_STRING:
+      if (! sr_buffer_read(index, len, pos, &n, sizeof(n)) || (*pos + n > len))
+        return 0;
+      if (param != NULL) {
+        Bit32u size = ((bx_param_string_c*)param)->get_maxsize();
+        if (size < n) size = n;
+        char *buf = new char[size + 1];
+        memset(buf, 0, size + 1);
+        memcpy(buf, index + *pos, n);
+        ((bx_param_string_c*)param)->set(buf);
+        delete [] buf;
+      }
+      *pos += n;
+      break;
+    case BXT_PARAM_DATA:
+      {
+        Bit64u blob;
+        if (! sr_buffer_read(index, len, pos, &blob, sizeof(blob)) ||
+            ! sr_buffer_read(index, len, pos, &n, sizeof(n)))
+          return 0;
+        if (param == NULL)
+          break;
+        bx_shadow_data_c *data = (bx_shadow_data_c*)param;
+        if (n > data->get_size()) n = data->get_size();
+        if (blob == 0) {
+          sprintf(devdata, "%s/%s.%s", sr_path, base->get_name(), name);
+          int ret = data->custom_restore(devdata);
+          if (ret == BX_SR_DATA_FAILED)
+            return 0;
+          if (ret == BX_SR_DATA_DONE)
+            break;
+          FILE *fp2 = fopen(devdata, "rb");
+          if (fp2 != NULL) {
+            fread(data->getptr(), 1, n, fp2);
+            fclose(fp2);
+          }
+        } else {
+          // holes of the file read back as zero
+          if (fseek(fp, (long) blob, SEEK_SET))
+            return 0;
+          Bit32u got = fread(data->getptr(), 1, n, fp);
+          if (got < n)
+            memset(data->getptr() + got, 0, n - got);
+        }
+        break;
+      }
+    case BXT_LIST:
+      if (! sr_buffer_read(index, len, pos, &n, sizeof(n)))
+        return 0;
+      for (i = 0; i < n; i++) {
+        if (! restore_sr_binary(fp, (bx_list_c*)param, i, sr_path, index, len, pos))
+          return 0;
+      }
+      break;
+    default:
+      BX_ERROR(("restore_sr_binary(): unknown parameter type"));
+      return 0;
+  }
+
+  return 1;
+}
+
+// Append the values of a subtree to the snapshot, which is compared with
+// the one of the last save to find the unchanged subtrees. Returns 0 if
+// the subtree has data saved by custom handlers, it must always be saved.
+bx_bool bx_real_sim_c::snapshot_sr_param(bx_param_c *node, bx_sr_buffer_t *snap)
+{
+  Bit64s value;
+
+  switch (node->get_type()) {
+    case BXT_PARAM_NUM:
+    case BXT_PARAM_BOOL:
+    case BXT_PARAM_ENUM:
+      value = ((bx_param_num_c*)node)->get64();
+      sr_buffer_append(snap, &value, sizeof(value));
+      break;
+    case BXT_PARAM_STRING:
+      if (((bx_param_string_c*)node)->get_options() & bx_param_string_c::RAW_BYTES) {
+        sr_buffer_append(snap, ((bx_param_string_c*)node)->getptr(), ((bx_param_string_c*)node)->get_maxsize());
+      } else {
+        sr_buffer_append(snap, ((bx_param_string_c*)node)->getptr(), strlen(((bx_param_string_c*)node)->getptr()) + 1);
+      }
+      break;
+    case BXT_PARAM_DATA:
+      if (((bx_shadow_data_c*)node)->has_sr_handlers())
+        return 0;
+      sr_buffer_append(snap, ((bx_shadow_data_c*)node)->getptr(), ((bx_shadow_data_c*)node)->get_size());
+      break;
+    case BXT_LIST:
+      {
+        bx_list_c *list = (bx_list_c*)node;
+        for (int i=0; i < list->get_size(); i++) {
+          if (! snapshot_sr_param(list->get(i), snap))
+            return 0;
+        }
+        break;
+      }
+    default:
+      break;
+  }
+
+  return 1;
+}
+
 /////////////////////////////////////////////////////////////////////////
 // define methods of bx_param_* and family
 /////////////////////////////////////////////////////////////////////////
@@ -2029,6 +2519,9 @@ bx_shadow_data_c::bx_shadow_data_c(bx_param_c *parent,
   set_type(BXT_PARAM_DATA);
   this->data_ptr = ptr_to_data;
   this->data_size = data_size;
+  this->sr_devptr = NULL;
+  this->save_handler = NULL;
+  this->restore_handler = NULL;
   if (parent) {
     BX_ASSERT(parent->get_type() == BXT_LIST);
     this->parent = (bx_list_c *)parent;
@@ -2036,6 +2529,29 @@ bx_shadow_data_c::bx_shadow_data_c(bx_param_c *parent,
   }
 }
 
+void bx_shadow_data_c::set_sr_handlers(void *devptr, data_save_handler save, data_restore_handler restore)
+{
+  sr_devptr = devptr;
+  save_handler = save;
+  restore_handler = restore;
+}
+
+int bx_shadow_data_c::custom_save(const char *path)
+{
+  if (save_handler) {
+    return (*save_handler)(sr_devptr, this, path);
+  }
+  return BX_SR_DATA_DEFAULT;
+}
+
+int bx_shadow_data_c::custom_restore(const char *path)
+{
+  if (restore_handler) {
+    return (*restore_handler)(sr_devptr, this, path);
+  }
+  return BX_SR_DATA_DEFAULT;
+}
+
 bx_list_c::bx_list_c(bx_param_c *parent, int maxsize)
   : bx_param_c(SIM->gen_param_id(), "list", "")
 {
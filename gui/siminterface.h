@@ -553,6 +553,8 @@ typedef Bit64s (*param_event_handler)(class bx_param_c *, int set, Bit64s val);
 typedef Bit64s (*param_save_handler)(void *devptr, class bx_param_c *);
 typedef void (*param_restore_handler)(void *devptr, class bx_param_c *, Bit64s val);
 typedef int (*param_enable_handler)(class bx_param_c *, int en);
+typedef int (*data_save_handler)(void *devptr, class bx_shadow_data_c *, const char *path);
+typedef int (*data_restore_handler)(void *devptr, class bx_shadow_data_c *, const char *path);
 
 class BOCHSAPI bx_param_num_c : public bx_param_c {
   BOCHSAPI_CYGONLY static Bit32u default_base;
@@ -801,6 +803,9 @@ public:
 class BOCHSAPI bx_shadow_data_c : public bx_param_c {
   Bit32u data_size;
   Bit8u *data_ptr;
+  void *sr_devptr;
+  data_save_handler save_handler;
+  data_restore_handler restore_handler;
 public:
   bx_shadow_data_c(bx_param_c *parent,
       const char *name,
@@ -808,8 +813,20 @@ public:
       Bit32u data_size);
   Bit8u *getptr() {return data_ptr;}
   Bit32u get_size() const {return data_size;}
+  // the handlers may save/restore the data file in their own way, if they
+  // are not set or return 0 the raw data is written/read as usual. They
+  // return one of the BX_SR_DATA_xxx values.
+  void set_sr_handlers(void *devptr, data_save_handler save, data_restore_handler restore);
+  bx_bool has_sr_handlers() const {return save_handler != NULL;}
+  int custom_save(const char *path);
+  int custom_restore(const char *path);
 };
 
+// results of the save and restore handlers of a data parameter
+#define BX_SR_DATA_DEFAULT  0  // not handled, write/read the raw data
+#define BX_SR_DATA_DONE     1
+#define BX_SR_DATA_FAILED   2  // the error has been reported
+
 #define BX_DEFAULT_LIST_SIZE 6
 
 class BOCHSAPI bx_list_c : public bx_param_c {
@@ -961,6 +978,19 @@ enum {
 #define BX_ATA_MODE_Z_VOLATILE  11
 #define BX_ATA_MODE_LAST        11
 
+#define BX_MEM_ALLOC_HEAP        0
+#define BX_MEM_ALLOC_MMAP        1
+#define BX_MEM_ALLOC_HUGETLB     2
+#define BX_MEM_ALLOC_SHARED      3
+#define BX_MEM_ALLOC_LAST        3
+
+// highest host NUMA node guest RAM can be bound to
+#define BX_MEM_MAX_NUMA_NODE     63
+
+#define BX_MEM_SAVE_RAW          0
+#define BX_MEM_SAVE_COMPACT      1
+#define BX_MEM_SAVE_LAST         1
+
 #define BX_CLOCK_SYNC_NONE       0
 #define BX_CLOCK_SYNC_REALTIME   1
 #define BX_CLOCK_SYNC_SLOWDOWN   2
@@ -1139,6 +1169,7 @@ public:
   // save/restore support
   virtual void init_save_restore() {}
   virtual bx_bool save_state(const char *checkpoint_path) {return 0;}
+  virtual bx_bool save_state_live(const char *checkpoint_path) {return 0;}
   virtual bx_bool restore_config() {return 0;}
   virtual bx_bool restore_logopts() {return 0;}
   virtual bx_bool restore_hardware() {return 0;}
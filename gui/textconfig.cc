@@ -315,7 +315,7 @@ static const char *runtime_menu_prompt =
 "4. 2nd CDROM: %s\n"
 "5. 3rd CDROM: %s\n"
 "6. 4th CDROM: %s\n"
-"7. (not implemented)\n"
+"7. Emulator statistics\n"
 "8. Log options for all devices\n"
 "9. Log options for individual devices\n"
 "10. Instruction tracing: off (doesn't exist yet)\n"
@@ -397,6 +397,24 @@ int do_menu(const char *pname)
   }
 }
 
+// print the counters of the stats list, 64-bit values are not
+// supported by bx_param_num_c::text_print()
+void print_stats(bx_param_c *node, int level)
+{
+  int i;
+
+  for (i=0; i<level; i++)
+    fprintf(stderr, "  ");
+  if (node->get_type() == BXT_LIST) {
+    bx_list_c *list = (bx_list_c*)node;
+    fprintf(stderr, "%s:\n", node->get_name());
+    for (i=0; i < list->get_size(); i++)
+      print_stats(list->get(i), level+1);
+  } else {
+    fprintf(stderr, "%s: " FMT_LL "u\n", node->get_name(), ((bx_param_num_c*)node)->get64());
+  }
+}
+
 void askparam(char *pname)
 {
   bx_param_c *param = SIM->get_param(pname);
@@ -512,11 +530,7 @@ int bx_config_interface(int menu)
                 do_menu(pname);
               }
               break;
-            case BX_CI_RT_IPS:
-              // not implemented yet because I would have to mess with
-              // resetting timers and pits and everything on the fly.
-              // askparam(BXPN_IPS);
-              break;
+            case BX_CI_RT_STATS: print_stats(SIM->get_param(BXPN_STATS), 0); break;
             case BX_CI_RT_LOGOPTS1: bx_log_options(0); break;
             case BX_CI_RT_LOGOPTS2: bx_log_options(1); break;
             case BX_CI_RT_INST_TR: NOT_IMPLEMENTED(choice); break;
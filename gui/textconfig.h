@@ -43,7 +43,7 @@ enum {
   BX_CI_RT_CDROM2,
   BX_CI_RT_CDROM3,
   BX_CI_RT_CDROM4,
-  BX_CI_RT_IPS,
+  BX_CI_RT_STATS,
   BX_CI_RT_LOGOPTS1,
   BX_CI_RT_LOGOPTS2,
   BX_CI_RT_INST_TR,
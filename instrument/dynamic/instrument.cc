@@ -0,0 +1,175 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//   Copyright (c) 2010  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+
+#include "bochs.h"
+
+#if BX_INSTRUMENTATION
+
+#define LOG_THIS genlog->
+
+Bit32u bx_instr_events = 0;
+
+static const bx_instr_tool_t *tools[BX_INSTR_MAX_TOOLS];
+static unsigned num_tools = 0;
+
+// CPUs initialized and not yet destructed, late tools get their callbacks
+static bx_bool cpu_initialized[BX_MAX_SMP_THREADS_SUPPORTED];
+
+#define TOOL_EVENT(callback, ev) \
+  if (tool->callback) events |= (ev)
+
+static void update_events(void)
+{
+  Bit32u events = 0;
+
+  for (unsigned n = 0; n < num_tools; n++) {
+    const bx_instr_tool_t *tool = tools[n];
+    TOOL_EVENT(reset, BX_INSTR_EV_RESET);
+    TOOL_EVENT(hlt, BX_INSTR_EV_HLT);
+    TOOL_EVENT(mwait, BX_INSTR_EV_MWAIT);
+    TOOL_EVENT(new_instruction, BX_INSTR_EV_NEW_INSTRUCTION);
+    TOOL_EVENT(cnear_branch_taken, BX_INSTR_EV_CNEAR_BRANCH_TAKEN);
+    TOOL_EVENT(cnear_branch_not_taken, BX_INSTR_EV_CNEAR_BRANCH_NOT_TAKEN);
+    TOOL_EVENT(ucnear_branch, BX_INSTR_EV_UCNEAR_BRANCH);
+    TOOL_EVENT(far_branch, BX_INSTR_EV_FAR_BRANCH);
+    TOOL_EVENT(opcode, BX_INSTR_EV_OPCODE);
+    TOOL_EVENT(interrupt, BX_INSTR_EV_INTERRUPT);
+    TOOL_EVENT(exception, BX_INSTR_EV_EXCEPTION);
+    TOOL_EVENT(hwinterrupt, BX_INSTR_EV_HWINTERRUPT);
+    TOOL_EVENT(tlb_cntrl, BX_INSTR_EV_TLB_CNTRL);
+    TOOL_EVENT(clflush, BX_INSTR_EV_CLFLUSH);
+    TOOL_EVENT(cache_cntrl, BX_INSTR_EV_CACHE_CNTRL);
+    TOOL_EVENT(prefetch_hint, BX_INSTR_EV_PREFETCH_HINT);
+    TOOL_EVENT(before_execution, BX_INSTR_EV_BEFORE_EXECUTION);
+    TOOL_EVENT(after_execution, BX_INSTR_EV_AFTER_EXECUTION);
+    TOOL_EVENT(repeat_iteration, BX_INSTR_EV_REPEAT_ITERATION);
+    TOOL_EVENT(inp, BX_INSTR_EV_INP);
+    TOOL_EVENT(inp2, BX_INSTR_EV_INP2);
+    TOOL_EVENT(outp, BX_INSTR_EV_OUTP);
+    TOOL_EVENT(mem_data_access, BX_INSTR_EV_MEM_DATA_ACCESS);
+    TOOL_EVENT(lin_access, BX_INSTR_EV_LIN_ACCESS);
+    TOOL_EVENT(phy_write, BX_INSTR_EV_PHY_WRITE);
+    TOOL_EVENT(phy_read, BX_INSTR_EV_PHY_READ);
+    TOOL_EVENT(wrmsr, BX_INSTR_EV_WRMSR);
+  }
+
+  bx_instr_events = events;
+}
+
+bx_bool bx_instr_register_tool(const bx_instr_tool_t *tool)
+{
+  for (unsigned n = 0; n < num_tools; n++) {
+    if (tools[n] == tool) {
+      BX_ERROR(("instrumentation tool '%s' already registered", tool->name));
+      return 0;
+    }
+  }
+  if (num_tools == BX_INSTR_MAX_TOOLS) {
+    BX_ERROR(("too many instrumentation tools, '%s' not registered", tool->name));
+    return 0;
+  }
+  tools[num_tools++] = tool;
+  BX_INFO(("instrumentation tool '%s' registered", tool->name));
+
+  if (tool->initialize) {
+    for (unsigned cpu = 0; cpu < BX_MAX_SMP_THREADS_SUPPORTED; cpu++)
+      if (cpu_initialized[cpu]) tool->initialize(cpu);
+  }
+  update_events();
+  return 1;
+}
+
+void bx_instr_unregister_tool(const bx_instr_tool_t *tool)
+{
+  for (unsigned n = 0; n < num_tools; n++) {
+    if (tools[n] != tool) continue;
+    for (num_tools--; n < num_tools; n++)
+      tools[n] = tools[n+1];
+    update_events();
+    if (tool->exit) {
+      for (unsigned cpu = 0; cpu < BX_MAX_SMP_THREADS_SUPPORTED; cpu++)
+        if (cpu_initialized[cpu]) tool->exit(cpu);
+    }
+    BX_INFO(("instrumentation tool '%s' unregistered", tool->name));
+    return;
+  }
+}
+
+#define FOR_EACH_TOOL(callback, args) \
+  for (unsigned n = 0; n < num_tools; n++) \
+    if (tools[n]->callback) tools[n]->callback args
+
+void bx_instr_init_env(void) { FOR_EACH_TOOL(init_env, ()); }
+void bx_instr_exit_env(void) { FOR_EACH_TOOL(exit_env, ()); }
+
+void bx_instr_initialize(unsigned cpu)
+{
+  cpu_initialized[cpu] = 1;
+  FOR_EACH_TOOL(initialize, (cpu));
+}
+
+void bx_instr_exit(unsigned cpu)
+{
+  FOR_EACH_TOOL(exit, (cpu));
+  cpu_initialized[cpu] = 0;
+}
+
+void bx_instr_reset(unsigned cpu, unsigned type) { FOR_EACH_TOOL(reset, (cpu, type)); }
+void bx_instr_hlt(unsigned cpu) { FOR_EACH_TOOL(hlt, (cpu)); }
+void bx_instr_mwait(unsigned cpu, bx_phy_address addr, unsigned len, Bit32u flags) { FOR_EACH_TOOL(mwait, (cpu, addr, len, flags)); }
+void bx_instr_new_instruction(unsigned cpu) { FOR_EACH_TOOL(new_instruction, (cpu)); }
+
+void bx_instr_debug_promt() { FOR_EACH_TOOL(debug_promt, ()); }
+void bx_instr_debug_cmd(const char *cmd) { FOR_EACH_TOOL(debug_cmd, (cmd)); }
+
+void bx_instr_cnear_branch_taken(unsigned cpu, bx_address new_eip) { FOR_EACH_TOOL(cnear_branch_taken, (cpu, new_eip)); }
+void bx_instr_cnear_branch_not_taken(unsigned cpu) { FOR_EACH_TOOL(cnear_branch_not_taken, (cpu)); }
+void bx_instr_ucnear_branch(unsigned cpu, unsigned what, bx_address new_eip) { FOR_EACH_TOOL(ucnear_branch, (cpu, what, new_eip)); }
+void bx_instr_far_branch(unsigned cpu, unsigned what, Bit16u new_cs, bx_address new_eip) { FOR_EACH_TOOL(far_branch, (cpu, what, new_cs, new_eip)); }
+
+void bx_instr_opcode(unsigned cpu, const Bit8u *opcode, unsigned len, bx_bool is32, bx_bool is64) { FOR_EACH_TOOL(opcode, (cpu, opcode, len, is32, is64)); }
+
+void bx_instr_interrupt(unsigned cpu, unsigned vector) { FOR_EACH_TOOL(interrupt, (cpu, vector)); }
+void bx_instr_exception(unsigned cpu, unsigned vector, unsigned error_code) { FOR_EACH_TOOL(exception, (cpu, vector, error_code)); }
+void bx_instr_hwinterrupt(unsigned cpu, unsigned vector, Bit16u cs, bx_address eip) { FOR_EACH_TOOL(hwinterrupt, (cpu, vector, cs, eip)); }
+
+void bx_instr_tlb_cntrl(unsigned cpu, unsigned what, bx_phy_address new_cr3) { FOR_EACH_TOOL(tlb_cntrl, (cpu, what, new_cr3)); }
+void bx_instr_clflush(unsigned cpu, bx_address laddr, bx_phy_address paddr) { FOR_EACH_TOOL(clflush, (cpu, laddr, paddr)); }
+void bx_instr_cache_cntrl(unsigned cpu, unsigned what) { FOR_EACH_TOOL(cache_cntrl, (cpu, what)); }
+void bx_instr_prefetch_hint(unsigned cpu, unsigned what, unsigned seg, bx_address offset) { FOR_EACH_TOOL(prefetch_hint, (cpu, what, seg, offset)); }
+
+void bx_instr_before_execution(unsigned cpu, bxInstruction_c *i) { FOR_EACH_TOOL(before_execution, (cpu, i)); }
+void bx_instr_after_execution(unsigned cpu, bxInstruction_c *i) { FOR_EACH_TOOL(after_execution, (cpu, i)); }
+void bx_instr_repeat_iteration(unsigned cpu, bxInstruction_c *i) { FOR_EACH_TOOL(repeat_iteration, (cpu, i)); }
+
+void bx_instr_inp(Bit16u addr, unsigned len) { FOR_EACH_TOOL(inp, (addr, len)); }
+void bx_instr_inp2(Bit16u addr, unsigned len, unsigned val) { FOR_EACH_TOOL(inp2, (addr, len, val)); }
+void bx_instr_outp(Bit16u addr, unsigned len, unsigned val) { FOR_EACH_TOOL(outp, (addr, len, val)); }
+
+void bx_instr_mem_data_access(unsigned cpu, unsigned seg, bx_address offset, unsigned len, unsigned rw) { FOR_EACH_TOOL(mem_data_access, (cpu, seg, offset, len, rw)); }
+void bx_instr_lin_access(unsigned cpu, bx_address lin, bx_address phy, unsigned len, unsigned rw) { FOR_EACH_TOOL(lin_access, (cpu, lin, phy, len, rw)); }
+
+void bx_instr_phy_write(unsigned cpu, bx_address addr, unsigned len) { FOR_EACH_TOOL(phy_write, (cpu, addr, len)); }
+void bx_instr_phy_read(unsigned cpu, bx_address addr, unsigned len) { FOR_EACH_TOOL(phy_read, (cpu, addr, len)); }
+
+void bx_instr_wrmsr(unsigned cpu, unsigned addr, Bit64u value) { FOR_EACH_TOOL(wrmsr, (cpu, addr, value)); }
+
+#endif
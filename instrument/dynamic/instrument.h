@@ -0,0 +1,354 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//   Copyright (c) 2010  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+//
+// Dynamic instrumentation: the callbacks are not compiled in, tools are
+// loaded at runtime as user plugins ("user_plugin: name=mytool") and
+// register a bx_instr_tool_t with the callbacks of the events they want.
+// The bit of an event in bx_instr_events is set while a registered tool
+// has its callback, the hooks in the simulator test the bit first, so an
+// event nobody wants costs a load and a not taken branch.
+//
+
+// possible types passed to BX_INSTR_TLB_CNTRL()
+#define BX_INSTR_MOV_CR3      10
+#define BX_INSTR_INVLPG       11
+#define BX_INSTR_TASKSWITCH   12
+
+// possible types passed to BX_INSTR_CACHE_CNTRL()
+#define BX_INSTR_INVD         20
+#define BX_INSTR_WBINVD       21
+
+// possible types passed to BX_INSTR_FAR_BRANCH()
+#define BX_INSTR_IS_CALL      10
+#define BX_INSTR_IS_RET       11
+#define BX_INSTR_IS_IRET      12
+#define BX_INSTR_IS_JMP       13
+#define BX_INSTR_IS_INT       14
+#define BX_INSTR_IS_SYSCALL   15
+#define BX_INSTR_IS_SYSRET    16
+#define BX_INSTR_IS_SYSENTER  17
+#define BX_INSTR_IS_SYSEXIT   18
+
+// possible types passed to BX_INSTR_PREFETCH_HINT()
+#define BX_INSTR_PREFETCH_NTA 0
+#define BX_INSTR_PREFETCH_T0  1
+#define BX_INSTR_PREFETCH_T1  2
+#define BX_INSTR_PREFETCH_T2  3
+
+
+#if BX_INSTRUMENTATION
+
+class bxInstruction_c;
+
+// maximum number of tools registered at the same time
+#define BX_INSTR_MAX_TOOLS 8
+
+// callbacks of a tool, NULL for the events the tool does not want
+typedef struct bx_instr_tool_t {
+  const char *name;
+
+  void (*init_env)(void);
+  void (*exit_env)(void);
+
+  void (*initialize)(unsigned cpu);
+  void (*exit)(unsigned cpu);
+  void (*reset)(unsigned cpu, unsigned type);
+  void (*hlt)(unsigned cpu);
+  void (*mwait)(unsigned cpu, bx_phy_address addr, unsigned len, Bit32u flags);
+  void (*new_instruction)(unsigned cpu);
+
+  void (*debug_promt)(void);
+  void (*debug_cmd)(const char *cmd);
+
+  void (*cnear_branch_taken)(unsigned cpu, bx_address new_eip);
+  void (*cnear_branch_not_taken)(unsigned cpu);
+  void (*ucnear_branch)(unsigned cpu, unsigned what, bx_address new_eip);
+  void (*far_branch)(unsigned cpu, unsigned what, Bit16u new_cs, bx_address new_eip);
+
+  void (*opcode)(unsigned cpu, const Bit8u *opcode, unsigned len, bx_bool is32, bx_bool is64);
+
+  void (*interrupt)(unsigned cpu, unsigned vector);
+  void (*exception)(unsigned cpu, unsigned vector, unsigned error_code);
+  void (*hwinterrupt)(unsigned cpu, unsigned vector, Bit16u cs, bx_address eip);
+
+  void (*tlb_cntrl)(unsigned cpu, unsigned what, bx_phy_address new_cr3);
+  void (*clflush)(unsigned cpu, bx_address laddr, bx_phy_address paddr);
+  void (*cache_cntrl)(unsigned cpu, unsigned what);
+  void (*prefetch_hint)(unsigned cpu, unsigned what, unsigned seg, bx_address offset);
+
+  void (*before_execution)(unsigned cpu, bxInstruction_c *i);
+  void (*after_execution)(unsigned cpu, bxInstruction_c *i);
+  void (*repeat_iteration)(unsigned cpu, bxInstruction_c *i);
+
+  void (*inp)(Bit16u addr, unsigned len);
+  void (*inp2)(Bit16u addr, unsigned len, unsigned val);
+  void (*outp)(Bit16u addr, unsigned len, unsigned val);
+
+  void (*mem_data_access)(unsigned cpu, unsigned seg, bx_address offset, unsigned len, unsigned rw);
+  void (*lin_access)(unsigned cpu, bx_address lin, bx_address phy, unsigned len, unsigned rw);
+
+  void (*phy_write)(unsigned cpu, bx_address addr, unsigned len);
+  void (*phy_read)(unsigned cpu, bx_address addr, unsigned len);
+
+  void (*wrmsr)(unsigned cpu, unsigned addr, Bit64u value);
+} bx_instr_tool_t;
+
+// a tool registered after the CPUs are initialized gets the initialize
+// callback for each of them right away, and the exit callback when it
+// is unregistered before the simulation ends
+BOCHSAPI extern bx_bool bx_instr_register_tool(const bx_instr_tool_t *tool);
+BOCHSAPI extern void bx_instr_unregister_tool(const bx_instr_tool_t *tool);
+
+// events of the frequent hooks, set in bx_instr_events while a tool wants them
+#define BX_INSTR_EV_RESET                   (1 << 0)
+#define BX_INSTR_EV_HLT                     (1 << 1)
+#define BX_INSTR_EV_MWAIT                   (1 << 2)
+#define BX_INSTR_EV_NEW_INSTRUCTION         (1 << 3)
+#define BX_INSTR_EV_CNEAR_BRANCH_TAKEN      (1 << 4)
+#define BX_INSTR_EV_CNEAR_BRANCH_NOT_TAKEN  (1 << 5)
+#define BX_INSTR_EV_UCNEAR_BRANCH           (1 << 6)
+#define BX_INSTR_EV_FAR_BRANCH              (1 << 7)
+#define BX_INSTR_EV_OPCODE                  (1 << 8)
+#define BX_INSTR_EV_INTERRUPT               (1 << 9)
+#define BX_INSTR_EV_EXCEPTION               (1 << 10)
+#define BX_INSTR_EV_HWINTERRUPT             (1 << 11)
+#define BX_INSTR_EV_TLB_CNTRL               (1 << 12)
+#define BX_INSTR_EV_CLFLUSH                 (1 << 13)
+#define BX_INSTR_EV_CACHE_CNTRL             (1 << 14)
+#define BX_INSTR_EV_PREFETCH_HINT           (1 << 15)
+#define BX_INSTR_EV_BEFORE_EXECUTION        (1 << 16)
+#define BX_INSTR_EV_AFTER_EXECUTION         (1 << 17)
+#define BX_INSTR_EV_REPEAT_ITERATION        (1 << 18)
+#define BX_INSTR_EV_INP                     (1 << 19)
+#define BX_INSTR_EV_INP2                    (1 << 20)
+#define BX_INSTR_EV_OUTP                    (1 << 21)
+#define BX_INSTR_EV_MEM_DATA_ACCESS         (1 << 22)
+#define BX_INSTR_EV_LIN_ACCESS              (1 << 23)
+#define BX_INSTR_EV_PHY_WRITE               (1 << 24)
+#define BX_INSTR_EV_PHY_READ                (1 << 25)
+#define BX_INSTR_EV_WRMSR                   (1 << 26)
+
+BOCHSAPI extern Bit32u bx_instr_events;
+
+#if defined(__GNUC__)
+#define BX_INSTR_UNLIKELY(x) __builtin_expect((x) != 0, 0)
+#else
+#define BX_INSTR_UNLIKELY(x) (x)
+#endif
+
+#define BX_INSTR_DISPATCH(ev, call) \
+  do { if (BX_INSTR_UNLIKELY(bx_instr_events & (ev))) call; } while (0)
+
+// the callbacks of all registered tools for an event
+
+void bx_instr_init_env(void);
+void bx_instr_exit_env(void);
+
+void bx_instr_initialize(unsigned cpu);
+void bx_instr_exit(unsigned cpu);
+void bx_instr_reset(unsigned cpu, unsigned type);
+void bx_instr_hlt(unsigned cpu);
+void bx_instr_mwait(unsigned cpu, bx_phy_address addr, unsigned len, Bit32u flags);
+void bx_instr_new_instruction(unsigned cpu);
+
+void bx_instr_debug_promt();
+void bx_instr_debug_cmd(const char *cmd);
+
+void bx_instr_cnear_branch_taken(unsigned cpu, bx_address new_eip);
+void bx_instr_cnear_branch_not_taken(unsigned cpu);
+void bx_instr_ucnear_branch(unsigned cpu, unsigned what, bx_address new_eip);
+void bx_instr_far_branch(unsigned cpu, unsigned what, Bit16u new_cs, bx_address new_eip);
+
+void bx_instr_opcode(unsigned cpu, const Bit8u *opcode, unsigned len, bx_bool is32, bx_bool is64);
+
+void bx_instr_interrupt(unsigned cpu, unsigned vector);
+void bx_instr_exception(unsigned cpu, unsigned vector, unsigned error_code);
+void bx_instr_hwinterrupt(unsigned cpu, unsigned vector, Bit16u cs, bx_address eip);
+
+void bx_instr_tlb_cntrl(unsigned cpu, unsigned what, bx_phy_address new_cr3);
+void bx_instr_clflush(unsigned cpu, bx_address laddr, bx_phy_address paddr);
+void bx_instr_cache_cntrl(unsigned cpu, unsigned what);
+void bx_instr_prefetch_hint(unsigned cpu, unsigned what, unsigned seg, bx_address offset);
+
+void bx_instr_before_execution(unsigned cpu, bxInstruction_c *i);
+void bx_instr_after_execution(unsigned cpu, bxInstruction_c *i);
+void bx_instr_repeat_iteration(unsigned cpu, bxInstruction_c *i);
+
+void bx_instr_inp(Bit16u addr, unsigned len);
+void bx_instr_inp2(Bit16u addr, unsigned len, unsigned val);
+void bx_instr_outp(Bit16u addr, unsigned len, unsigned val);
+
+void bx_instr_mem_data_access(unsigned cpu, unsigned seg, bx_address offset, unsigned len, unsigned rw);
+void bx_instr_lin_access(unsigned cpu, bx_address lin, bx_address phy, unsigned len, unsigned rw);
+
+void bx_instr_phy_write(unsigned cpu, bx_address addr, unsigned len);
+void bx_instr_phy_read(unsigned cpu, bx_address addr, unsigned len);
+
+void bx_instr_wrmsr(unsigned cpu, unsigned addr, Bit64u value);
+
+/* initialization/deinitialization of instrumentalization*/
+#define BX_INSTR_INIT_ENV() bx_instr_init_env()
+#define BX_INSTR_EXIT_ENV() bx_instr_exit_env()
+
+/* simulation init, shutdown, reset */
+#define BX_INSTR_INITIALIZE(cpu_id)      bx_instr_initialize(cpu_id)
+#define BX_INSTR_EXIT(cpu_id)            bx_instr_exit(cpu_id)
+#define BX_INSTR_RESET(cpu_id, type) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_RESET, bx_instr_reset(cpu_id, type))
+#define BX_INSTR_HLT(cpu_id) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_HLT, bx_instr_hlt(cpu_id))
+#define BX_INSTR_MWAIT(cpu_id, addr, len, flags) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_MWAIT, bx_instr_mwait(cpu_id, addr, len, flags))
+#define BX_INSTR_NEW_INSTRUCTION(cpu_id) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_NEW_INSTRUCTION, bx_instr_new_instruction(cpu_id))
+
+/* called from command line debugger */
+#define BX_INSTR_DEBUG_PROMPT()          bx_instr_debug_promt()
+#define BX_INSTR_DEBUG_CMD(cmd)          bx_instr_debug_cmd(cmd)
+
+/* branch resoultion */
+#define BX_INSTR_CNEAR_BRANCH_TAKEN(cpu_id, new_eip) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_CNEAR_BRANCH_TAKEN, bx_instr_cnear_branch_taken(cpu_id, new_eip))
+#define BX_INSTR_CNEAR_BRANCH_NOT_TAKEN(cpu_id) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_CNEAR_BRANCH_NOT_TAKEN, bx_instr_cnear_branch_not_taken(cpu_id))
+#define BX_INSTR_UCNEAR_BRANCH(cpu_id, what, new_eip) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_UCNEAR_BRANCH, bx_instr_ucnear_branch(cpu_id, what, new_eip))
+#define BX_INSTR_FAR_BRANCH(cpu_id, what, new_cs, new_eip) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_FAR_BRANCH, bx_instr_far_branch(cpu_id, what, new_cs, new_eip))
+
+/* decoding completed */
+#define BX_INSTR_OPCODE(cpu_id, opcode, len, is32, is64) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_OPCODE, bx_instr_opcode(cpu_id, opcode, len, is32, is64))
+
+/* exceptional case and interrupt */
+#define BX_INSTR_EXCEPTION(cpu_id, vector, error_code) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_EXCEPTION, bx_instr_exception(cpu_id, vector, error_code))
+#define BX_INSTR_INTERRUPT(cpu_id, vector) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_INTERRUPT, bx_instr_interrupt(cpu_id, vector))
+#define BX_INSTR_HWINTERRUPT(cpu_id, vector, cs, eip) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_HWINTERRUPT, bx_instr_hwinterrupt(cpu_id, vector, cs, eip))
+
+/* TLB/CACHE control instruction executed */
+#define BX_INSTR_CLFLUSH(cpu_id, laddr, paddr) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_CLFLUSH, bx_instr_clflush(cpu_id, laddr, paddr))
+#define BX_INSTR_CACHE_CNTRL(cpu_id, what) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_CACHE_CNTRL, bx_instr_cache_cntrl(cpu_id, what))
+#define BX_INSTR_TLB_CNTRL(cpu_id, what, new_cr3) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_TLB_CNTRL, bx_instr_tlb_cntrl(cpu_id, what, new_cr3))
+#define BX_INSTR_PREFETCH_HINT(cpu_id, what, seg, offset) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_PREFETCH_HINT, bx_instr_prefetch_hint(cpu_id, what, seg, offset))
+
+/* execution */
+#define BX_INSTR_BEFORE_EXECUTION(cpu_id, i) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_BEFORE_EXECUTION, bx_instr_before_execution(cpu_id, i))
+#define BX_INSTR_AFTER_EXECUTION(cpu_id, i) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_AFTER_EXECUTION, bx_instr_after_execution(cpu_id, i))
+#define BX_INSTR_REPEAT_ITERATION(cpu_id, i) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_REPEAT_ITERATION, bx_instr_repeat_iteration(cpu_id, i))
+
+/* memory access */
+#define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, rw) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_LIN_ACCESS, bx_instr_lin_access(cpu_id, lin, phy, len, rw))
+
+/* memory access */
+#define BX_INSTR_MEM_DATA_ACCESS(cpu_id, seg, offset, len, rw) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_MEM_DATA_ACCESS, bx_instr_mem_data_access(cpu_id, seg, offset, len, rw))
+
+/* called from memory object */
+#define BX_INSTR_PHY_WRITE(cpu_id, addr, len) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_PHY_WRITE, bx_instr_phy_write(cpu_id, addr, len))
+#define BX_INSTR_PHY_READ(cpu_id, addr, len) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_PHY_READ, bx_instr_phy_read(cpu_id, addr, len))
+
+/* feedback from device units */
+#define BX_INSTR_INP(addr, len) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_INP, bx_instr_inp(addr, len))
+#define BX_INSTR_INP2(addr, len, val) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_INP2, bx_instr_inp2(addr, len, val))
+#define BX_INSTR_OUTP(addr, len, val) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_OUTP, bx_instr_outp(addr, len, val))
+
+/* wrmsr callback */
+#define BX_INSTR_WRMSR(cpu_id, addr, value) \
+    BX_INSTR_DISPATCH(BX_INSTR_EV_WRMSR, bx_instr_wrmsr(cpu_id, addr, value))
+
+#else // BX_INSTRUMENTATION
+
+/* initialization/deinitialization of instrumentalization */
+#define BX_INSTR_INIT_ENV()
+#define BX_INSTR_EXIT_ENV()
+
+/* simulation init, shutdown, reset */
+#define BX_INSTR_INITIALIZE(cpu_id)
+#define BX_INSTR_EXIT(cpu_id)
+#define BX_INSTR_RESET(cpu_id, type)
+#define BX_INSTR_HLT(cpu_id)
+#define BX_INSTR_MWAIT(cpu_id, addr, len, flags)
+#define BX_INSTR_NEW_INSTRUCTION(cpu_id)
+
+/* called from command line debugger */
+#define BX_INSTR_DEBUG_PROMPT()
+#define BX_INSTR_DEBUG_CMD(cmd)
+
+/* branch resoultion */
+#define BX_INSTR_CNEAR_BRANCH_TAKEN(cpu_id, new_eip)
+#define BX_INSTR_CNEAR_BRANCH_NOT_TAKEN(cpu_id)
+#define BX_INSTR_UCNEAR_BRANCH(cpu_id, what, new_eip)
+#define BX_INSTR_FAR_BRANCH(cpu_id, what, new_cs, new_eip)
+
+/* decoding completed */
+#define BX_INSTR_OPCODE(cpu_id, opcode, len, is32, is64)
+
+/* exceptional case and interrupt */
+#define BX_INSTR_EXCEPTION(cpu_id, vector, error_code)
+#define BX_INSTR_INTERRUPT(cpu_id, vector)
+#define BX_INSTR_HWINTERRUPT(cpu_id, vector, cs, eip)
+
+/* TLB/CACHE control instruction executed */
+#define BX_INSTR_CLFLUSH(cpu_id, laddr, paddr)
+#define BX_INSTR_CACHE_CNTRL(cpu_id, what)
+#define BX_INSTR_TLB_CNTRL(cpu_id, what, new_cr3)
+#define BX_INSTR_PREFETCH_HINT(cpu_id, what, seg, offset)
+
+/* execution */
+#define BX_INSTR_BEFORE_EXECUTION(cpu_id, i)
+#define BX_INSTR_AFTER_EXECUTION(cpu_id, i)
+#define BX_INSTR_REPEAT_ITERATION(cpu_id, i)
+
+/* memory access */
+#define BX_INSTR_LIN_ACCESS(cpu_id, lin, phy, len, rw)
+
+/* memory access */
+#define BX_INSTR_MEM_DATA_ACCESS(cpu_id, seg, offset, len, rw)
+
+/* called from memory object */
+#define BX_INSTR_PHY_WRITE(cpu_id, addr, len)
+#define BX_INSTR_PHY_READ(cpu_id, addr, len)
+
+/* feedback from device units */
+#define BX_INSTR_INP(addr, len)
+#define BX_INSTR_INP2(addr, len, val)
+#define BX_INSTR_OUTP(addr, len, val)
+
+/* wrmsr callback */
+#define BX_INSTR_WRMSR(cpu_id, addr, value)
+
+#endif // BX_INSTRUMENTATION
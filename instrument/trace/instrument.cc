@@ -0,0 +1,335 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//   Copyright (c) 2010  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+
+#include "bochs.h"
+#include "cpu/cpu.h"
+#include "trace.h"
+
+#if BX_HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#if BX_INSTRUMENTATION
+
+#define LOG_THIS genlog->
+
+//
+// Each CPU writes its records to a ring of chunks. A full chunk is queued
+// for the writer thread and the CPU continues with the next one, it only
+// waits if the writer is a whole ring behind. Without threads the chunk is
+// written right away.
+//
+#define TRACE_CHUNK_SIZE  (256*1024)
+#define TRACE_CHUNKS      4
+
+typedef struct {
+  Bit8u   *chunk[TRACE_CHUNKS];
+  Bit32u   chunk_len[TRACE_CHUNKS];
+  bx_bool  chunk_busy[TRACE_CHUNKS];  // queued or being written
+  unsigned cur;
+  Bit8u   *ptr, *end;
+  // state for the deltas, see trace.h
+  Bit64u   next, lin, phy;
+} trace_cpu_t;
+
+static char trace_path[BX_PATHNAME_LEN] = "";
+static bx_bool trace_memory = 0;
+
+static FILE *trace_fp = NULL;
+static trace_cpu_t *trace_cpus = NULL;
+static unsigned trace_num_cpus = 0;
+static Bit64u trace_bytes = 0;
+
+#if BX_HAVE_PTHREAD
+static pthread_t trace_thread;
+static pthread_mutex_t trace_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t trace_work = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t trace_free = PTHREAD_COND_INITIALIZER;
+// chunks queued for the writer, as cpu * TRACE_CHUNKS + chunk
+static unsigned *trace_queue = NULL;
+static unsigned trace_queue_head = 0, trace_queue_len = 0;
+static bx_bool trace_stop = 0;
+#endif
+
+static void trace_write_chunk(unsigned cpu, unsigned n)
+{
+  trace_cpu_t *t = &trace_cpus[cpu];
+  Bit8u hdr[TRACE_BLOCK_HEADER];
+  Bit32u len = t->chunk_len[n];
+
+  hdr[0] = (Bit8u) cpu;
+  hdr[1] = (Bit8u) len;
+  hdr[2] = (Bit8u)(len >> 8);
+  hdr[3] = (Bit8u)(len >> 16);
+  hdr[4] = (Bit8u)(len >> 24);
+  if (fwrite(hdr, 1, TRACE_BLOCK_HEADER, trace_fp) != TRACE_BLOCK_HEADER ||
+      fwrite(t->chunk[n], 1, len, trace_fp) != len)
+  {
+    BX_ERROR(("trace: error writing '%s'", trace_path));
+  }
+  trace_bytes += TRACE_BLOCK_HEADER + len;
+}
+
+#if BX_HAVE_PTHREAD
+static void *trace_writer(void *arg)
+{
+  pthread_mutex_lock(&trace_mutex);
+  for (;;) {
+    while (trace_queue_len == 0 && !trace_stop)
+      pthread_cond_wait(&trace_work, &trace_mutex);
+    if (trace_queue_len == 0)
+      break;
+    unsigned entry = trace_queue[trace_queue_head];
+    trace_queue_head = (trace_queue_head + 1) % (trace_num_cpus * TRACE_CHUNKS);
+    trace_queue_len--;
+    pthread_mutex_unlock(&trace_mutex);
+    trace_write_chunk(entry / TRACE_CHUNKS, entry % TRACE_CHUNKS);
+    pthread_mutex_lock(&trace_mutex);
+    trace_cpus[entry / TRACE_CHUNKS].chunk_busy[entry % TRACE_CHUNKS] = 0;
+    pthread_cond_broadcast(&trace_free);
+  }
+  pthread_mutex_unlock(&trace_mutex);
+  return NULL;
+}
+#endif
+
+// pass the records of the current chunk of a CPU to the writer
+static void trace_flush(unsigned cpu)
+{
+  trace_cpu_t *t = &trace_cpus[cpu];
+  unsigned n = t->cur;
+
+  t->chunk_len[n] = (Bit32u)(t->ptr - t->chunk[n]);
+  if (t->chunk_len[n] == 0)
+    return;
+#if BX_HAVE_PTHREAD
+  pthread_mutex_lock(&trace_mutex);
+  t->chunk_busy[n] = 1;
+  trace_queue[(trace_queue_head + trace_queue_len) % (trace_num_cpus * TRACE_CHUNKS)] =
+      cpu * TRACE_CHUNKS + n;
+  trace_queue_len++;
+  pthread_cond_signal(&trace_work);
+  n = (n + 1) % TRACE_CHUNKS;
+  while (t->chunk_busy[n])
+    pthread_cond_wait(&trace_free, &trace_mutex);
+  pthread_mutex_unlock(&trace_mutex);
+#else
+  trace_write_chunk(cpu, n);
+  n = (n + 1) % TRACE_CHUNKS;
+#endif
+  t->cur = n;
+  t->ptr = t->chunk[n];
+  t->end = t->chunk[n] + TRACE_CHUNK_SIZE - TRACE_MAX_RECORD;
+}
+
+BX_CPP_INLINE Bit8u *trace_put_varint(Bit8u *p, Bit64u val)
+{
+  while (val >= 0x80) {
+    *p++ = (Bit8u)(val | 0x80);
+    val >>= 7;
+  }
+  *p++ = (Bit8u) val;
+  return p;
+}
+
+BX_CPP_INLINE Bit8u *trace_put_delta(Bit8u *p, Bit64u val, Bit64u prev)
+{
+  Bit64s delta = (Bit64s)(val - prev);
+  return trace_put_varint(p, ((Bit64u) delta << 1) ^ (Bit64u)(delta >> 63));
+}
+
+// room for the next record of a CPU, NULL if the trace is off
+BX_CPP_INLINE trace_cpu_t *trace_record(unsigned cpu)
+{
+  if (trace_cpus == NULL)
+    return NULL;
+  trace_cpu_t *t = &trace_cpus[cpu];
+  if (t->ptr > t->end)
+    trace_flush(cpu);
+  return t;
+}
+
+static Bit32s trace_option_parser(const char *context, int num_params, char *params[])
+{
+  for (int i = 1; i < num_params; i++) {
+    if (!strncmp(params[i], "file=", 5)) {
+      strncpy(trace_path, &params[i][5], BX_PATHNAME_LEN);
+      trace_path[BX_PATHNAME_LEN - 1] = 0;
+    } else if (!strncmp(params[i], "memory=", 7)) {
+      trace_memory = atol(&params[i][7]) != 0;
+    } else {
+      BX_PANIC(("%s: unknown parameter for trace: '%s'", context, params[i]));
+    }
+  }
+  return 0;
+}
+
+static Bit32s trace_option_save(FILE *fp)
+{
+  if (trace_path[0] != 0)
+    fprintf(fp, "trace: file=%s, memory=%d\n", trace_path, trace_memory);
+  return 0;
+}
+
+void bx_instr_init_env(void)
+{
+  // trace: file=trace.bin, memory=1
+  SIM->register_user_option("trace", trace_option_parser, trace_option_save);
+}
+
+void bx_instr_exit_env(void)
+{
+  if (trace_cpus == NULL)
+    return;
+
+  for (unsigned cpu = 0; cpu < trace_num_cpus; cpu++)
+    trace_flush(cpu);
+#if BX_HAVE_PTHREAD
+  pthread_mutex_lock(&trace_mutex);
+  trace_stop = 1;
+  pthread_cond_signal(&trace_work);
+  pthread_mutex_unlock(&trace_mutex);
+  pthread_join(trace_thread, NULL);
+  delete [] trace_queue;
+  trace_queue = NULL;
+#endif
+  fclose(trace_fp);
+  trace_fp = NULL;
+  BX_INFO(("trace: " FMT_LL "u bytes written to '%s'", trace_bytes, trace_path));
+
+  for (unsigned cpu = 0; cpu < trace_num_cpus; cpu++)
+    for (unsigned n = 0; n < TRACE_CHUNKS; n++)
+      delete [] trace_cpus[cpu].chunk[n];
+  delete [] trace_cpus;
+  trace_cpus = NULL;
+}
+
+static void trace_start(void)
+{
+  trace_fp = fopen(trace_path, "wb");
+  if (trace_fp == NULL) {
+    BX_ERROR(("trace: cannot create '%s'", trace_path));
+    return;
+  }
+  fwrite(TRACE_MAGIC, 1, TRACE_MAGIC_LEN, trace_fp);
+
+  trace_num_cpus = BX_SMP_PROCESSORS;
+  trace_cpus = new trace_cpu_t[trace_num_cpus];
+  memset(trace_cpus, 0, trace_num_cpus * sizeof(trace_cpu_t));
+  for (unsigned cpu = 0; cpu < trace_num_cpus; cpu++) {
+    trace_cpu_t *t = &trace_cpus[cpu];
+    for (unsigned n = 0; n < TRACE_CHUNKS; n++)
+      t->chunk[n] = new Bit8u[TRACE_CHUNK_SIZE];
+    t->ptr = t->chunk[0];
+    t->end = t->chunk[0] + TRACE_CHUNK_SIZE - TRACE_MAX_RECORD;
+  }
+#if BX_HAVE_PTHREAD
+  trace_queue = new unsigned[trace_num_cpus * TRACE_CHUNKS];
+  trace_queue_head = trace_queue_len = 0;
+  trace_stop = 0;
+  if (pthread_create(&trace_thread, NULL, trace_writer, NULL) != 0)
+    BX_PANIC(("trace: cannot create the writer thread"));
+#endif
+  BX_INFO(("trace: writing the execution trace%s to '%s'",
+           trace_memory ? " with memory accesses" : "", trace_path));
+}
+
+void bx_instr_initialize(unsigned cpu)
+{
+  if (cpu == 0 && trace_path[0] != 0 && trace_cpus == NULL)
+    trace_start();
+}
+
+void bx_instr_exit(unsigned cpu)
+{
+  if (trace_cpus != NULL && cpu < trace_num_cpus)
+    trace_flush(cpu);
+}
+
+void bx_instr_before_execution(unsigned cpu, bxInstruction_c *i)
+{
+  trace_cpu_t *t = trace_record(cpu);
+  if (t == NULL) return;
+
+  BX_CPU_C *c = BX_CPU(cpu);
+  Bit64u addr = c->get_laddr(BX_SEG_REG_CS, c->get_instruction_pointer());
+  unsigned len = i->ilen();
+
+  if (addr == t->next) {
+    *t->ptr++ = TRACE_INSN | len;
+  }
+  else {
+    *t->ptr++ = TRACE_JUMP | len;
+    t->ptr = trace_put_delta(t->ptr, addr, t->next);
+  }
+  t->next = addr + len;
+}
+
+void bx_instr_lin_access(unsigned cpu, bx_address lin, bx_address phy, unsigned len, unsigned rw)
+{
+  if (! trace_memory) return;
+  trace_cpu_t *t = trace_record(cpu);
+  if (t == NULL) return;
+
+  *t->ptr++ = TRACE_MEM | rw;
+  *t->ptr++ = (Bit8u) len;
+  t->ptr = trace_put_delta(t->ptr, lin, t->lin);
+  t->ptr = trace_put_delta(t->ptr, phy, t->phy);
+  t->lin = lin;
+  t->phy = phy;
+}
+
+void bx_instr_tlb_cntrl(unsigned cpu, unsigned what, bx_phy_address new_cr3)
+{
+  if (what != BX_INSTR_MOV_CR3 && what != BX_INSTR_TASKSWITCH) return;
+  trace_cpu_t *t = trace_record(cpu);
+  if (t == NULL) return;
+
+  *t->ptr++ = TRACE_CR3;
+  t->ptr = trace_put_varint(t->ptr, new_cr3);
+}
+
+static void trace_event(unsigned cpu, unsigned type, unsigned vector)
+{
+  trace_cpu_t *t = trace_record(cpu);
+  if (t == NULL) return;
+
+  *t->ptr++ = TRACE_EVENT;
+  *t->ptr++ = (Bit8u) type;
+  t->ptr = trace_put_varint(t->ptr, vector);
+}
+
+void bx_instr_exception(unsigned cpu, unsigned vector, unsigned error_code)
+{
+  trace_event(cpu, TRACE_EVENT_EXCEPTION, vector);
+}
+
+void bx_instr_interrupt(unsigned cpu, unsigned vector)
+{
+  trace_event(cpu, TRACE_EVENT_INTERRUPT, vector);
+}
+
+void bx_instr_hwinterrupt(unsigned cpu, unsigned vector, Bit16u cs, bx_address eip)
+{
+  trace_event(cpu, TRACE_EVENT_HWINTERRUPT, vector);
+}
+
+#endif
@@ -0,0 +1,69 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//   Copyright (c) 2010  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+//
+// Binary execution trace format, shared by the trace library and the
+// misc/bxtrace decoder.
+//
+// The file starts with the magic. Then come blocks, each one a part of the
+// record stream of one CPU: the CPU number (1 byte), the length of the
+// data (4 bytes, little endian) and the data. The blocks of a CPU are in
+// order, the blocks of different CPUs are interleaved.
+//
+// A record starts with a tag byte. Numbers are varints of 7 bits per byte,
+// lowest first, signed numbers are zigzag encoded. The decoder keeps the
+// same state per CPU as the writer:
+//
+//   next  address after the last instruction
+//   lin   linear address of the last memory access
+//   phy   physical address of the last memory access
+//
+// TRACE_INSN | len               instruction of len bytes at next
+// TRACE_JUMP | len, delta        instruction of len bytes at next + delta
+// TRACE_MEM | rw, size, dlin, dphy
+//                                memory access of size bytes at lin + dlin,
+//                                phy + dphy, rw is BX_READ, BX_WRITE or BX_RW
+// TRACE_CR3, cr3                 new page table base
+// TRACE_EVENT, type, vector      exception, software or hardware interrupt
+//
+// Instruction addresses are linear addresses, the length is 1 to 15.
+//
+
+#ifndef BX_TRACE_FORMAT_H
+#define BX_TRACE_FORMAT_H
+
+#define TRACE_MAGIC        "BXTRACE1"
+#define TRACE_MAGIC_LEN    8
+#define TRACE_BLOCK_HEADER 5
+
+#define TRACE_INSN   0x10
+#define TRACE_JUMP   0x20
+#define TRACE_MEM    0x30
+#define TRACE_CR3    0x40
+#define TRACE_EVENT  0x41
+
+#define TRACE_EVENT_EXCEPTION    0
+#define TRACE_EVENT_INTERRUPT    1
+#define TRACE_EVENT_HWINTERRUPT  2
+
+// longest record: tag, size, two 64-bit zigzag varints
+#define TRACE_MAX_RECORD 22
+
+#endif
@@ -47,10 +47,13 @@ bx_devices_c::bx_devices_c()
 
   read_port_to_handler = NULL;
   write_port_to_handler = NULL;
+  bulk_read_port_to_handler = NULL;
+  bulk_write_port_to_handler = NULL;
   io_read_handlers.next = NULL;
   io_read_handlers.handler_name = NULL;
   io_write_handlers.next = NULL;
   io_write_handlers.handler_name = NULL;
+  dev_stats = NULL;
   init_stubs();
 
   for (unsigned i=0; i < BX_MAX_IRQS; i++) {
@@ -122,13 +125,21 @@ void bx_devices_c::init(BX_MEM_C *newmem)
     delete [] read_port_to_handler;
   if (write_port_to_handler)
     delete [] write_port_to_handler;
+  if (bulk_read_port_to_handler)
+    delete [] bulk_read_port_to_handler;
+  if (bulk_write_port_to_handler)
+    delete [] bulk_write_port_to_handler;
   read_port_to_handler = new struct io_handler_struct *[PORTS];
   write_port_to_handler = new struct io_handler_struct *[PORTS];
+  bulk_read_port_to_handler = new struct io_bulk_handler_struct *[PORTS];
+  bulk_write_port_to_handler = new struct io_bulk_handler_struct *[PORTS];
 
   /* set handlers to the default one */
   for (i=0; i < PORTS; i++) {
     read_port_to_handler[i] = &io_read_handlers;
     write_port_to_handler[i] = &io_write_handlers;
+    bulk_read_port_to_handler[i] = NULL;
+    bulk_write_port_to_handler[i] = NULL;
   }
 
   for (i=0; i < BX_MAX_IRQS; i++) {
@@ -352,11 +363,6 @@ void bx_devices_c::init(BX_MEM_C *newmem)
       (unsigned) BX_IODEV_HANDLER_PERIOD, 1, 1, "devices.cc");
   }
 
-  // Clear fields for bulk IO acceleration transfers.
-  bulkIOHostAddr = 0;
-  bulkIOQuantumsRequested = 0;
-  bulkIOQuantumsTransferred = 0;
-
   bx_init_plugins();
 
   /* now perform checksum of CMOS memory */
@@ -437,6 +443,14 @@ void bx_devices_c::exit()
     delete [] curr->handler_name;
     delete curr;
   }
+  if (bulk_read_port_to_handler && bulk_write_port_to_handler) {
+    for (unsigned port=0; port < PORTS; port++) {
+      delete bulk_read_port_to_handler[port];
+      bulk_read_port_to_handler[port] = NULL;
+      delete bulk_write_port_to_handler[port];
+      bulk_write_port_to_handler[port] = NULL;
+    }
+  }
 
   bx_virt_timer.setup();
   bx_slowdown_timer.exit();
@@ -611,6 +625,7 @@ bx_bool bx_devices_c::register_io_read_handler(void *this_ptr, bx_read_handler_t
     strcpy(io_read_handler->handler_name, name);
     io_read_handler->mask = mask;
     io_read_handler->usage_count = 0;
+    io_read_handler->count = &get_device_stats(BXPN_STATS_IO, name)[BX_READ];
     // add the handler to the double linked list of handlers
     io_read_handlers.prev->next = io_read_handler;
     io_read_handler->next = &io_read_handlers;
@@ -663,6 +678,7 @@ bx_bool bx_devices_c::register_io_write_handler(void *this_ptr, bx_write_handler
     strcpy(io_write_handler->handler_name, name);
     io_write_handler->mask = mask;
     io_write_handler->usage_count = 0;
+    io_write_handler->count = &get_device_stats(BXPN_STATS_IO, name)[BX_WRITE];
     // add the handler to the double linked list of handlers
     io_write_handlers.prev->next = io_write_handler;
     io_write_handler->next = &io_write_handlers;
@@ -726,6 +742,7 @@ bx_bool bx_devices_c::register_io_read_handler_range(void *this_ptr, bx_read_han
     strcpy(io_read_handler->handler_name, name);
     io_read_handler->mask = mask;
     io_read_handler->usage_count = 0;
+    io_read_handler->count = &get_device_stats(BXPN_STATS_IO, name)[BX_READ];
     // add the handler to the double linked list of handlers
     io_read_handlers.prev->next = io_read_handler;
     io_read_handler->next = &io_read_handlers;
@@ -790,6 +807,7 @@ bx_bool bx_devices_c::register_io_write_handler_range(void *this_ptr, bx_write_h
     strcpy(io_write_handler->handler_name, name);
     io_write_handler->mask = mask;
     io_write_handler->usage_count = 0;
+    io_write_handler->count = &get_device_stats(BXPN_STATS_IO, name)[BX_WRITE];
     // add the handler to the double linked list of handlers
     io_write_handlers.prev->next = io_write_handler;
     io_write_handler->next = &io_write_handlers;
@@ -816,6 +834,7 @@ bx_bool bx_devices_c::register_default_io_read_handler(void *this_ptr, bx_read_h
   io_read_handlers.handler_name = new char[strlen(name)+1];
   strcpy(io_read_handlers.handler_name, name);
   io_read_handlers.mask = mask;
+  io_read_handlers.count = &get_device_stats(BXPN_STATS_IO, name)[BX_READ];
 
   return 1;
 }
@@ -831,10 +850,86 @@ bx_bool bx_devices_c::register_default_io_write_handler(void *this_ptr, bx_write
   io_write_handlers.handler_name = new char[strlen(name)+1];
   strcpy(io_write_handlers.handler_name, name);
   io_write_handlers.mask = mask;
+  io_write_handlers.count = &get_device_stats(BXPN_STATS_IO, name)[BX_WRITE];
 
   return 1;
 }
 
+// Registration of bulk handlers for REP INS/OUTS block transfers.
+// A bulk handler can only be attached to a port already owned by the
+// same device and is removed together with the regular handler.
+bx_bool bx_devices_c::register_io_bulk_read_handler(void *this_ptr, bx_bulk_read_handler_t f,
+                                                    Bit32u addr, Bit8u mask)
+{
+  addr &= 0xffff;
+
+  if (!f)
+    return 0;
+
+  if (read_port_to_handler[addr] == &io_read_handlers ||
+      read_port_to_handler[addr]->this_ptr != this_ptr) {
+    BX_ERROR(("bulk IO read handler at IO address %Xh without device", (unsigned) addr));
+    return 0;
+  }
+
+  if (!bulk_read_port_to_handler[addr])
+    bulk_read_port_to_handler[addr] = new struct io_bulk_handler_struct;
+  bulk_read_port_to_handler[addr]->funct = (void *)f;
+  bulk_read_port_to_handler[addr]->this_ptr = this_ptr;
+  bulk_read_port_to_handler[addr]->mask = mask;
+  bulk_read_port_to_handler[addr]->count = read_port_to_handler[addr]->count;
+  return 1;
+}
+
+bx_bool bx_devices_c::register_io_bulk_write_handler(void *this_ptr, bx_bulk_write_handler_t f,
+                                                     Bit32u addr, Bit8u mask)
+{
+  addr &= 0xffff;
+
+  if (!f)
+    return 0;
+
+  if (write_port_to_handler[addr] == &io_write_handlers ||
+      write_port_to_handler[addr]->this_ptr != this_ptr) {
+    BX_ERROR(("bulk IO write handler at IO address %Xh without device", (unsigned) addr));
+    return 0;
+  }
+
+  if (!bulk_write_port_to_handler[addr])
+    bulk_write_port_to_handler[addr] = new struct io_bulk_handler_struct;
+  bulk_write_port_to_handler[addr]->funct = (void *)f;
+  bulk_write_port_to_handler[addr]->this_ptr = this_ptr;
+  bulk_write_port_to_handler[addr]->mask = mask;
+  bulk_write_port_to_handler[addr]->count = write_port_to_handler[addr]->count;
+  return 1;
+}
+
+bx_bool bx_devices_c::unregister_io_bulk_read_handler(void *this_ptr, Bit32u addr)
+{
+  addr &= 0xffff;
+
+  struct io_bulk_handler_struct *handler = bulk_read_port_to_handler[addr];
+  if (!handler || handler->this_ptr != this_ptr)
+    return 0;
+
+  bulk_read_port_to_handler[addr] = NULL;
+  delete handler;
+  return 1;
+}
+
+bx_bool bx_devices_c::unregister_io_bulk_write_handler(void *this_ptr, Bit32u addr)
+{
+  addr &= 0xffff;
+
+  struct io_bulk_handler_struct *handler = bulk_write_port_to_handler[addr];
+  if (!handler || handler->this_ptr != this_ptr)
+    return 0;
+
+  bulk_write_port_to_handler[addr] = NULL;
+  delete handler;
+  return 1;
+}
+
 bx_bool bx_devices_c::unregister_io_read_handler(void *this_ptr, bx_read_handler_t f,
                                          Bit32u addr, Bit8u mask)
 {
@@ -871,6 +966,8 @@ bx_bool bx_devices_c::unregister_io_read_handler(void *this_ptr, bx_read_handler
 
   read_port_to_handler[addr] = &io_read_handlers; // reset to default
   io_read_handler->usage_count--;
+  // bulk handler is only valid together with the regular one
+  unregister_io_bulk_read_handler(this_ptr, addr);
 
   if (!io_read_handler->usage_count) { // kill this handler entry
     io_read_handler->prev->next = io_read_handler->next;
@@ -905,6 +1002,8 @@ bx_bool bx_devices_c::unregister_io_write_handler(void *this_ptr, bx_write_handl
 
   write_port_to_handler[addr] = &io_write_handlers; // reset to default
   io_write_handler->usage_count--;
+  // bulk handler is only valid together with the regular one
+  unregister_io_bulk_write_handler(this_ptr, addr);
 
   if (!io_write_handler->usage_count) { // kill this handler entry
     io_write_handler->prev->next = io_write_handler->next;
@@ -952,6 +1051,40 @@ bx_bool bx_devices_c::unregister_io_write_handler_range(void *this_ptr, bx_write
 }
 
 
+/*
+ * Return the read and write counters (indexed by BX_READ and BX_WRITE) of
+ * the device name in the statistics list BXPN_STATS_IO or BXPN_STATS_MMIO.
+ * The counters and their parameters are created on first use, devices
+ * beyond BX_MAX_STATS_DEVICES share a pair of counters not in the list.
+ */
+
+  Bit64u*
+bx_devices_c::get_device_stats(const char *list, const char *name)
+{
+  bx_list_c *base = (bx_list_c*) SIM->get_param(list);
+  bx_list_c *dev = (bx_list_c*) base->get_by_name(name);
+  struct dev_stats_struct *stats;
+
+  for (stats = dev_stats; stats != NULL; stats = stats->next) {
+    if (stats->list == dev) return stats->count;
+  }
+
+  stats = new struct dev_stats_struct;
+  stats->count[BX_READ] = 0;
+  stats->count[BX_WRITE] = 0;
+  stats->next = dev_stats;
+  dev_stats = stats;
+  if (base->get_size() < BX_MAX_STATS_DEVICES) {
+    dev = new bx_list_c(base, name, name, 2);
+    new bx_shadow_num_c(dev, "read", &stats->count[BX_READ]);
+    new bx_shadow_num_c(dev, "write", &stats->count[BX_WRITE]);
+  } else {
+    dev = NULL;
+  }
+  stats->list = dev;
+  return stats->count;
+}
+
 /*
  * Read a byte of data from the IO memory address space
  */
@@ -965,6 +1098,7 @@ bx_devices_c::inp(Bit16u addr, unsigned io_len)
   BX_INSTR_INP(addr, io_len);
 
   io_read_handler = read_port_to_handler[addr];
+  (*io_read_handler->count)++;
   if (io_read_handler->mask & io_len) {
 	ret = ((bx_read_handler_t)io_read_handler->funct)(io_read_handler->this_ptr, (Bit32u)addr, io_len);
   } else {
@@ -998,6 +1132,7 @@ bx_devices_c::outp(Bit16u addr, Bit32u value, unsigned io_len)
   BX_DBG_IO_REPORT(addr, io_len, BX_WRITE, value);
 
   io_write_handler = write_port_to_handler[addr];
+  (*io_write_handler->count)++;
   if (io_write_handler->mask & io_len) {
 	((bx_write_handler_t)io_write_handler->funct)(io_write_handler->this_ptr, (Bit32u)addr, value, io_len);
   } else if (addr != 0x0cf8) { // don't flood the logfile when probing PCI
@@ -1005,6 +1140,44 @@ bx_devices_c::outp(Bit16u addr, Bit32u value, unsigned io_len)
   }
 }
 
+/*
+ * Transfer a block of data from the IO address space to a host buffer.
+ * Returns the number of elements transferred, 0 if the port has no bulk
+ * handler for this io_len and the caller must fall back to inp(). Each
+ * element counts as one access of the device.
+ */
+
+  Bit32u
+bx_devices_c::bulk_inp(Bit16u addr, Bit8u *data, unsigned io_len, Bit32u count)
+{
+  struct io_bulk_handler_struct *handler = bulk_read_port_to_handler[addr];
+
+  if (!handler || !(handler->mask & io_len))
+    return 0;
+
+  Bit32u done = ((bx_bulk_read_handler_t)handler->funct)(handler->this_ptr, (Bit32u)addr, data, io_len, count);
+  *handler->count += done;
+  return done;
+}
+
+
+/*
+ * Transfer a block of data from a host buffer to the IO address space.
+ */
+
+  Bit32u
+bx_devices_c::bulk_outp(Bit16u addr, const Bit8u *data, unsigned io_len, Bit32u count)
+{
+  struct io_bulk_handler_struct *handler = bulk_write_port_to_handler[addr];
+
+  if (!handler || !(handler->mask & io_len))
+    return 0;
+
+  Bit32u done = ((bx_bulk_write_handler_t)handler->funct)(handler->this_ptr, (Bit32u)addr, data, io_len, count);
+  *handler->count += done;
+  return done;
+}
+
 bx_bool bx_devices_c::is_harddrv_enabled(void)
 {
   char pname[24];
@@ -90,7 +90,7 @@ eth_locator_c::create(const char *type, const char *netif,
 #ifdef eth_static_constructors
   for (eth_locator_c *p = all; p != NULL; p = p->next) {
     if (strcmp(type, p->type) == 0)
-      return (p->allocate(netif, macaddr, rxh, dev, script));
+      return (p->allocate(netif, macaddr, bx_replay.register_net(rxh, dev), dev, script));
   }
 #else
   eth_locator_c *ptr = 0;
@@ -148,7 +148,7 @@ eth_locator_c::create(const char *type, const char *netif,
       ptr = (eth_locator_c *) &bx_vnet_match;
   }
   if (ptr)
-    return (ptr->allocate(netif, macaddr, rxh, dev, script));
+    return (ptr->allocate(netif, macaddr, bx_replay.register_net(rxh, dev), dev, script));
 #endif
 
   return (NULL);
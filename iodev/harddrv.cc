@@ -207,6 +207,10 @@ void bx_hard_drive_c::init(void)
                            BX_HD_THIS channels[channel].ioaddr1, string, 6);
       DEV_register_iowrite_handler(this, write_handler,
                            BX_HD_THIS channels[channel].ioaddr1, string, 6);
+      DEV_register_iobulk_read_handler(this, bulk_read_handler,
+                           BX_HD_THIS channels[channel].ioaddr1, 6);
+      DEV_register_iobulk_write_handler(this, bulk_write_handler,
+                           BX_HD_THIS channels[channel].ioaddr1, 6);
       for (unsigned addr=0x1; addr<=0x7; addr++) {
         DEV_register_ioread_handler(this, read_handler,
                              BX_HD_THIS channels[channel].ioaddr1+addr, string, 1);
@@ -813,24 +817,6 @@ Bit32u bx_hard_drive_c::read(Bit32u address, unsigned io_len)
           if (BX_SELECTED_CONTROLLER(channel).buffer_index >= BX_SELECTED_CONTROLLER(channel).buffer_size)
             BX_PANIC(("IO read(0x%04x): buffer_index >= %d", address, BX_SELECTED_CONTROLLER(channel).buffer_size));
 
-#if BX_SupportRepeatSpeedups
-          if (DEV_bulk_io_quantum_requested()) {
-            unsigned transferLen, quantumsMax;
-            quantumsMax = (BX_SELECTED_CONTROLLER(channel).buffer_size - BX_SELECTED_CONTROLLER(channel).buffer_index) / io_len;
-            if (quantumsMax == 0)
-              BX_PANIC(("IO read(0x%04x): not enough space for read", address));
-            DEV_bulk_io_quantum_transferred() = DEV_bulk_io_quantum_requested();
-            if (quantumsMax < DEV_bulk_io_quantum_transferred())
-              DEV_bulk_io_quantum_transferred() = quantumsMax;
-            transferLen = io_len * DEV_bulk_io_quantum_transferred();
-            memcpy((Bit8u*) DEV_bulk_io_host_addr(),
-              &BX_SELECTED_CONTROLLER(channel).buffer[BX_SELECTED_CONTROLLER(channel).buffer_index], transferLen);
-            DEV_bulk_io_host_addr() += transferLen;
-            BX_SELECTED_CONTROLLER(channel).buffer_index += transferLen;
-            value32 = 0; // Value returned not important;
-          }
-          else
-#endif
           {
             value32 = 0L;
             switch(io_len){
@@ -1270,23 +1256,6 @@ void bx_hard_drive_c::write(Bit32u address, Bit32u value, unsigned io_len)
           if (BX_SELECTED_CONTROLLER(channel).buffer_index >= BX_SELECTED_CONTROLLER(channel).buffer_size)
             BX_PANIC(("IO write(0x%04x): buffer_index >= %d", address, BX_SELECTED_CONTROLLER(channel).buffer_size));
 
-#if BX_SupportRepeatSpeedups
-          if (DEV_bulk_io_quantum_requested()) {
-            unsigned transferLen, quantumsMax;
-            quantumsMax = (BX_SELECTED_CONTROLLER(channel).buffer_size - BX_SELECTED_CONTROLLER(channel).buffer_index) / io_len;
-            if (quantumsMax == 0)
-              BX_PANIC(("IO write(0x%04x): not enough space for write", address));
-            DEV_bulk_io_quantum_transferred() = DEV_bulk_io_quantum_requested();
-            if (quantumsMax < DEV_bulk_io_quantum_transferred())
-              DEV_bulk_io_quantum_transferred() = quantumsMax;
-            transferLen = io_len * DEV_bulk_io_quantum_transferred();
-            memcpy(&BX_SELECTED_CONTROLLER(channel).buffer[BX_SELECTED_CONTROLLER(channel).buffer_index],
-              (Bit8u*) DEV_bulk_io_host_addr(), transferLen);
-            DEV_bulk_io_host_addr() += transferLen;
-            BX_SELECTED_CONTROLLER(channel).buffer_index += transferLen;
-          }
-          else
-#endif
           {
             switch(io_len) {
               case 4:
@@ -2654,6 +2623,149 @@ void bx_hard_drive_c::write(Bit32u address, Bit32u value, unsigned io_len)
     }
 }
 
+// static IO port bulk read callback handler for REP INSW/INSD
+// from the data port: copies the sector data straight out of the
+// controller buffer, the last element goes through the regular
+// read handler which updates the controller state
+Bit32u bx_hard_drive_c::bulk_read_handler(void *this_ptr, Bit32u address, Bit8u *data, unsigned io_len, Bit32u count)
+{
+#if !BX_USE_HD_SMF
+  bx_hard_drive_c *class_ptr = (bx_hard_drive_c *) this_ptr;
+  return class_ptr->bulk_read(address, data, io_len, count);
+}
+
+Bit32u bx_hard_drive_c::bulk_read(Bit32u address, Bit8u *data, unsigned io_len, Bit32u count)
+{
+#else
+  UNUSED(this_ptr);
+#endif  // !BX_USE_HD_SMF
+  Bit8u  channel;
+  Bit32u avail, len;
+
+  for (channel=0; channel<BX_MAX_ATA_CHANNEL; channel++) {
+    if (address == BX_HD_THIS channels[channel].ioaddr1)
+      break;
+  }
+  if (channel == BX_MAX_ATA_CHANNEL)
+    return 0;
+
+  if (BX_SELECTED_CONTROLLER(channel).status.drq == 0)
+    return 0;
+  if (BX_SELECTED_CONTROLLER(channel).buffer_index >= BX_SELECTED_CONTROLLER(channel).buffer_size)
+    return 0;
+
+  avail = BX_SELECTED_CONTROLLER(channel).buffer_size - BX_SELECTED_CONTROLLER(channel).buffer_index;
+  switch (BX_SELECTED_CONTROLLER(channel).current_command) {
+    case 0x20: // READ SECTORS, with retries
+    case 0x21: // READ SECTORS, without retries
+    case 0xC4: // READ MULTIPLE SECTORS
+    case 0x24: // READ SECTORS EXT
+    case 0x29: // READ MULTIPLE EXT
+      break;
+
+    case 0xec: // IDENTIFY DEVICE
+    case 0xa1: // IDENTIFY PACKET DEVICE
+      if (BX_SELECTED_CONTROLLER(channel).buffer_index >= 512)
+        return 0;
+      len = 512 - BX_SELECTED_CONTROLLER(channel).buffer_index;
+      if (len < avail) avail = len;
+      break;
+
+    case 0xa0:
+      len = BX_SELECTED_DRIVE(channel).atapi.drq_bytes - BX_SELECTED_CONTROLLER(channel).drq_index;
+      if (len < avail) avail = len;
+      break;
+
+    default:
+      return 0;
+  }
+
+  if (count > avail / io_len)
+    count = avail / io_len;
+  if (count == 0)
+    return 0;
+
+  len = (count - 1) * io_len;
+  memcpy(data, &BX_SELECTED_CONTROLLER(channel).buffer[BX_SELECTED_CONTROLLER(channel).buffer_index], len);
+  BX_SELECTED_CONTROLLER(channel).buffer_index += len;
+  if (BX_SELECTED_CONTROLLER(channel).current_command == 0xa0)
+    BX_SELECTED_CONTROLLER(channel).drq_index += len;
+
+  Bit32u value32 = read_handler(theHardDrive, address, io_len);
+  data += len;
+  if (io_len == 4) {
+    WriteHostDWordToLittleEndian(data, value32);
+  }
+  else {
+    WriteHostWordToLittleEndian(data, (Bit16u) value32);
+  }
+
+  return count;
+}
+
+// static IO port bulk write callback handler for REP OUTSW/OUTSD
+// to the data port
+Bit32u bx_hard_drive_c::bulk_write_handler(void *this_ptr, Bit32u address, const Bit8u *data, unsigned io_len, Bit32u count)
+{
+#if !BX_USE_HD_SMF
+  bx_hard_drive_c *class_ptr = (bx_hard_drive_c *) this_ptr;
+  return class_ptr->bulk_write(address, data, io_len, count);
+}
+
+Bit32u bx_hard_drive_c::bulk_write(Bit32u address, const Bit8u *data, unsigned io_len, Bit32u count)
+{
+#else
+  UNUSED(this_ptr);
+#endif  // !BX_USE_HD_SMF
+  Bit8u  channel;
+  Bit32u avail, len;
+
+  for (channel=0; channel<BX_MAX_ATA_CHANNEL; channel++) {
+    if (address == BX_HD_THIS channels[channel].ioaddr1)
+      break;
+  }
+  if (channel == BX_MAX_ATA_CHANNEL)
+    return 0;
+
+  switch (BX_SELECTED_CONTROLLER(channel).current_command) {
+    case 0x30: // WRITE SECTORS
+    case 0xC5: // WRITE MULTIPLE SECTORS
+    case 0x34: // WRITE SECTORS EXT
+    case 0x39: // WRITE MULTIPLE EXT
+      break;
+
+    default:
+      return 0;
+  }
+
+  if (BX_SELECTED_CONTROLLER(channel).buffer_index >= BX_SELECTED_CONTROLLER(channel).buffer_size)
+    return 0;
+
+  avail = BX_SELECTED_CONTROLLER(channel).buffer_size - BX_SELECTED_CONTROLLER(channel).buffer_index;
+  if (count > avail / io_len)
+    count = avail / io_len;
+  if (count == 0)
+    return 0;
+
+  len = (count - 1) * io_len;
+  memcpy(&BX_SELECTED_CONTROLLER(channel).buffer[BX_SELECTED_CONTROLLER(channel).buffer_index], data, len);
+  BX_SELECTED_CONTROLLER(channel).buffer_index += len;
+
+  Bit32u value32;
+  data += len;
+  if (io_len == 4) {
+    ReadHostDWordFromLittleEndian(data, value32);
+  }
+  else {
+    Bit16u value16;
+    ReadHostWordFromLittleEndian(data, value16);
+    value32 = value16;
+  }
+  write_handler(theHardDrive, address, value32, io_len);
+
+  return count;
+}
+
   bx_bool BX_CPP_AttrRegparmN(2)
 bx_hard_drive_c::calculate_logical_address(Bit8u channel, Bit64s *sector)
 {
@@ -191,10 +191,14 @@ public:
 #if !BX_USE_HD_SMF
   Bit32u read(Bit32u address, unsigned io_len);
   void   write(Bit32u address, Bit32u value, unsigned io_len);
+  Bit32u bulk_read(Bit32u address, Bit8u *data, unsigned io_len, Bit32u count);
+  Bit32u bulk_write(Bit32u address, const Bit8u *data, unsigned io_len, Bit32u count);
 #endif
 
   static Bit32u read_handler(void *this_ptr, Bit32u address, unsigned io_len);
   static void   write_handler(void *this_ptr, Bit32u address, Bit32u value, unsigned io_len);
+  static Bit32u bulk_read_handler(void *this_ptr, Bit32u address, Bit8u *data, unsigned io_len, Bit32u count);
+  static Bit32u bulk_write_handler(void *this_ptr, Bit32u address, const Bit8u *data, unsigned io_len, Bit32u count);
 
   static void iolight_timer_handler(void *);
   BX_HD_SMF void iolight_timer(void);
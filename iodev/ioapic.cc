@@ -119,7 +119,7 @@ void bx_ioapic_c::init(void)
 {
   BX_INFO(("initializing I/O APIC"));
   DEV_register_memory_handlers(theIOAPIC,
-      ioapic_read, ioapic_write, base_addr, base_addr + 0xfff);
+      ioapic_read, ioapic_write, base_addr, base_addr + 0xfff, "I/O APIC");
   reset(BX_RESET_HARDWARE);
 }
 
@@ -32,6 +32,8 @@
    PIC chips cascaded together.  each has 8 IRQ lines, so there
    should be 16 IRQ's total */
 #define BX_MAX_IRQS 16
+// maximum number of devices in the stats.io and stats.mmio lists
+#define BX_MAX_STATS_DEVICES 64
 
 /* size of internal buffer for mouse devices */
 #define BX_MOUSE_BUFF_SIZE 48
@@ -42,6 +44,11 @@ class bx_g2h_c;
 
 typedef Bit32u (*bx_read_handler_t)(void *, Bit32u, unsigned);
 typedef void   (*bx_write_handler_t)(void *, Bit32u, Bit32u, unsigned);
+// bulk I/O handlers transfer up to 'count' elements of 'io_len' bytes
+// between the port and a host buffer in guest (little endian) byte order
+// and return the number of elements actually transferred
+typedef Bit32u (*bx_bulk_read_handler_t)(void *, Bit32u, Bit8u *, unsigned, Bit32u);
+typedef Bit32u (*bx_bulk_write_handler_t)(void *, Bit32u, const Bit8u *, unsigned, Bit32u);
 
 typedef bx_bool (*bx_keyb_enq_t)(void *, Bit8u *);
 typedef void (*bx_mouse_enq_t)(void *, int, int, int, unsigned);
@@ -270,7 +277,8 @@ public:
     return 0;
   }
   virtual bx_bool pci_set_base_mem(void *this_ptr, memory_handler_t f1, memory_handler_t f2,
-                                   Bit32u *addr, Bit8u *pci_conf, unsigned size) {
+                                   Bit32u *addr, Bit8u *pci_conf, unsigned size,
+                                   const char *name) {
     STUBFUNC(pci, pci_set_base_mem);
     return 0;
   }
@@ -383,10 +391,19 @@ public:
                                             Bit32u begin, Bit32u end, Bit8u mask);
   bx_bool register_default_io_read_handler(void *this_ptr, bx_read_handler_t f, const char *name, Bit8u mask);
   bx_bool register_default_io_write_handler(void *this_ptr, bx_write_handler_t f, const char *name, Bit8u mask);
+  bx_bool register_io_bulk_read_handler(void *this_ptr, bx_bulk_read_handler_t f,
+                                        Bit32u addr, Bit8u mask);
+  bx_bool register_io_bulk_write_handler(void *this_ptr, bx_bulk_write_handler_t f,
+                                         Bit32u addr, Bit8u mask);
+  bx_bool unregister_io_bulk_read_handler(void *this_ptr, Bit32u addr);
+  bx_bool unregister_io_bulk_write_handler(void *this_ptr, Bit32u addr);
   bx_bool register_irq(unsigned irq, const char *name);
   bx_bool unregister_irq(unsigned irq, const char *name);
   Bit32u inp(Bit16u addr, unsigned io_len) BX_CPP_AttrRegparmN(2);
   void   outp(Bit16u addr, Bit32u value, unsigned io_len) BX_CPP_AttrRegparmN(3);
+  Bit32u bulk_inp(Bit16u addr, Bit8u *data, unsigned io_len, Bit32u count);
+  Bit32u bulk_outp(Bit16u addr, const Bit8u *data, unsigned io_len, Bit32u count);
+  Bit64u *get_device_stats(const char *list, const char *name);
 
   void register_removable_keyboard(void *dev, bx_keyb_enq_t keyb_enq);
   void unregister_removable_keyboard(void *dev);
@@ -450,16 +467,6 @@ public:
   bx_ioapic_stub_c stubIOAPIC;
 #endif
 
-  // Some info to pass to devices which can handled bulk IO.  This allows
-  // the interface to remain the same for IO devices which can't handle
-  // bulk IO.  We should probably implement special INPBulk() and OUTBulk()
-  // functions which stick these values in the bx_devices_c class, and
-  // then call the normal functions rather than having gross globals
-  // variables.
-  Bit8u*   bulkIOHostAddr;
-  unsigned bulkIOQuantumsRequested;
-  unsigned bulkIOQuantumsTransferred;
-
 private:
 
   struct io_handler_struct {
@@ -470,6 +477,7 @@ private:
 	char *handler_name;  // name of device
 	int usage_count;
 	Bit8u mask;          // io_len mask
+	Bit64u *count;       // access counter of the device (stats)
   };
   struct io_handler_struct io_read_handlers;
   struct io_handler_struct io_write_handlers;
@@ -477,6 +485,24 @@ private:
   struct io_handler_struct **read_port_to_handler;
   struct io_handler_struct **write_port_to_handler;
 
+  // optional per port handlers for REP INS/OUTS block transfers
+  struct io_bulk_handler_struct {
+	void *funct;
+	void *this_ptr;
+	Bit8u mask;          // io_len mask
+	Bit64u *count;       // access counter of the owning device (stats)
+  };
+  struct io_bulk_handler_struct **bulk_read_port_to_handler;
+  struct io_bulk_handler_struct **bulk_write_port_to_handler;
+
+  // read and write counters of the devices in the stats.io and stats.mmio
+  // lists, shared by all handlers registered with the same device name
+  struct dev_stats_struct {
+	struct dev_stats_struct *next;
+	bx_list_c *list;
+	Bit64u count[2];     // indexed by BX_READ / BX_WRITE
+  } *dev_stats;
+
   // more for informative purposes, the names of the devices which
   // are use each of the IRQ 0..15 lines are stored here
   char *irq_handler_name[BX_MAX_IRQS];
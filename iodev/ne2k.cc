@@ -237,6 +237,12 @@ void bx_ne2k_c::after_restore_state(void)
                             &BX_NE2K_THIS s.base_address,
                             &BX_NE2K_THIS s.pci_conf[0x10],
                             32, &ne2k_iomask[0], "NE2000 PCI NIC")) {
+      if (BX_NE2K_THIS s.base_address > 0) {
+        DEV_register_iobulk_read_handler(BX_NE2K_THIS_PTR, bulk_read_handler,
+                                         BX_NE2K_THIS s.base_address + 0x10, 7);
+        DEV_register_iobulk_write_handler(BX_NE2K_THIS_PTR, bulk_write_handler,
+                                          BX_NE2K_THIS s.base_address + 0x10, 7);
+      }
       BX_INFO(("new base address: 0x%04x", BX_NE2K_THIS s.base_address));
     }
   }
@@ -1237,6 +1243,135 @@ void bx_ne2k_c::write(Bit32u address, Bit32u value, unsigned io_len)
 }
 
 
+//
+// bulk_read_handler/bulk_read - REP INS from the asic data port.
+// Copies the remote-DMA data straight out of the packet memory up to
+// the ring wrap point, the last element goes through asic_read to
+// update the DMA registers and raise the completion interrupt
+//
+Bit32u bx_ne2k_c::bulk_read_handler(void *this_ptr, Bit32u address, Bit8u *data,
+                                    unsigned io_len, Bit32u count)
+{
+#if !BX_USE_NE2K_SMF
+  bx_ne2k_c *class_ptr = (bx_ne2k_c *) this_ptr;
+
+  return class_ptr->bulk_read(address, data, io_len, count);
+}
+
+Bit32u bx_ne2k_c::bulk_read(Bit32u address, Bit8u *data, unsigned io_len, Bit32u count)
+{
+#else
+  UNUSED(this_ptr);
+#endif  // !BX_USE_NE2K_SMF
+  Bit32u avail, end, len, value;
+
+  if ((address - BX_NE2K_THIS s.base_address) != 0x10)
+    return 0;
+  // the 8390 steps by its own word size, only handle matching accesses
+  if ((io_len != 4) && (io_len != (unsigned)(BX_NE2K_THIS s.DCR.wdsize + 1)))
+    return 0;
+  if ((BX_NE2K_THIS s.remote_dma < BX_NE2K_MEMSTART) || (BX_NE2K_THIS s.remote_dma & (io_len - 1)))
+    return 0;
+
+  end = BX_NE2K_THIS s.page_stop << 8;
+  if ((end == 0) || (end > BX_NE2K_MEMEND))
+    end = BX_NE2K_MEMEND;
+  if (BX_NE2K_THIS s.remote_dma >= end)
+    return 0;
+
+  avail = end - BX_NE2K_THIS s.remote_dma;
+  if (avail > BX_NE2K_THIS s.remote_bytes)
+    avail = BX_NE2K_THIS s.remote_bytes;
+  if (count > avail / io_len)
+    count = avail / io_len;
+  if (count == 0)
+    return 0;
+
+  len = (count - 1) * io_len;
+  memcpy(data, &BX_NE2K_THIS s.mem[BX_NE2K_THIS s.remote_dma - BX_NE2K_MEMSTART], len);
+  BX_NE2K_THIS s.remote_dma += len;
+  BX_NE2K_THIS s.remote_bytes -= len;
+
+  value = asic_read(0x0, io_len);
+  data += len;
+  switch (io_len) {
+    case 4:
+      WriteHostDWordToLittleEndian(data, value);
+      break;
+    case 2:
+      WriteHostWordToLittleEndian(data, (Bit16u) value);
+      break;
+    default:
+      *data = (Bit8u) value;
+  }
+
+  return count;
+}
+
+//
+// bulk_write_handler/bulk_write - REP OUTS to the asic data port
+//
+Bit32u bx_ne2k_c::bulk_write_handler(void *this_ptr, Bit32u address, const Bit8u *data,
+                                     unsigned io_len, Bit32u count)
+{
+#if !BX_USE_NE2K_SMF
+  bx_ne2k_c *class_ptr = (bx_ne2k_c *) this_ptr;
+
+  return class_ptr->bulk_write(address, data, io_len, count);
+}
+
+Bit32u bx_ne2k_c::bulk_write(Bit32u address, const Bit8u *data, unsigned io_len, Bit32u count)
+{
+#else
+  UNUSED(this_ptr);
+#endif  // !BX_USE_NE2K_SMF
+  Bit32u avail, end, len, value;
+
+  if ((address - BX_NE2K_THIS s.base_address) != 0x10)
+    return 0;
+  if ((io_len != 4) && (io_len != (unsigned)(BX_NE2K_THIS s.DCR.wdsize + 1)))
+    return 0;
+  if ((BX_NE2K_THIS s.remote_dma < BX_NE2K_MEMSTART) || (BX_NE2K_THIS s.remote_dma & (io_len - 1)))
+    return 0;
+
+  end = BX_NE2K_THIS s.page_stop << 8;
+  if ((end == 0) || (end > BX_NE2K_MEMEND))
+    end = BX_NE2K_MEMEND;
+  if (BX_NE2K_THIS s.remote_dma >= end)
+    return 0;
+
+  avail = end - BX_NE2K_THIS s.remote_dma;
+  if (avail > BX_NE2K_THIS s.remote_bytes)
+    avail = BX_NE2K_THIS s.remote_bytes;
+  if (count > avail / io_len)
+    count = avail / io_len;
+  if (count == 0)
+    return 0;
+
+  len = (count - 1) * io_len;
+  memcpy(&BX_NE2K_THIS s.mem[BX_NE2K_THIS s.remote_dma - BX_NE2K_MEMSTART], data, len);
+  BX_NE2K_THIS s.remote_dma += len;
+  BX_NE2K_THIS s.remote_bytes -= len;
+
+  data += len;
+  switch (io_len) {
+    case 4:
+      ReadHostDWordFromLittleEndian(data, value);
+      break;
+    case 2:
+      Bit16u value16;
+      ReadHostWordFromLittleEndian(data, value16);
+      value = value16;
+      break;
+    default:
+      value = *data;
+  }
+  asic_write(0x0, value, io_len);
+
+  return count;
+}
+
+
 /*
  * mcast_index() - return the 6-bit index into the multicast
  * table. Stolen unashamedly from FreeBSD's if_ed.c
@@ -1470,6 +1605,10 @@ void bx_ne2k_c::init(void)
     DEV_register_iowrite_handler(BX_NE2K_THIS_PTR, write_handler,
                                  BX_NE2K_THIS s.base_address + 0x10,
                                  devname, 3);
+    DEV_register_iobulk_read_handler(BX_NE2K_THIS_PTR, bulk_read_handler,
+                                     BX_NE2K_THIS s.base_address + 0x10, 3);
+    DEV_register_iobulk_write_handler(BX_NE2K_THIS_PTR, bulk_write_handler,
+                                      BX_NE2K_THIS s.base_address + 0x10, 3);
     DEV_register_ioread_handler(BX_NE2K_THIS_PTR, read_handler,
                                 BX_NE2K_THIS s.base_address + 0x1F,
                                 devname, 1);
@@ -1603,6 +1742,12 @@ void bx_ne2k_c::pci_write_handler(Bit8u address, Bit32u value, unsigned io_len)
                             &BX_NE2K_THIS s.base_address,
                             &BX_NE2K_THIS s.pci_conf[0x10],
                             32, &ne2k_iomask[0], "NE2000 PCI NIC")) {
+      if (BX_NE2K_THIS s.base_address > 0) {
+        DEV_register_iobulk_read_handler(BX_NE2K_THIS_PTR, bulk_read_handler,
+                                         BX_NE2K_THIS s.base_address + 0x10, 7);
+        DEV_register_iobulk_write_handler(BX_NE2K_THIS_PTR, bulk_write_handler,
+                                          BX_NE2K_THIS s.base_address + 0x10, 7);
+      }
       BX_INFO(("new base address: 0x%04x", BX_NE2K_THIS s.base_address));
     }
   }
@@ -250,9 +250,13 @@ private:
 
   static Bit32u read_handler(void *this_ptr, Bit32u address, unsigned io_len);
   static void   write_handler(void *this_ptr, Bit32u address, Bit32u value, unsigned io_len);
+  static Bit32u bulk_read_handler(void *this_ptr, Bit32u address, Bit8u *data, unsigned io_len, Bit32u count);
+  static Bit32u bulk_write_handler(void *this_ptr, Bit32u address, const Bit8u *data, unsigned io_len, Bit32u count);
 #if !BX_USE_NE2K_SMF
   Bit32u read(Bit32u address, unsigned io_len);
   void   write(Bit32u address, Bit32u value, unsigned io_len);
+  Bit32u bulk_read(Bit32u address, Bit8u *data, unsigned io_len, Bit32u count);
+  Bit32u bulk_write(Bit32u address, const Bit8u *data, unsigned io_len, Bit32u count);
 #endif
 };
 
@@ -533,7 +533,8 @@ bx_bool bx_pci_bridge_c::is_pci_device(const char *name)
 }
 
 bx_bool bx_pci_bridge_c::pci_set_base_mem(void *this_ptr, memory_handler_t f1, memory_handler_t f2,
-                           Bit32u *addr, Bit8u *pci_conf, unsigned size)
+                           Bit32u *addr, Bit8u *pci_conf, unsigned size,
+                           const char *name)
 {
   Bit32u newbase;
 
@@ -555,7 +556,7 @@ bx_bool bx_pci_bridge_c::pci_set_base_mem(void *this_ptr, memory_handler_t f1, m
       DEV_unregister_memory_handlers(f1, f2, oldbase, oldbase + size - 1);
     }
     if (newbase > 0) {
-      DEV_register_memory_handlers(this_ptr, f1, f2, newbase, newbase + size - 1);
+      DEV_register_memory_handlers(this_ptr, f1, f2, newbase, newbase + size - 1, name);
     }
     *addr = newbase;
     return 1;
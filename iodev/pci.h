@@ -60,7 +60,8 @@ public:
   virtual bx_bool is_pci_device(const char *name);
   virtual bx_bool pci_set_base_mem(void *this_ptr, memory_handler_t f1,
                                    memory_handler_t f2, Bit32u *addr,
-                                   Bit8u *pci_conf, unsigned size);
+                                   Bit8u *pci_conf, unsigned size,
+                                   const char *name);
   virtual bx_bool pci_set_base_io(void *this_ptr, bx_read_handler_t f1,
                                   bx_write_handler_t f2, Bit32u *addr,
                                   Bit8u *pci_conf, unsigned size,
@@ -343,7 +343,7 @@ void bx_pcidev_c::pci_write_handler(Bit8u address, Bit32u value, unsigned io_len
           pcidev_mem_write_handler,
           &BX_PCIDEV_THIS regions[io_reg_idx].start,
           (Bit8u*)&BX_PCIDEV_THIS regions[io_reg_idx].config_value,
-          BX_PCIDEV_THIS regions[io_reg_idx].size)) {
+          BX_PCIDEV_THIS regions[io_reg_idx].size, "pcidev")) {
             BX_INFO(("new base #%d memory address: 0x%08x", io_reg_idx,
                      BX_PCIDEV_THIS regions[io_reg_idx].start));
       }
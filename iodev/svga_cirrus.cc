@@ -440,14 +440,16 @@ void bx_svga_cirrus_c::after_restore_state(void)
                                cirrus_mem_write_handler,
                                &BX_CIRRUS_THIS pci_memaddr,
                                &BX_CIRRUS_THIS pci_conf[0x10],
-                               0x2000000)) {
+                               0x2000000,
+                               "vga video")) {
         BX_INFO(("new pci_memaddr: 0x%04x", BX_CIRRUS_THIS pci_memaddr));
       }
       if (DEV_pci_set_base_mem(BX_CIRRUS_THIS_PTR, cirrus_mem_read_handler,
                                cirrus_mem_write_handler,
                                &BX_CIRRUS_THIS pci_mmioaddr,
                                &BX_CIRRUS_THIS pci_conf[0x14],
-                               CIRRUS_PNPMMIO_SIZE)) {
+                               CIRRUS_PNPMMIO_SIZE,
+                               "vga video")) {
         BX_INFO(("new pci_mmioaddr = 0x%08x", BX_CIRRUS_THIS pci_mmioaddr));
       }
     }
@@ -2430,7 +2432,8 @@ void bx_svga_cirrus_c::pci_write_handler(Bit8u address, Bit32u value, unsigned i
                              cirrus_mem_write_handler,
                              &BX_CIRRUS_THIS pci_memaddr,
                              &BX_CIRRUS_THIS pci_conf[0x10],
-                             0x2000000)) {
+                             0x2000000,
+                             "vga video")) {
       BX_INFO(("new pci_memaddr: 0x%04x", BX_CIRRUS_THIS pci_memaddr));
     }
   }
@@ -2439,7 +2442,8 @@ void bx_svga_cirrus_c::pci_write_handler(Bit8u address, Bit32u value, unsigned i
                              cirrus_mem_write_handler,
                              &BX_CIRRUS_THIS pci_mmioaddr,
                              &BX_CIRRUS_THIS pci_conf[0x14],
-                             CIRRUS_PNPMMIO_SIZE)) {
+                             CIRRUS_PNPMMIO_SIZE,
+                             "vga video")) {
       BX_INFO(("new pci_mmioaddr = 0x%08x", BX_CIRRUS_THIS pci_mmioaddr));
     }
   }
@@ -437,7 +437,7 @@ void bx_usb_ohci_c::after_restore_state(void)
   if (DEV_pci_set_base_mem(BX_OHCI_THIS_PTR, read_handler, write_handler,
                          &BX_OHCI_THIS hub.base_addr,
                          &BX_OHCI_THIS hub.pci_conf[0x10],
-                         4096))  {
+                         4096, "USB OHCI"))  {
      BX_INFO(("new base address: 0x%04x", BX_OHCI_THIS hub.base_addr));
   }
   for (int j=0; j<BX_N_USB_OHCI_PORTS; j++) {
@@ -1407,7 +1407,7 @@ void bx_usb_ohci_c::pci_write_handler(Bit8u address, Bit32u value, unsigned io_l
     if (DEV_pci_set_base_mem(BX_OHCI_THIS_PTR, read_handler, write_handler,
                              &BX_OHCI_THIS hub.base_addr,
                              &BX_OHCI_THIS hub.pci_conf[0x10],
-                             4096)) {
+                             4096, "USB OHCI")) {
       BX_INFO(("new base address: 0x%04x", BX_OHCI_THIS hub.base_addr));
     }
   }
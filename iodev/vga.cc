@@ -235,7 +235,7 @@ void bx_vga_c::init(void)
   BX_VGA_THIS init_systemtimer(timer_handler, vga_param_handler);
 #endif
   DEV_register_memory_handlers(theVga, mem_read_handler, mem_write_handler,
-                               0xa0000, 0xbffff);
+                               0xa0000, 0xbffff, "vga video");
 
   // video card with BIOS ROM
   DEV_cmos_set_reg(0x14, (DEV_cmos_get_reg(0x14) & 0xcf) | 0x00);
@@ -296,7 +296,8 @@ void bx_vga_c::init(void)
       BX_VGA_THIS vbe.base_address = VBE_DISPI_LFB_PHYSICAL_ADDRESS;
       DEV_register_memory_handlers(theVga, mem_read_handler, mem_write_handler,
                                    BX_VGA_THIS vbe.base_address,
-                                   BX_VGA_THIS vbe.base_address + VBE_DISPI_TOTAL_VIDEO_MEMORY_BYTES - 1);
+                                   BX_VGA_THIS vbe.base_address + VBE_DISPI_TOTAL_VIDEO_MEMORY_BYTES - 1,
+                                   "vga video");
 
     }
     if (BX_VGA_THIS s.memory == NULL)
@@ -369,6 +370,12 @@ void bx_vga_c::init_iohandlers(bx_read_handler_t f_read, bx_write_handler_t f_wr
     DEV_register_ioread_handler(this, f_read, addr, "vga video", 1);
     DEV_register_iowrite_handler(this, f_write, addr, "vga video", 3);
   }
+
+  // palette block transfers (extensions may handle the DAC differently)
+  if ((f_read == read_handler) && (f_write == write_handler)) {
+    DEV_register_iobulk_read_handler(this, pel_bulk_read_handler, 0x03C9, 1);
+    DEV_register_iobulk_write_handler(this, pel_bulk_write_handler, 0x03C9, 1);
+  }
 }
 
 void bx_vga_c::init_systemtimer(bx_timer_handler_t f_timer, param_event_handler f_param)
@@ -1268,44 +1275,7 @@ void bx_vga_c::write(Bit32u address, Bit32u value, unsigned io_len, bx_bool no_l
       break;
 
     case 0x03c9: /* PEL Data Register, colors 00..FF */
-      switch (BX_VGA_THIS s.pel.write_data_cycle) {
-        case 0:
-          BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].red = value;
-          break;
-        case 1:
-          BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].green = value;
-          break;
-        case 2:
-          BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].blue = value;
-
-#if BX_SUPPORT_VBE
-          if (BX_VGA_THIS vbe.dac_8bit) {
-            needs_update |= bx_gui->palette_change(BX_VGA_THIS s.pel.write_data_register,
-              BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].red,
-              BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].green,
-              BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].blue);
-          } else {
-#endif
-            needs_update |= bx_gui->palette_change(BX_VGA_THIS s.pel.write_data_register,
-              BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].red<<2,
-              BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].green<<2,
-              BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].blue<<2);
-#if BX_SUPPORT_VBE
-          }
-#endif
-          break;
-      }
-
-      BX_VGA_THIS s.pel.write_data_cycle++;
-      if (BX_VGA_THIS s.pel.write_data_cycle >= 3) {
-        //BX_INFO(("BX_VGA_THIS s.pel.data[%u] {r=%u, g=%u, b=%u}",
-        //  (unsigned) BX_VGA_THIS s.pel.write_data_register,
-        //  (unsigned) BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].red,
-        //  (unsigned) BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].green,
-        //  (unsigned) BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].blue);
-        BX_VGA_THIS s.pel.write_data_cycle = 0;
-        BX_VGA_THIS s.pel.write_data_register++;
-      }
+      needs_update |= BX_VGA_THIS write_pel_data(value);
       break;
 
     case 0x03ca: /* Graphics 2 Position (EGA) */
@@ -1515,6 +1485,83 @@ void bx_vga_c::write(Bit32u address, Bit32u value, unsigned io_len, bx_bool no_l
   }
 }
 
+bx_bool bx_vga_c::write_pel_data(Bit8u value)
+{
+  bx_bool needs_update = 0;
+
+  switch (BX_VGA_THIS s.pel.write_data_cycle) {
+    case 0:
+      BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].red = value;
+      break;
+    case 1:
+      BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].green = value;
+      break;
+    case 2:
+      BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].blue = value;
+
+#if BX_SUPPORT_VBE
+      if (BX_VGA_THIS vbe.dac_8bit) {
+        needs_update = bx_gui->palette_change(BX_VGA_THIS s.pel.write_data_register,
+          BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].red,
+          BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].green,
+          BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].blue);
+      } else {
+#endif
+        needs_update = bx_gui->palette_change(BX_VGA_THIS s.pel.write_data_register,
+          BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].red<<2,
+          BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].green<<2,
+          BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].blue<<2);
+#if BX_SUPPORT_VBE
+      }
+#endif
+      break;
+  }
+
+  BX_VGA_THIS s.pel.write_data_cycle++;
+  if (BX_VGA_THIS s.pel.write_data_cycle >= 3) {
+    //BX_INFO(("BX_VGA_THIS s.pel.data[%u] {r=%u, g=%u, b=%u}",
+    //  (unsigned) BX_VGA_THIS s.pel.write_data_register,
+    //  (unsigned) BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].red,
+    //  (unsigned) BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].green,
+    //  (unsigned) BX_VGA_THIS s.pel.data[BX_VGA_THIS s.pel.write_data_register].blue);
+    BX_VGA_THIS s.pel.write_data_cycle = 0;
+    BX_VGA_THIS s.pel.write_data_register++;
+  }
+
+  return needs_update;
+}
+
+// static IO port bulk callback handlers for REP INSB/OUTSB on the PEL
+// data register, the screen is redrawn only once for the whole block
+Bit32u bx_vga_c::pel_bulk_read_handler(void *this_ptr, Bit32u address, Bit8u *data, unsigned io_len, Bit32u count)
+{
+  for (Bit32u n = 0; n < count; n++)
+    data[n] = (Bit8u) read_handler(this_ptr, address, io_len);
+
+  return count;
+}
+
+Bit32u bx_vga_c::pel_bulk_write_handler(void *this_ptr, Bit32u address, const Bit8u *data, unsigned io_len, Bit32u count)
+{
+#if BX_USE_VGA_SMF == 0
+  bx_vga_c *class_ptr = (bx_vga_c *) this_ptr;
+#else
+  UNUSED(this_ptr);
+  bx_vga_c *class_ptr = theVga;
+#endif
+  bx_bool needs_update = 0;
+
+  for (Bit32u n = 0; n < count; n++)
+    needs_update |= class_ptr->write_pel_data(data[n]);
+
+  if (needs_update) {
+    // Mark all video as updated so the changes will go through
+    class_ptr->redraw_area(0, 0, old_iWidth, old_iHeight);
+  }
+
+  return count;
+}
+
 Bit64s bx_vga_c::vga_param_handler(bx_param_c *param, int set, Bit64s val)
 {
   // handler for runtime parameter 'vga_update_interval'
@@ -2943,7 +2990,8 @@ bx_bool bx_vga_c::vbe_set_base_addr(Bit32u *addr, Bit8u *pci_conf)
 {
   if (DEV_pci_set_base_mem(BX_VGA_THIS_PTR, mem_read_handler,
                            mem_write_handler,
-                           addr, pci_conf, VBE_DISPI_TOTAL_VIDEO_MEMORY_BYTES)) {
+                           addr, pci_conf, VBE_DISPI_TOTAL_VIDEO_MEMORY_BYTES,
+                           "vga video")) {
     BX_VGA_THIS vbe.base_address = *addr;
     return 1;
   }
@@ -170,6 +170,8 @@ protected:
 #if BX_USE_VGA_SMF
   static void   write_handler_no_log(void *this_ptr, Bit32u address, Bit32u value, unsigned io_len);
 #endif
+  static Bit32u pel_bulk_read_handler(void *this_ptr, Bit32u address, Bit8u *data, unsigned io_len, Bit32u count);
+  static Bit32u pel_bulk_write_handler(void *this_ptr, Bit32u address, const Bit8u *data, unsigned io_len, Bit32u count);
 
 #if BX_SUPPORT_VBE
   static Bit32u vbe_read_handler(void *this_ptr, Bit32u address, unsigned io_len);
@@ -180,6 +182,7 @@ protected:
   Bit32u read(Bit32u address, unsigned io_len);
 #endif
   void  write(Bit32u address, Bit32u value, unsigned io_len, bx_bool no_log);
+  bx_bool write_pel_data(Bit8u value);
 
 #if BX_SUPPORT_VBE
 
@@ -100,7 +100,7 @@
 #define TIME_HEADSTART (0)
 
 
-#define GET_VIRT_REALTIME64_USEC() (((bx_get_realtime64_usec()*(Bit64u)TIME_MULTIPLIER/(Bit64u)TIME_DIVIDER)))
+#define GET_VIRT_REALTIME64_USEC() (((bx_replay.host_time(bx_get_realtime64_usec())*(Bit64u)TIME_MULTIPLIER/(Bit64u)TIME_DIVIDER)))
 //Set up Logging.
 #define LOG_THIS bx_virt_timer.
 
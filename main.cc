@@ -491,6 +491,13 @@ void print_usage(void)
     "  -q               quick start (skip configuration interface)\n"
     "  -benchmark n     run bochs in benchmark mode for millions of emulated ticks\n"
     "  -r path          restore the Bochs state from path\n"
+    "  -incremental     save only the changes since the last saved or restored state\n"
+    "  -binary          save the Bochs state in binary format\n"
+    "  -live            save the Bochs state while the simulation keeps running\n"
+    "  -record file     record the external inputs of the simulation to file\n"
+    "  -replay file     replay the external inputs recorded to file\n"
+    "  -profile file    sample the guest code and write a pprof profile to file\n"
+    "  -profile_period n sample the guest code every n ticks\n"
     "  -log filename    specify Bochs log file name\n"
 #if BX_DEBUGGER
     "  -rc filename     execute debugger commands stored in file\n"
@@ -577,6 +584,31 @@ int bx_init_main(int argc, char *argv[])
         SIM->get_param_string(BXPN_RESTORE_PATH)->set(argv[arg]);
       }
     }
+    else if (!strcmp("-incremental", argv[arg])) {
+      SIM->get_param_bool(BXPN_SAVE_INCREMENTAL)->set(1);
+    }
+    else if (!strcmp("-binary", argv[arg])) {
+      SIM->get_param_bool(BXPN_SAVE_BINARY)->set(1);
+    }
+    else if (!strcmp("-live", argv[arg])) {
+      SIM->get_param_bool(BXPN_SAVE_LIVE)->set(1);
+    }
+    else if (!strcmp("-record", argv[arg])) {
+      if (++arg >= argc) BX_PANIC(("-record must be followed by a filename"));
+      else SIM->get_param_string(BXPN_RECORD_PATH)->set(argv[arg]);
+    }
+    else if (!strcmp("-replay", argv[arg])) {
+      if (++arg >= argc) BX_PANIC(("-replay must be followed by a filename"));
+      else SIM->get_param_string(BXPN_REPLAY_PATH)->set(argv[arg]);
+    }
+    else if (!strcmp("-profile", argv[arg])) {
+      if (++arg >= argc) BX_PANIC(("-profile must be followed by a filename"));
+      else SIM->get_param_string(BXPN_PROFILE_PATH)->set(argv[arg]);
+    }
+    else if (!strcmp("-profile_period", argv[arg])) {
+      if (++arg >= argc) BX_PANIC(("-profile_period must be followed by a number"));
+      else SIM->get_param_num(BXPN_PROFILE_PERIOD)->set(atoi(argv[arg]));
+    }
 #if BX_WITH_CARBON
     else if (!strncmp("-psn", argv[arg], 4)) {
       // "-psn" is passed if we are launched by double-clicking
@@ -1082,6 +1114,12 @@ void bx_init_hardware()
         (Bit64u) benchmark_mode * 1000000, 0, 1, "benchmark.timer");
   }
 
+  // record or replay the external inputs from now on, a restored
+  // machine starts after the restore
+  bx_replay.init();
+  // the sampling profiler, the timer is set up again after a restore
+  bx_profile.init();
+
   // set up memory and CPU objects
   bx_param_num_c *bxp_memsize = SIM->get_param_num(BXPN_MEM_SIZE);
   Bit64u memSize = bxp_memsize->get64() * BX_CONST64(1024*1024);
@@ -1152,6 +1190,8 @@ void bx_init_hardware()
   if (SIM->get_param_bool(BXPN_RESTORE_FLAG)->get()) {
     if (SIM->restore_hardware()) {
       bx_sr_after_restore_state();
+      bx_replay.start();
+      bx_profile.start();
     } else {
       BX_PANIC(("cannot restore hardware state"));
       SIM->get_param_bool(BXPN_RESTORE_FLAG)->set(0);
@@ -1203,6 +1243,8 @@ int bx_atexit(void)
 
   BX_MEM(0)->cleanup_memory();
 
+  bx_replay.exit();
+  bx_profile.exit();
   bx_pc_system.exit();
 
   // restore signal handling to defaults
@@ -71,12 +71,13 @@ void BX_MEM_C::writePhysicalPage(BX_CPU_C *cpu, bx_phy_address addr, unsigned le
     }
   }
 
-  memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
+  memory_handler = BX_MEM_THIS get_memory_handler(a20addr);
   while (memory_handler) {
     if (memory_handler->begin <= a20addr &&
           memory_handler->end >= a20addr &&
           memory_handler->write_handler(a20addr, len, data, memory_handler->param))
     {
+      memory_handler->count[BX_WRITE]++;
       return;
     }
     memory_handler = memory_handler->next;
@@ -91,19 +92,19 @@ mem_write:
     if (a20addr < 0x000a0000 || a20addr >= 0x00100000)
     {
       if (len == 8) {
-        WriteHostQWordToLittleEndian(BX_MEM_THIS get_vector(a20addr), *(Bit64u*)data);
+        WriteHostQWordToLittleEndian(BX_MEM_THIS get_vector_write(a20addr), *(Bit64u*)data);
         return;
       }
       if (len == 4) {
-        WriteHostDWordToLittleEndian(BX_MEM_THIS get_vector(a20addr), *(Bit32u*)data);
+        WriteHostDWordToLittleEndian(BX_MEM_THIS get_vector_write(a20addr), *(Bit32u*)data);
         return;
       }
       if (len == 2) {
-        WriteHostWordToLittleEndian(BX_MEM_THIS get_vector(a20addr), *(Bit16u*)data);
+        WriteHostWordToLittleEndian(BX_MEM_THIS get_vector_write(a20addr), *(Bit16u*)data);
         return;
       }
       if (len == 1) {
-        * (BX_MEM_THIS get_vector(a20addr)) = * (Bit8u *) data;
+        * (BX_MEM_THIS get_vector_write(a20addr)) = * (Bit8u *) data;
         return;
       }
       // len == other, just fall thru to special cases handling
@@ -119,7 +120,7 @@ mem_write:
     {
       // addr *not* in range 000A0000 .. 000FFFFF
       while(1) {
-        *(BX_MEM_THIS get_vector(a20addr)) = *data_ptr;
+        *(BX_MEM_THIS get_vector_write(a20addr)) = *data_ptr;
         if (len == 1) return;
         len--;
         a20addr++;
@@ -139,7 +140,7 @@ mem_write:
       if (a20addr < 0x000c0000) {
         // devices are not allowed to access SMMRAM under VGA memory
         if (cpu) {
-          *(BX_MEM_THIS get_vector(a20addr)) = *data_ptr;
+          *(BX_MEM_THIS get_vector_write(a20addr)) = *data_ptr;
         }
         goto inc_one;
       }
@@ -155,7 +156,7 @@ mem_write:
         switch (DEV_pci_wr_memtype(a20addr)) {
           case 0x1:   // Writes to ShadowRAM
             BX_DEBUG(("Writing to ShadowRAM: address 0x" FMT_PHY_ADDRX ", data %02x", a20addr, *data_ptr));
-            *(BX_MEM_THIS get_vector(a20addr)) = *data_ptr;
+            *(BX_MEM_THIS get_vector_write(a20addr)) = *data_ptr;
             break;
 
           case 0x0:   // Writes to ROM, Inhibit
@@ -215,12 +216,13 @@ void BX_MEM_C::readPhysicalPage(BX_CPU_C *cpu, bx_phy_address addr, unsigned len
     }
   }
 
-  memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
+  memory_handler = BX_MEM_THIS get_memory_handler(a20addr);
   while (memory_handler) {
     if (memory_handler->begin <= a20addr &&
           memory_handler->end >= a20addr &&
           memory_handler->read_handler(a20addr, len, data, memory_handler->param))
     {
+      memory_handler->count[BX_READ]++;
       return;
     }
     memory_handler = memory_handler->next;
@@ -53,6 +53,7 @@ struct memory_handler_struct {
   bx_phy_address end;
   memory_handler_t read_handler;
   memory_handler_t write_handler;
+  Bit64u *count;   // read and write counters of the device (stats)
 };
 
 #define SMRAM_CODE  1
@@ -61,6 +62,9 @@ struct memory_handler_struct {
 class BOCHSAPI BX_MEM_C : public logfunctions {
 private:
   struct memory_handler_struct **memory_handlers;
+  // per 4K page pointer to the first handler covering the page,
+  // the 256 entries of each megabyte are allocated on demand
+  struct memory_handler_struct ***memory_handler_map;
   bx_bool pci_enabled;
   bx_bool smram_available;
   bx_bool smram_enable;
@@ -68,17 +72,39 @@ private:
 
   Bit64u  len, allocated;  // could be > 4G
   Bit8u   *actual_vector;
+  Bit64u   actual_vector_len;  // length of mapping for mmap'ed vector
+  unsigned alloc_type;         // BX_MEM_ALLOC_xxx used for the vector
+  bx_bool  image_mapped;       // vector is a private mapping of a RAM image file
   Bit8u   *vector;   // aligned correctly
   Bit8u  **blocks;
   Bit8u   *rom;      // 512k BIOS rom space + 128k expansion rom space
   Bit8u   *bogus;    // 4k for unexisting memory
   unsigned used_blocks;
+  // checkpoint generation of the last write to each 4K page of the vector,
+  // pages stamped with the current generation changed since the last save
+  Bit32u  *page_stamp;
+  Bit32u   save_stamp;
+  char    *save_parent;  // RAM image of the last saved or restored checkpoint
+  // live snapshot: the RAM image is written by a background thread in
+  // passes while the guest runs, each pass after the first one only
+  // writes the pages stamped since the previous pass started
+  char    *live_path;        // RAM image being written, NULL if none
+  char    *live_tmp_path;    // file written by the passes, renamed to live_path
+  char    *live_checkpoint;  // checkpoint saved when the passes converge
+  int      live_fd;
+  int      live_timer;
+  unsigned live_pass;
+  Bit32u   live_stamp;       // pages stamped with this or a newer generation are written
+  Bit64u   live_pages;       // pages written by the last pass
+  bx_bool  live_ok;
 
 public:
   BX_MEM_C();
  ~BX_MEM_C();
 
   BX_MEM_SMF Bit8u*  get_vector(bx_phy_address addr);
+  BX_MEM_SMF Bit8u*  get_vector_write(bx_phy_address addr);
+  BX_MEM_SMF void    set_page_dirty(Bit8u *ptr);
   BX_MEM_SMF void    init_memory(Bit64u guest, Bit64u host);
   BX_MEM_SMF void    cleanup_memory(void);
   BX_MEM_SMF void    enable_smram(bx_bool enable, bx_bool restricted);
@@ -99,12 +125,29 @@ public:
 #endif
   BX_MEM_SMF Bit8u* getHostMemAddr(BX_CPU_C *cpu, bx_phy_address addr, unsigned rw);
   BX_MEM_SMF bx_bool registerMemoryHandlers(void *param, memory_handler_t read_handler,
-		  memory_handler_t write_handler, bx_phy_address begin_addr, bx_phy_address end_addr);
+		  memory_handler_t write_handler, bx_phy_address begin_addr, bx_phy_address end_addr,
+		  const char *name);
   BX_MEM_SMF bx_bool unregisterMemoryHandlers(memory_handler_t read_handler, memory_handler_t write_handler,
 		  bx_phy_address begin_addr, bx_phy_address end_addr);
+  BX_MEM_SMF struct memory_handler_struct *get_memory_handler(bx_phy_address a20addr);
+  BX_MEM_SMF void    update_memory_handler_map(unsigned idx);
   BX_MEM_SMF Bit64u  get_memory_len(void);
   BX_MEM_SMF void allocate_block(Bit32u index);
   BX_MEM_SMF Bit8u* alloc_vector_aligned(Bit32u bytes, Bit32u alignment);
+  BX_MEM_SMF Bit8u* alloc_vector_mapped(Bit32u bytes);
+  BX_MEM_SMF Bit8u* alloc_vector_shared(size_t size);
+  BX_MEM_SMF bx_bool map_ram_image(const char *path);
+  BX_MEM_SMF int     save_ram_image(const char *path);
+  BX_MEM_SMF void    set_save_parent(const char *path);
+  BX_MEM_SMF int     start_live_save(const char *path, const char *checkpoint_path);
+  BX_MEM_SMF void    live_save_pass(void);
+  BX_MEM_SMF void    cancel_live_save(void);
+  static void live_save_timer_handler(void *this_ptr);
+  BX_MEM_SMF int     restore_ram_image(const char *path);
+  BX_MEM_SMF bx_bool read_ram_image_parent(int fd, char *parent);
+  BX_MEM_SMF bx_bool ram_image_chain_has(const char *path);
+  BX_MEM_SMF void    zero_ram(Bit8u *ptr, Bit64u len);
+  BX_MEM_SMF void   free_vector(void);
 
 #if BX_SUPPORT_MONITOR_MWAIT
   BX_MEM_SMF bx_bool is_monitor(bx_phy_address begin_addr, unsigned len);
@@ -136,6 +179,27 @@ BX_CPP_INLINE Bit8u* BX_MEM_C::get_vector(bx_phy_address addr)
   return BX_MEM_THIS blocks[block] + (Bit32u)(addr & (BX_MEM_BLOCK_LEN-1));
 }
 
+BX_CPP_INLINE void BX_MEM_C::set_page_dirty(Bit8u *ptr)
+{
+  BX_MEM_THIS page_stamp[(Bit32u)((ptr - BX_MEM_THIS vector) >> 12)] = BX_MEM_THIS save_stamp;
+}
+
+// host pointer for a write to guest RAM, the page is recorded as changed
+// for the next incremental checkpoint
+BX_CPP_INLINE Bit8u* BX_MEM_C::get_vector_write(bx_phy_address addr)
+{
+  Bit8u *ptr = get_vector(addr);
+  set_page_dirty(ptr);
+  return ptr;
+}
+
+BX_CPP_INLINE struct memory_handler_struct* BX_MEM_C::get_memory_handler(bx_phy_address a20addr)
+{
+  struct memory_handler_struct **map = BX_MEM_THIS memory_handler_map[a20addr >> 20];
+  if (! map) return NULL;
+  return map[(Bit32u)(a20addr >> 12) & 0xff];
+}
+
 BX_CPP_INLINE Bit64u BX_MEM_C::get_memory_len(void)
 {
   return (BX_MEM_THIS len);
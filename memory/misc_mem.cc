@@ -26,28 +26,84 @@
 #include "param_names.h"
 #include "cpu/cpu.h"
 #include "iodev/iodev.h"
+
+#if BX_HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#endif
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#if BX_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#if BX_HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 #define LOG_THIS BX_MEM(0)->
 
 // alignment of memory vector, must be a power of 2
 #define BX_MEM_VECTOR_ALIGN 4096
+// host huge page size used to align mmap'ed memory vector
+#define BX_MEM_HUGE_PAGE_LEN (2*1024*1024)
 #define BX_MEM_HANDLERS   ((BX_CONST64(1) << BX_PHY_ADDRESS_WIDTH) >> 20) /* one per megabyte */
 
+// a live snapshot pauses the guest for its final pass as soon as a pass
+// leaves no more than BX_MEM_LIVE_MAX_DIRTY pages, or after the maximum
+// number of passes if the guest writes faster than the image is written
+#define BX_MEM_LIVE_MAX_DIRTY  256
+#define BX_MEM_LIVE_MAX_PASSES 8
+#define BX_MEM_LIVE_POLL_USEC  1000
+
+#if BX_HAVE_PTHREAD && BX_HAVE_SYS_MMAN_H
+#define BX_MEM_LIVE_SAVE 1
+#else
+#define BX_MEM_LIVE_SAVE 0
+#endif
+
 BX_MEM_C::BX_MEM_C()
 {
   put("MEM0");
 
   vector = NULL;
   actual_vector = NULL;
+  actual_vector_len = 0;
+  alloc_type = BX_MEM_ALLOC_HEAP;
+  image_mapped = 0;
   blocks = NULL;
   len    = 0;
   used_blocks = 0;
+  page_stamp = NULL;
+  save_stamp = 1;
+  save_parent = NULL;
+  live_path = NULL;
+  live_tmp_path = NULL;
+  live_checkpoint = NULL;
+  live_fd = -1;
+  live_timer = BX_NULL_TIMER_HANDLE;
+  live_pass = 0;
+  live_stamp = 0;
+  live_pages = 0;
+  live_ok = 0;
 
   memory_handlers = NULL;
+  memory_handler_map = NULL;
 }
 
 Bit8u* BX_MEM_C::alloc_vector_aligned(Bit32u bytes, Bit32u alignment)
 {
   Bit64u test_mask = alignment - 1;
+  if (BX_MEM_THIS alloc_type != BX_MEM_ALLOC_HEAP) {
+    Bit8u *vector = alloc_vector_mapped(bytes);
+    if (vector != NULL) {
+      BX_ASSERT((((bx_ptr_equiv_t) vector) & test_mask) == 0);
+      return vector;
+    }
+    BX_MEM_THIS alloc_type = BX_MEM_ALLOC_HEAP;
+  }
   BX_MEM_THIS actual_vector = new Bit8u [(Bit32u)(bytes + test_mask)];
   if (BX_MEM_THIS actual_vector == 0) {
     BX_PANIC(("alloc_vector_aligned: unable to allocate host RAM !"));
@@ -64,6 +120,892 @@ Bit8u* BX_MEM_C::alloc_vector_aligned(Bit32u bytes, Bit32u alignment)
   return vector;
 }
 
+//
+// Allocate the memory vector with anonymous mmap. Pages are only backed
+// by host memory once touched, the mapping is 2M aligned and advised for
+// transparent huge pages (or taken from hugetlbfs for BX_MEM_ALLOC_HUGETLB),
+// excluded from core dumps and optionally bound to a host NUMA node.
+// Returns NULL if the host cannot provide such a mapping.
+//
+Bit8u* BX_MEM_C::alloc_vector_mapped(Bit32u bytes)
+{
+#if BX_HAVE_SYS_MMAN_H
+  size_t size = ((size_t) bytes + BX_MEM_HUGE_PAGE_LEN - 1) & ~((size_t) BX_MEM_HUGE_PAGE_LEN - 1);
+  Bit8u *ptr = (Bit8u *) MAP_FAILED;
+
+  if (BX_MEM_THIS alloc_type == BX_MEM_ALLOC_SHARED) {
+    ptr = alloc_vector_shared(size);
+    if (ptr == NULL) return NULL;
+    BX_MEM_THIS actual_vector = ptr;
+    BX_MEM_THIS actual_vector_len = size;
+    return ptr;
+  }
+
+#ifdef MAP_HUGETLB
+  if (BX_MEM_THIS alloc_type == BX_MEM_ALLOC_HUGETLB) {
+    ptr = (Bit8u *) mmap(NULL, size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr == (Bit8u *) MAP_FAILED) {
+      BX_ERROR(("hugetlb allocation of %u bytes failed, using transparent huge pages", (unsigned) size));
+      BX_MEM_THIS alloc_type = BX_MEM_ALLOC_MMAP;
+    }
+  }
+#else
+  if (BX_MEM_THIS alloc_type == BX_MEM_ALLOC_HUGETLB) {
+    BX_ERROR(("hugetlb allocation not supported by host, using mmap"));
+    BX_MEM_THIS alloc_type = BX_MEM_ALLOC_MMAP;
+  }
+#endif
+
+  if (ptr == (Bit8u *) MAP_FAILED) {
+    // huge pages can only back 2M aligned ranges, so map one huge page
+    // more than needed and trim the unaligned head and tail
+    size_t map_len = size + BX_MEM_HUGE_PAGE_LEN;
+    Bit8u *map = (Bit8u *) mmap(NULL, map_len, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (map == (Bit8u *) MAP_FAILED) {
+      BX_ERROR(("mmap allocation of %u bytes failed, using heap", (unsigned) size));
+      return NULL;
+    }
+    ptr = (Bit8u *)(((bx_ptr_equiv_t) map + BX_MEM_HUGE_PAGE_LEN - 1) &
+                     ~((bx_ptr_equiv_t) BX_MEM_HUGE_PAGE_LEN - 1));
+    if (ptr > map)
+      munmap(map, ptr - map);
+    if (ptr + size < map + map_len)
+      munmap(ptr + size, (map + map_len) - (ptr + size));
+#ifdef MADV_HUGEPAGE
+    madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+  }
+
+#ifdef MADV_DONTDUMP
+  madvise(ptr, size, MADV_DONTDUMP);
+#endif
+
+  int node = SIM->get_param_num(BXPN_MEM_NUMA_NODE)->get();
+  if (node > BX_MEM_MAX_NUMA_NODE) {
+    BX_ERROR(("host NUMA node %d out of range", node));
+  }
+  else if (node >= 0) {
+#if defined(__linux__) && defined(SYS_mbind)
+    const unsigned node_bits = 8 * sizeof(unsigned long);
+    unsigned long nodemask[(BX_MEM_MAX_NUMA_NODE + node_bits) / node_bits];
+    memset(nodemask, 0, sizeof(nodemask));
+    nodemask[node / node_bits] = 1UL << (node % node_bits);
+    // MPOL_BIND == 2, maxnode counts one past the last valid node bit
+    if (syscall(SYS_mbind, ptr, size, 2, nodemask, 8 * sizeof(nodemask) + 1, 0) != 0)
+      BX_ERROR(("failed to bind guest RAM to host NUMA node %d", node));
+    else
+      BX_INFO(("guest RAM bound to host NUMA node %d", node));
+#else
+    BX_ERROR(("NUMA binding not supported by host"));
+#endif
+  }
+
+  BX_MEM_THIS actual_vector = ptr;
+  BX_MEM_THIS actual_vector_len = size;
+  return ptr;
+#else
+  BX_ERROR(("mmap allocation not supported by host, using heap"));
+  return NULL;
+#endif
+}
+
+//
+// Place the memory vector in a shared memory file, either the file named
+// by the "file" memory option or an anonymous memfd. Other processes can
+// map the running guest RAM from there.
+//
+Bit8u* BX_MEM_C::alloc_vector_shared(size_t size)
+{
+#if BX_HAVE_SYS_MMAN_H
+  const char *path = SIM->get_param_string(BXPN_MEM_FILE)->getptr();
+  int fd = -1;
+
+  if (strlen(path) > 0) {
+    fd = open(path, O_RDWR | O_CREAT, 0600);
+    if (fd < 0) {
+      BX_ERROR(("cannot open shared memory file '%s'", path));
+      return NULL;
+    }
+    // start from zeroed RAM as with the other allocators
+    if (ftruncate(fd, 0) != 0 || ftruncate(fd, size) != 0) {
+      BX_ERROR(("cannot resize shared memory file '%s'", path));
+      close(fd);
+      return NULL;
+    }
+  }
+#if defined(__linux__) && defined(SYS_memfd_create)
+  else {
+    fd = syscall(SYS_memfd_create, "bochs-ram", 0);
+    if (fd >= 0 && ftruncate(fd, size) != 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+#endif
+
+  Bit8u *ptr;
+  if (fd >= 0) {
+    ptr = (Bit8u *) mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+  }
+  else {
+    ptr = (Bit8u *) mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  }
+  if (ptr == (Bit8u *) MAP_FAILED) {
+    BX_ERROR(("shared memory allocation of %u bytes failed, using heap", (unsigned) size));
+    return NULL;
+  }
+  return ptr;
+#else
+  return NULL;
+#endif
+}
+
+//
+// Restore guest RAM by mapping the RAM image of a checkpoint private
+// over the memory vector. Pages are read on demand and copied on write,
+// so any number of machines restored from the same checkpoint share the
+// unmodified pages through the host page cache. Only possible if the
+// vector itself is a private mmap'ed region, returns 0 to read the image
+// instead. A shared vector is always read: a private mapping would end
+// the sharing with the other processes.
+//
+bx_bool BX_MEM_C::map_ram_image(const char *path)
+{
+#if BX_HAVE_SYS_MMAN_H
+  if (BX_MEM_THIS alloc_type == BX_MEM_ALLOC_SHARED) {
+    BX_INFO(("reading guest RAM image '%s' into the shared memory", path));
+    return 0;
+  }
+  if (BX_MEM_THIS alloc_type != BX_MEM_ALLOC_MMAP)
+    return 0;
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return 0;
+
+  struct stat stat_buf;
+  if (fstat(fd, &stat_buf) != 0 || (Bit64u) stat_buf.st_size < BX_MEM_THIS allocated) {
+    close(fd);
+    return 0;
+  }
+
+  void *ptr = mmap(BX_MEM_THIS vector, (size_t) BX_MEM_THIS allocated,
+                   PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+  close(fd);
+  if (ptr == MAP_FAILED) {
+    // the old mapping may already be gone at this point
+    BX_PANIC(("failed to map guest RAM image '%s'", path));
+    return 0;
+  }
+  BX_MEM_THIS image_mapped = 1;
+  BX_INFO(("guest RAM mapped copy-on-write from '%s'", path));
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+//
+// Guest RAM image in save_format=compact: a header and a table with one
+// file offset per 4K page follow each other, offset 0 marks a zero page
+// and identical pages share a single page record. A page record is the
+// Bit32u length of the data followed by the data, which is the zlib
+// compressed page unless the length equals the page size.
+//
+// An incremental image has the DELTA flag and the Bit32u length and the
+// path of the parent RAM image between the header and the table. Pages
+// not written since the parent checkpoint have the offset 1 and are
+// taken from the parent image.
+//
+#define BX_RAM_IMAGE_MAGIC  "BXRAMPG1"
+#define BX_RAM_IMAGE_ZLIB   0x1
+#define BX_RAM_IMAGE_DELTA  0x2
+
+#define BX_RAM_PAGE_ZERO    0
+#define BX_RAM_PAGE_PARENT  1
+
+typedef struct {
+  char   magic[8];
+  Bit32u page_size;
+  Bit32u flags;
+  Bit64u num_pages;
+} bx_ram_image_header_t;
+
+static bx_bool is_zero_page(const Bit8u *page)
+{
+  const Bit64u *ptr = (const Bit64u *) page;
+  for (unsigned i = 0; i < 4096 / 8; i++) {
+    if (ptr[i] != 0) return 0;
+  }
+  return 1;
+}
+
+static Bit64u hash_page(const Bit8u *page)
+{
+  // FNV-1a over 64-bit words
+  const Bit64u *ptr = (const Bit64u *) page;
+  Bit64u hash = BX_CONST64(0xcbf29ce484222325);
+  for (unsigned i = 0; i < 4096 / 8; i++) {
+    hash ^= ptr[i];
+    hash *= BX_CONST64(0x100000001b3);
+  }
+  return hash;
+}
+
+#if BX_HAVE_SYS_MMAN_H
+static bx_bool write_all(int fd, const void *buf, size_t len, off_t offset)
+{
+  const Bit8u *ptr = (const Bit8u *) buf;
+  while (len > 0) {
+    ssize_t ret = pwrite(fd, ptr, len, offset);
+    if (ret <= 0) return 0;
+    ptr += ret;
+    offset += ret;
+    len -= ret;
+  }
+  return 1;
+}
+
+static bx_bool read_all(int fd, void *buf, size_t len, off_t offset)
+{
+  Bit8u *ptr = (Bit8u *) buf;
+  while (len > 0) {
+    ssize_t ret = pread(fd, ptr, len, offset);
+    if (ret <= 0) return 0;
+    ptr += ret;
+    offset += ret;
+    len -= ret;
+  }
+  return 1;
+}
+#endif
+
+#if BX_MEM_LIVE_SAVE
+static pthread_t live_thread;
+static pthread_mutex_t live_mutex = PTHREAD_MUTEX_INITIALIZER;
+static bx_bool live_running = 0;  // touched by the simulation thread only
+static bx_bool live_done = 0;     // set by the background thread
+
+static void *live_save_thread(void *arg)
+{
+  BX_MEM(0)->live_save_pass();
+  pthread_mutex_lock(&live_mutex);
+  live_done = 1;
+  pthread_mutex_unlock(&live_mutex);
+  return NULL;
+}
+
+static bx_bool start_live_thread(void)
+{
+  live_done = 0;
+  live_running = (pthread_create(&live_thread, NULL, live_save_thread, NULL) == 0);
+  return live_running;
+}
+#endif
+
+//
+// Save guest RAM skipping zero pages. The raw format leaves them as holes
+// in a sparse file, so the image can still be mapped by map_ram_image().
+// The compact format also stores duplicate pages once and compresses
+// the page data if zlib is available. Incremental checkpoints always use
+// the compact format and only store the pages written since the parent.
+//
+int BX_MEM_C::save_ram_image(const char *path)
+{
+#if BX_HAVE_SYS_MMAN_H
+  Bit64u num_pages = BX_MEM_THIS allocated >> 12;
+  Bit64u zero_pages = 0, dup_pages = 0, parent_pages = 0;
+  Bit32u stamp = BX_MEM_THIS save_stamp;
+  bx_bool ok = 1;
+
+#if BX_MEM_LIVE_SAVE
+  if (BX_MEM_THIS live_path != NULL) {
+    if (! strcmp(BX_MEM_THIS live_path, path) && !live_running) {
+      // final pass of a live snapshot, the guest is paused now
+      BX_MEM_THIS live_stamp = stamp;
+      BX_MEM_THIS live_pass++;
+      live_save_pass();
+      if (close(BX_MEM_THIS live_fd) != 0 ||
+          rename(BX_MEM_THIS live_tmp_path, path) != 0)
+        BX_MEM_THIS live_ok = 0;
+      BX_MEM_THIS live_fd = -1;
+      if (! BX_MEM_THIS live_ok)
+        unlink(BX_MEM_THIS live_tmp_path);
+      free(BX_MEM_THIS live_path);
+      free(BX_MEM_THIS live_tmp_path);
+      free(BX_MEM_THIS live_checkpoint);
+      BX_MEM_THIS live_path = NULL;
+      BX_MEM_THIS live_tmp_path = NULL;
+      BX_MEM_THIS live_checkpoint = NULL;
+      if (! BX_MEM_THIS live_ok) {
+        BX_ERROR(("failed to write guest RAM image '%s'", path));
+        return BX_SR_DATA_FAILED;
+      }
+      BX_INFO(("live snapshot saved after %u passes, " FMT_LL "u RAM pages written while paused",
+               BX_MEM_THIS live_pass, BX_MEM_THIS live_pages));
+      set_save_parent(path);
+      return BX_SR_DATA_DONE;
+    }
+    BX_INFO(("live snapshot to '%s' cancelled", BX_MEM_THIS live_checkpoint));
+    cancel_live_save();
+  }
+#endif
+
+  bx_bool delta = SIM->get_param_bool(BXPN_SAVE_INCREMENTAL)->get() &&
+                  BX_MEM_THIS save_parent != NULL &&
+                  !ram_image_chain_has(path);
+
+  // a mapped image keeps its pages if the file is replaced, not truncated
+  if (BX_MEM_THIS image_mapped)
+    unlink(path);
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    BX_ERROR(("cannot create guest RAM image '%s'", path));
+    return BX_SR_DATA_FAILED;
+  }
+
+  if (! delta && SIM->get_param_enum(BXPN_MEM_SAVE_FORMAT)->get() == BX_MEM_SAVE_RAW) {
+    Bit64u page = 0;
+    while (ok && page < num_pages) {
+      if (is_zero_page(BX_MEM_THIS vector + (page << 12))) {
+        zero_pages++;
+        page++;
+        continue;
+      }
+      // write run of non-zero pages at once
+      Bit64u start = page;
+      while (page < num_pages && !is_zero_page(BX_MEM_THIS vector + (page << 12)))
+        page++;
+      ok = write_all(fd, BX_MEM_THIS vector + (start << 12), (size_t)((page - start) << 12), (off_t)(start << 12));
+    }
+    if (ok && ftruncate(fd, (off_t) BX_MEM_THIS allocated) != 0) ok = 0;
+  }
+  else {
+    bx_ram_image_header_t header;
+    memcpy(header.magic, BX_RAM_IMAGE_MAGIC, 8);
+    header.page_size = 4096;
+    header.flags = 0;
+#if BX_HAVE_ZLIB
+    header.flags |= BX_RAM_IMAGE_ZLIB;
+    Bit8u zbuf[4096 + 4];
+#endif
+    header.num_pages = num_pages;
+    Bit32u parent_len = 0;
+    if (delta) {
+      header.flags |= BX_RAM_IMAGE_DELTA;
+      parent_len = strlen(BX_MEM_THIS save_parent);
+    }
+    off_t table_offset = sizeof(header);
+    if (delta)
+      table_offset += sizeof(parent_len) + parent_len;
+
+    Bit64u *table = new Bit64u[(size_t) num_pages];
+    // open addressing hash of non-zero pages already written
+    Bit32u hash_size = 1;
+    while (hash_size < 2 * num_pages) hash_size <<= 1;
+    Bit32u *hash_idx = new Bit32u[hash_size];
+    Bit64u *hash_val = new Bit64u[hash_size];
+    memset(hash_idx, 0xff, hash_size * sizeof(Bit32u));
+
+    off_t offset = table_offset + (off_t) num_pages * sizeof(Bit64u);
+    for (Bit32u page = 0; ok && page < num_pages; page++) {
+      Bit8u *ptr = BX_MEM_THIS vector + ((Bit64u) page << 12);
+      if (delta && BX_MEM_THIS page_stamp[page] != stamp) {
+        table[page] = BX_RAM_PAGE_PARENT;
+        parent_pages++;
+        continue;
+      }
+      if (is_zero_page(ptr)) {
+        table[page] = BX_RAM_PAGE_ZERO;
+        zero_pages++;
+        continue;
+      }
+      Bit64u hash = hash_page(ptr);
+      Bit32u slot = (Bit32u) hash & (hash_size - 1);
+      while (hash_idx[slot] != 0xffffffff) {
+        Bit32u prev = hash_idx[slot];
+        if (hash_val[slot] == hash && !memcmp(BX_MEM_THIS vector + ((Bit64u) prev << 12), ptr, 4096))
+          break;
+        slot = (slot + 1) & (hash_size - 1);
+      }
+      if (hash_idx[slot] != 0xffffffff) {
+        table[page] = table[hash_idx[slot]];
+        dup_pages++;
+        continue;
+      }
+      hash_idx[slot] = page;
+      hash_val[slot] = hash;
+
+      Bit32u len = 4096;
+      const Bit8u *data = ptr;
+#if BX_HAVE_ZLIB
+      uLongf zlen = sizeof(zbuf);
+      if (compress2(zbuf, &zlen, ptr, 4096, Z_BEST_SPEED) == Z_OK && zlen < 4096) {
+        len = (Bit32u) zlen;
+        data = zbuf;
+      }
+#endif
+      table[page] = offset;
+      ok = write_all(fd, &len, sizeof(len), offset) &&
+           write_all(fd, data, len, offset + sizeof(len));
+      offset += sizeof(len) + len;
+    }
+    if (ok) {
+      ok = write_all(fd, &header, sizeof(header), 0) &&
+           write_all(fd, table, (size_t) num_pages * sizeof(Bit64u), table_offset);
+    }
+    if (ok && delta) {
+      ok = write_all(fd, &parent_len, sizeof(parent_len), sizeof(header)) &&
+           write_all(fd, BX_MEM_THIS save_parent, parent_len, sizeof(header) + sizeof(parent_len));
+    }
+    delete [] hash_val;
+    delete [] hash_idx;
+    delete [] table;
+  }
+
+  close(fd);
+  if (! ok) {
+    BX_ERROR(("failed to write guest RAM image '%s'", path));
+    return BX_SR_DATA_FAILED;
+  }
+  BX_INFO(("saved " FMT_LL "u RAM pages (" FMT_LL "u zero, " FMT_LL "u duplicate, " FMT_LL "u unchanged)",
+           num_pages, zero_pages, dup_pages, parent_pages));
+  set_save_parent(path);
+  return BX_SR_DATA_DONE;
+#else
+  return BX_SR_DATA_DEFAULT;
+#endif
+}
+
+//
+// Zero a page aligned part of the memory vector. Anonymous private pages
+// are dropped so they read back as zero and need no host memory, other
+// pages are only written if they are not zero yet. Pages of a mapped RAM
+// image would read back from the image file if dropped.
+//
+void BX_MEM_C::zero_ram(Bit8u *ptr, Bit64u len)
+{
+#if BX_HAVE_SYS_MMAN_H && defined(MADV_DONTNEED)
+  if (BX_MEM_THIS alloc_type == BX_MEM_ALLOC_MMAP && !BX_MEM_THIS image_mapped) {
+    madvise(ptr, (size_t) len, MADV_DONTNEED);
+    return;
+  }
+#endif
+  for (Bit64u off = 0; off < len; off += 4096) {
+    if (! is_zero_page(ptr + off))
+      memset(ptr + off, 0, 4096);
+  }
+}
+
+// Read the parent of a delta RAM image, the header has been checked
+bx_bool BX_MEM_C::read_ram_image_parent(int fd, char *parent)
+{
+#if BX_HAVE_SYS_MMAN_H
+  Bit32u parent_len;
+
+  if (! read_all(fd, &parent_len, sizeof(parent_len), sizeof(bx_ram_image_header_t)) ||
+      parent_len >= BX_PATHNAME_LEN ||
+      ! read_all(fd, parent, parent_len, sizeof(bx_ram_image_header_t) + sizeof(parent_len)))
+    return 0;
+  parent[parent_len] = 0;
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+//
+// A delta image may not replace its own parent image or one further up
+// the chain: the images based on it would change and the chain of parents
+// could become a loop.
+//
+bx_bool BX_MEM_C::ram_image_chain_has(const char *path)
+{
+#if BX_HAVE_SYS_MMAN_H
+  char parent[BX_PATHNAME_LEN];
+  bx_ram_image_header_t header;
+
+  if (BX_MEM_THIS save_parent == NULL)
+    return 0;
+  strcpy(parent, BX_MEM_THIS save_parent);
+  for (unsigned depth = 0; depth < BX_SR_MAX_CHAIN; depth++) {
+    if (! strcmp(parent, path))
+      return 1;
+    int fd = open(parent, O_RDONLY);
+    if (fd < 0)
+      return 0;
+    bx_bool ok = read_all(fd, &header, sizeof(header), 0) &&
+                 !memcmp(header.magic, BX_RAM_IMAGE_MAGIC, 8) &&
+                 (header.flags & BX_RAM_IMAGE_DELTA) &&
+                 read_ram_image_parent(fd, parent);
+    close(fd);
+    if (! ok)
+      return 0;
+  }
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+int BX_MEM_C::restore_ram_image(const char *path)
+{
+#if BX_HAVE_SYS_MMAN_H
+  bx_ram_image_header_t header;
+  bx_bool ok = 1;
+
+  cancel_live_save();
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return BX_SR_DATA_DEFAULT;
+
+  if (! read_all(fd, &header, sizeof(header), 0) ||
+       memcmp(header.magic, BX_RAM_IMAGE_MAGIC, 8) != 0)
+  {
+    // raw image: map it if possible, otherwise read only the data
+    // extents of the sparse file and leave the holes zero
+    close(fd);
+    if (map_ram_image(path)) {
+      set_save_parent(path);
+      return BX_SR_DATA_DONE;
+    }
+#if defined(SEEK_DATA) && defined(SEEK_HOLE)
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+      return BX_SR_DATA_DEFAULT;
+    off_t size = (off_t) BX_MEM_THIS allocated;
+    off_t pos = 0;
+    while (ok && pos < size) {
+      off_t data = lseek(fd, pos, SEEK_DATA);
+      if (data < 0 || data > size) data = size;
+      data &= ~((off_t) 0xfff);
+      if (data > pos)
+        zero_ram(BX_MEM_THIS vector + pos, data - pos);
+      if (data >= size) break;
+      off_t hole = lseek(fd, data, SEEK_HOLE);
+      if (hole < 0 || hole > size) hole = size;
+      hole = (hole + 0xfff) & ~((off_t) 0xfff);
+      if (hole > size) hole = size;
+      ok = read_all(fd, BX_MEM_THIS vector + data, (size_t)(hole - data), data);
+      pos = hole;
+    }
+    close(fd);
+    if (! ok) {
+      BX_PANIC(("failed to read guest RAM image '%s'", path));
+      return BX_SR_DATA_FAILED;
+    }
+    set_save_parent(path);
+    return BX_SR_DATA_DONE;
+#else
+    return BX_SR_DATA_DEFAULT;
+#endif
+  }
+
+  if (header.page_size != 4096 || header.num_pages != (BX_MEM_THIS allocated >> 12)) {
+    close(fd);
+    BX_PANIC(("guest RAM image '%s' does not match memory size", path));
+    return BX_SR_DATA_FAILED;
+  }
+#if !BX_HAVE_ZLIB
+  if (header.flags & BX_RAM_IMAGE_ZLIB) {
+    close(fd);
+    BX_PANIC(("guest RAM image '%s' is compressed, but zlib is not available", path));
+    return BX_SR_DATA_FAILED;
+  }
+#endif
+
+  off_t table_offset = sizeof(header);
+  if (header.flags & BX_RAM_IMAGE_DELTA) {
+    // restore the chain of parent images first
+    char parent[BX_PATHNAME_LEN];
+    ok = read_ram_image_parent(fd, parent);
+    static unsigned depth = 0;
+    if (ok && depth < BX_SR_MAX_CHAIN) {
+      BX_INFO(("restoring parent RAM image '%s'", parent));
+      depth++;
+      ok = (restore_ram_image(parent) == BX_SR_DATA_DONE);
+      depth--;
+    } else {
+      ok = 0;
+    }
+    if (! ok) {
+      close(fd);
+      BX_PANIC(("cannot restore the parent of guest RAM image '%s'", path));
+      return BX_SR_DATA_FAILED;
+    }
+    table_offset += sizeof(Bit32u) + strlen(parent);
+  }
+
+  Bit64u num_pages = header.num_pages;
+  Bit64u *table = new Bit64u[(size_t) num_pages];
+  Bit8u buf[4096];
+  ok = read_all(fd, table, (size_t) num_pages * sizeof(Bit64u), table_offset);
+  for (Bit64u page = 0; ok && page < num_pages; page++) {
+    Bit8u *ptr = BX_MEM_THIS vector + (page << 12);
+    if (table[page] == BX_RAM_PAGE_PARENT)
+      continue;
+    if (table[page] == BX_RAM_PAGE_ZERO) {
+      // merge the run of zero pages
+      Bit64u start = page;
+      while (page + 1 < num_pages && table[page + 1] == BX_RAM_PAGE_ZERO) page++;
+      zero_ram(BX_MEM_THIS vector + (start << 12), (page - start + 1) << 12);
+      continue;
+    }
+    Bit32u len;
+    ok = read_all(fd, &len, sizeof(len), (off_t) table[page]);
+    if (! ok || len > 4096) {
+      ok = 0;
+      break;
+    }
+    if (len == 4096) {
+      ok = read_all(fd, ptr, 4096, (off_t) table[page] + sizeof(len));
+    }
+    else {
+#if BX_HAVE_ZLIB
+      uLongf plen = 4096;
+      ok = read_all(fd, buf, len, (off_t) table[page] + sizeof(len)) &&
+           uncompress(ptr, &plen, buf, len) == Z_OK && plen == 4096;
+#else
+      ok = 0;
+#endif
+    }
+  }
+  delete [] table;
+  close(fd);
+  if (! ok) {
+    BX_PANIC(("failed to read guest RAM image '%s'", path));
+    return BX_SR_DATA_FAILED;
+  }
+  set_save_parent(path);
+  return BX_SR_DATA_DONE;
+#else
+  return BX_SR_DATA_DEFAULT;
+#endif
+}
+
+//
+// Make the image at path the parent of the next incremental checkpoint.
+// All pages are clean from now on, the CPUs drop their TLB write
+// pointers so the next write to each page goes through getHostMemAddr()
+// and marks it.
+//
+void BX_MEM_C::set_save_parent(const char *path)
+{
+  if (BX_MEM_THIS save_parent != NULL)
+    free(BX_MEM_THIS save_parent);
+  BX_MEM_THIS save_parent = strdup(path);
+  BX_MEM_THIS save_stamp++;
+
+  for (int i=0; i<BX_SMP_PROCESSORS; i++)
+    BX_CPU(i)->TLB_flush();
+}
+
+//
+// Start a live snapshot of the machine to checkpoint_path. The guest keeps
+// running while a background thread writes the raw RAM image to path. The
+// first pass writes all non-zero pages, every following pass the pages
+// written by the guest while the previous one was running. When few pages
+// are left the checkpoint is saved as usual, which writes the remaining
+// pages and the device state with the guest paused. The passes write to
+// a temporary file which replaces path only then, an image at path stays
+// intact until the snapshot completes, also if guest RAM maps it. Returns
+// 1 if the snapshot started, -1 if it is refused and 0 if live snapshots
+// are not supported, the caller should save the state directly then.
+//
+int BX_MEM_C::start_live_save(const char *path, const char *checkpoint_path)
+{
+#if BX_MEM_LIVE_SAVE
+  char tmp_path[BX_PATHNAME_LEN];
+
+  cancel_live_save();
+
+  // the last saved or restored image may be replaced, one further up its
+  // chain not: the images based on it would change
+  if (BX_MEM_THIS save_parent != NULL && strcmp(BX_MEM_THIS save_parent, path) &&
+      ram_image_chain_has(path)) {
+    BX_ERROR(("'%s' is a parent of the guest RAM image '%s'", path, BX_MEM_THIS save_parent));
+    return -1;
+  }
+
+  if (strlen(path) + 5 >= BX_PATHNAME_LEN) {
+    BX_ERROR(("guest RAM image path '%s' too long", path));
+    return 0;
+  }
+  sprintf(tmp_path, "%s.tmp", path);
+  int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    BX_ERROR(("cannot create guest RAM image '%s'", tmp_path));
+    return 0;
+  }
+  if (ftruncate(fd, (off_t) BX_MEM_THIS allocated) != 0) {
+    close(fd);
+    unlink(tmp_path);
+    return 0;
+  }
+  BX_MEM_THIS live_fd = fd;
+  BX_MEM_THIS live_path = strdup(path);
+  BX_MEM_THIS live_tmp_path = strdup(tmp_path);
+  BX_MEM_THIS live_checkpoint = strdup(checkpoint_path);
+  BX_MEM_THIS live_pass = 0;
+  BX_MEM_THIS live_pages = 0;
+  BX_MEM_THIS live_ok = 1;
+
+  // the passes reuse the page stamps of the incremental checkpoints, the
+  // next checkpoint cannot be a delta to the previous parent any more
+  if (BX_MEM_THIS save_parent != NULL) {
+    free(BX_MEM_THIS save_parent);
+    BX_MEM_THIS save_parent = NULL;
+  }
+  BX_MEM_THIS save_stamp++;
+  for (int i=0; i<BX_SMP_PROCESSORS; i++)
+    BX_CPU(i)->TLB_flush();
+
+  if (! start_live_thread()) {
+    cancel_live_save();
+    return 0;
+  }
+  bx_pc_system.activate_timer(BX_MEM_THIS live_timer, BX_MEM_LIVE_POLL_USEC, 1);
+  BX_INFO(("live snapshot to '%s' started", checkpoint_path));
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+//
+// Write one pass of a live snapshot: all non-zero pages in the first pass,
+// then the pages stamped with live_stamp or a newer generation. Runs in
+// the background thread, a page changing while it is written is stamped
+// again and written by the next pass.
+//
+void BX_MEM_C::live_save_pass(void)
+{
+#if BX_MEM_LIVE_SAVE
+  Bit64u num_pages = BX_MEM_THIS allocated >> 12;
+  Bit32u stamp = BX_MEM_THIS live_stamp;
+  bx_bool all = (BX_MEM_THIS live_pass == 0);
+  Bit64u page = 0, count = 0;
+
+  while (BX_MEM_THIS live_ok && page < num_pages) {
+    if (all ? is_zero_page(BX_MEM_THIS vector + (page << 12)) :
+              (BX_MEM_THIS page_stamp[page] < stamp)) {
+      page++;
+      continue;
+    }
+    // write run of pages at once
+    Bit64u start = page;
+    do {
+      page++;
+    } while (page < num_pages && (all ? !is_zero_page(BX_MEM_THIS vector + (page << 12)) :
+                                        (BX_MEM_THIS page_stamp[page] >= stamp)));
+    BX_MEM_THIS live_ok = write_all(BX_MEM_THIS live_fd, BX_MEM_THIS vector + (start << 12),
+                                    (size_t)((page - start) << 12), (off_t)(start << 12));
+    count += page - start;
+  }
+  BX_MEM_THIS live_pages = count;
+#endif
+}
+
+void BX_MEM_C::live_save_timer_handler(void *this_ptr)
+{
+#if BX_MEM_LIVE_SAVE
+  if (BX_MEM_THIS live_path == NULL) {
+    bx_pc_system.deactivate_timer(BX_MEM_THIS live_timer);
+    return;
+  }
+  pthread_mutex_lock(&live_mutex);
+  bx_bool done = live_done;
+  pthread_mutex_unlock(&live_mutex);
+  if (! done)
+    return;
+  pthread_join(live_thread, NULL);
+  live_running = 0;
+  if (! BX_MEM_THIS live_ok) {
+    BX_ERROR(("failed to write guest RAM image '%s'", BX_MEM_THIS live_path));
+    cancel_live_save();
+    return;
+  }
+
+  Bit64u num_pages = BX_MEM_THIS allocated >> 12, dirty = 0;
+  for (Bit64u page = 0; page < num_pages; page++) {
+    if (BX_MEM_THIS page_stamp[page] == BX_MEM_THIS save_stamp) dirty++;
+  }
+  BX_DEBUG(("live snapshot pass %u wrote " FMT_LL "u pages, " FMT_LL "u pages changed meanwhile",
+            BX_MEM_THIS live_pass, BX_MEM_THIS live_pages, dirty));
+
+  if (dirty > BX_MEM_LIVE_MAX_DIRTY && BX_MEM_THIS live_pass + 1 < BX_MEM_LIVE_MAX_PASSES) {
+    // next pass writes the pages changed during this one
+    BX_MEM_THIS live_stamp = BX_MEM_THIS save_stamp;
+    BX_MEM_THIS save_stamp++;
+    BX_MEM_THIS live_pass++;
+    for (int i=0; i<BX_SMP_PROCESSORS; i++)
+      BX_CPU(i)->TLB_flush();
+    if (! start_live_thread()) {
+      BX_ERROR(("cannot start live snapshot pass"));
+      cancel_live_save();
+    }
+    return;
+  }
+
+  bx_pc_system.deactivate_timer(BX_MEM_THIS live_timer);
+  char checkpoint[BX_PATHNAME_LEN];
+  strcpy(checkpoint, BX_MEM_THIS live_checkpoint);
+  SIM->save_state(checkpoint);
+  if (BX_MEM_THIS live_path != NULL) {
+    BX_ERROR(("failed to save live snapshot '%s'", checkpoint));
+    cancel_live_save();
+  }
+#endif
+}
+
+void BX_MEM_C::cancel_live_save(void)
+{
+#if BX_MEM_LIVE_SAVE
+  if (live_running) {
+    pthread_join(live_thread, NULL);
+    live_running = 0;
+  }
+  if (BX_MEM_THIS live_path == NULL)
+    return;
+  close(BX_MEM_THIS live_fd);
+  BX_MEM_THIS live_fd = -1;
+  unlink(BX_MEM_THIS live_tmp_path);
+  free(BX_MEM_THIS live_path);
+  free(BX_MEM_THIS live_tmp_path);
+  free(BX_MEM_THIS live_checkpoint);
+  BX_MEM_THIS live_path = NULL;
+  BX_MEM_THIS live_tmp_path = NULL;
+  BX_MEM_THIS live_checkpoint = NULL;
+  bx_pc_system.deactivate_timer(BX_MEM_THIS live_timer);
+#endif
+}
+
+static int memory_ram_save_handler(void *devptr, bx_shadow_data_c *param, const char *path)
+{
+  return BX_MEM(0)->save_ram_image(path);
+}
+
+static int memory_ram_restore_handler(void *devptr, bx_shadow_data_c *param, const char *path)
+{
+  return BX_MEM(0)->restore_ram_image(path);
+}
+
+void BX_MEM_C::free_vector(void)
+{
+#if BX_HAVE_SYS_MMAN_H
+  if (BX_MEM_THIS alloc_type != BX_MEM_ALLOC_HEAP)
+    munmap(BX_MEM_THIS actual_vector, BX_MEM_THIS actual_vector_len);
+  else
+#endif
+    delete [] BX_MEM_THIS actual_vector;
+  BX_MEM_THIS actual_vector = NULL;
+  BX_MEM_THIS actual_vector_len = 0;
+}
+
 BX_MEM_C::~BX_MEM_C()
 {
   cleanup_memory();
@@ -81,17 +1023,23 @@ void BX_MEM_C::init_memory(Bit64u guest, Bit64u host)
 
   if (BX_MEM_THIS actual_vector != NULL) {
     BX_INFO(("freeing existing memory vector"));
-    delete [] BX_MEM_THIS actual_vector;
-    BX_MEM_THIS actual_vector = NULL;
+    free_vector();
     BX_MEM_THIS vector = NULL;
     BX_MEM_THIS blocks = NULL;
   }
+  BX_MEM_THIS alloc_type = SIM->get_param_enum(BXPN_MEM_ALLOC)->get();
+  BX_MEM_THIS image_mapped = 0;
   BX_MEM_THIS vector = alloc_vector_aligned(host + BIOSROMSZ + EXROMSIZE + 4096, BX_MEM_VECTOR_ALIGN);
-  BX_INFO(("allocated memory at %p. after alignment, vector=%p",
-	BX_MEM_THIS actual_vector, BX_MEM_THIS vector));
+  BX_INFO(("allocated memory at %p. after alignment, vector=%p (%s)",
+	BX_MEM_THIS actual_vector, BX_MEM_THIS vector,
+	SIM->get_param_enum(BXPN_MEM_ALLOC)->get_choice(BX_MEM_THIS alloc_type)));
 
   BX_MEM_THIS len = guest;
   BX_MEM_THIS allocated = host;
+  if (BX_MEM_THIS page_stamp != NULL)
+    delete [] BX_MEM_THIS page_stamp;
+  BX_MEM_THIS page_stamp = new Bit32u[(size_t)(host >> 12)];
+  memset(BX_MEM_THIS page_stamp, 0, (size_t)(host >> 12) * sizeof(Bit32u));
   BX_MEM_THIS rom = &BX_MEM_THIS vector[host];
   BX_MEM_THIS bogus = &BX_MEM_THIS vector[host + BIOSROMSZ + EXROMSIZE];
   memset(BX_MEM_THIS rom, 0xff, BIOSROMSZ + EXROMSIZE + 4096);
@@ -119,8 +1067,16 @@ void BX_MEM_C::init_memory(Bit64u guest, Bit64u host)
   }
 
   BX_MEM_THIS memory_handlers = new struct memory_handler_struct *[BX_MEM_HANDLERS];
-  for (idx = 0; idx < BX_MEM_HANDLERS; idx++)
+  BX_MEM_THIS memory_handler_map = new struct memory_handler_struct **[BX_MEM_HANDLERS];
+  for (idx = 0; idx < BX_MEM_HANDLERS; idx++) {
     BX_MEM_THIS memory_handlers[idx] = NULL;
+    BX_MEM_THIS memory_handler_map[idx] = NULL;
+  }
+
+  if (BX_MEM_THIS live_timer == BX_NULL_TIMER_HANDLE) {
+    BX_MEM_THIS live_timer = bx_pc_system.register_timer(BX_MEM(0), live_save_timer_handler,
+                               BX_MEM_LIVE_POLL_USEC, 1, 0, "mem.live");
+  }
 
   BX_MEM_THIS pci_enabled = SIM->get_param_bool(BXPN_I440FX_SUPPORT)->get();
   BX_MEM_THIS smram_available = 0;
@@ -176,7 +1132,8 @@ void memory_param_restore_handler(void *devptr, bx_param_c *param, Bit64s val)
 void BX_MEM_C::register_state()
 {
   bx_list_c *list = new bx_list_c(SIM->get_bochs_root(), "memory", "Memory State", 6);
-  new bx_shadow_data_c(list, "ram", BX_MEM_THIS vector, BX_MEM_THIS allocated);
+  bx_shadow_data_c *ram = new bx_shadow_data_c(list, "ram", BX_MEM_THIS vector, BX_MEM_THIS allocated);
+  ram->set_sr_handlers(this, memory_ram_save_handler, memory_ram_restore_handler);
   BXRS_DEC_PARAM_FIELD(list, len, BX_MEM_THIS len);
   BXRS_DEC_PARAM_FIELD(list, allocated, BX_MEM_THIS allocated);
   BXRS_DEC_PARAM_FIELD(list, used_blocks, BX_MEM_THIS used_blocks);
@@ -197,14 +1154,20 @@ void BX_MEM_C::cleanup_memory()
   unsigned idx;
 
   if (BX_MEM_THIS vector != NULL) {
-    delete [] BX_MEM_THIS actual_vector;
-    BX_MEM_THIS actual_vector = NULL;
+    cancel_live_save();
+    free_vector();
     BX_MEM_THIS vector = NULL;
     BX_MEM_THIS rom = NULL;
     BX_MEM_THIS bogus = NULL;
     delete [] BX_MEM_THIS blocks;
     BX_MEM_THIS blocks = 0;
     BX_MEM_THIS used_blocks = 0;
+    delete [] BX_MEM_THIS page_stamp;
+    BX_MEM_THIS page_stamp = NULL;
+    if (BX_MEM_THIS save_parent != NULL) {
+      free(BX_MEM_THIS save_parent);
+      BX_MEM_THIS save_parent = NULL;
+    }
     if (BX_MEM_THIS memory_handlers != NULL) {
       for (idx = 0; idx < BX_MEM_HANDLERS; idx++) {
         struct memory_handler_struct *memory_handler = BX_MEM_THIS memory_handlers[idx];
@@ -214,9 +1177,13 @@ void BX_MEM_C::cleanup_memory()
           memory_handler = memory_handler->next;
           delete prev;
         }
+        if (BX_MEM_THIS memory_handler_map[idx] != NULL)
+          delete [] BX_MEM_THIS memory_handler_map[idx];
       }
       delete [] BX_MEM_THIS memory_handlers;
       BX_MEM_THIS memory_handlers = NULL;
+      delete [] BX_MEM_THIS memory_handler_map;
+      BX_MEM_THIS memory_handler_map = NULL;
     }
   }
 }
@@ -491,7 +1458,7 @@ bx_bool BX_MEM_C::dbg_set_mem(bx_phy_address addr, unsigned len, Bit8u *buf)
     // Write to standard PCI/ISA Video Mem / SMMRAM
     if (addr >= 0x000a0000 && addr < 0x000c0000) {
       if (BX_MEM_THIS smram_enable)
-        *(BX_MEM_THIS get_vector(addr)) = *buf;
+        *(BX_MEM_THIS get_vector_write(addr)) = *buf;
       else
         DEV_vga_mem_write(addr, *buf);
     }
@@ -502,7 +1469,7 @@ bx_bool BX_MEM_C::dbg_set_mem(bx_phy_address addr, unsigned len, Bit8u *buf)
         case 0x0:  // Ignore write to ROM
           break;
         case 0x1:  // Write to ShadowRAM
-          *(BX_MEM_THIS get_vector(addr)) = *buf;
+          *(BX_MEM_THIS get_vector_write(addr)) = *buf;
           break;
         default:
           BX_PANIC(("dbg_fetch_mem: default case"));
@@ -511,7 +1478,7 @@ bx_bool BX_MEM_C::dbg_set_mem(bx_phy_address addr, unsigned len, Bit8u *buf)
 #endif  // #if BX_SUPPORT_PCI
     else if ((addr < 0x000c0000 || addr >= 0x00100000) && (addr < (bx_phy_address)(~BIOS_MASK)))
     {
-      *(BX_MEM_THIS get_vector(addr)) = *buf;
+      *(BX_MEM_THIS get_vector_write(addr)) = *buf;
     }
     buf++;
     addr++;
@@ -593,13 +1560,8 @@ Bit8u *BX_MEM_C::getHostMemAddr(BX_CPU_C *cpu, bx_phy_address addr, unsigned rw)
   }
 #endif
 
-  struct memory_handler_struct *memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
-  while (memory_handler) {
-    if (memory_handler->begin <= a20addr &&
-        memory_handler->end >= a20addr) {
-      return(NULL); // Vetoed! memory handler for i/o apic, vram, mmio and PCI PnP
-    }
-    memory_handler = memory_handler->next;
+  if (BX_MEM_THIS get_memory_handler(a20addr) != NULL) {
+    return(NULL); // Vetoed! memory handler for i/o apic, vram, mmio and PCI PnP
   }
 
   if (! write) {
@@ -674,7 +1636,7 @@ Bit8u *BX_MEM_C::getHostMemAddr(BX_CPU_C *cpu, bx_phy_address addr, unsigned rw)
     else
     {
       if (a20addr < 0x000c0000 || a20addr >= 0x00100000) {
-        return BX_MEM_THIS get_vector(a20addr);
+        return BX_MEM_THIS get_vector_write(a20addr);
       }
       else {
         return(NULL);  // Vetoed!  ROMs
@@ -689,13 +1651,15 @@ Bit8u *BX_MEM_C::getHostMemAddr(BX_CPU_C *cpu, bx_phy_address addr, unsigned rw)
  */
   bx_bool
 BX_MEM_C::registerMemoryHandlers(void *param, memory_handler_t read_handler,
-		memory_handler_t write_handler, bx_phy_address begin_addr, bx_phy_address end_addr)
+		memory_handler_t write_handler, bx_phy_address begin_addr, bx_phy_address end_addr,
+		const char *name)
 {
   if (end_addr < begin_addr)
     return 0;
   if (!read_handler || !write_handler)
     return 0;
-  BX_INFO(("Register memory access handlers: 0x" FMT_PHY_ADDRX " - 0x" FMT_PHY_ADDRX, begin_addr, end_addr));
+  BX_INFO(("Register memory access handlers: 0x" FMT_PHY_ADDRX " - 0x" FMT_PHY_ADDRX " (%s)", begin_addr, end_addr, name));
+  Bit64u *count = bx_devices.get_device_stats(BXPN_STATS_MMIO, name);
   for (unsigned page_idx = begin_addr >> 20; page_idx <= end_addr >> 20; page_idx++) {
     struct memory_handler_struct *memory_handler = new struct memory_handler_struct;
     memory_handler->next = BX_MEM_THIS memory_handlers[page_idx];
@@ -705,6 +1669,8 @@ BX_MEM_C::registerMemoryHandlers(void *param, memory_handler_t read_handler,
     memory_handler->param = param;
     memory_handler->begin = begin_addr;
     memory_handler->end = end_addr;
+    memory_handler->count = count;
+    update_memory_handler_map(page_idx);
   }
   return 1;
 }
@@ -736,10 +1702,46 @@ BX_MEM_C::unregisterMemoryHandlers(memory_handler_t read_handler, memory_handler
     else
       BX_MEM_THIS memory_handlers[page_idx] = memory_handler->next;
     delete memory_handler;
+    update_memory_handler_map(page_idx);
   }
   return ret;
 }
 
+//
+// Rebuild the 4K page lookup of megabyte idx from its handler list:
+// every page points to the first handler which covers any part of it,
+// so the access path only walks the handlers that may claim the access.
+//
+void BX_MEM_C::update_memory_handler_map(unsigned idx)
+{
+  struct memory_handler_struct **map = BX_MEM_THIS memory_handler_map[idx];
+
+  if (BX_MEM_THIS memory_handlers[idx] == NULL) {
+    if (map != NULL) {
+      delete [] map;
+      BX_MEM_THIS memory_handler_map[idx] = NULL;
+    }
+    return;
+  }
+
+  if (map == NULL) {
+    map = new struct memory_handler_struct *[BX_MEM_BLOCK_LEN >> 12];
+    BX_MEM_THIS memory_handler_map[idx] = map;
+  }
+
+  for (unsigned page = 0; page < (BX_MEM_BLOCK_LEN >> 12); page++) {
+    bx_phy_address page_start = ((bx_phy_address) idx << 20) | (page << 12);
+    bx_phy_address page_end = page_start | 0xfff;
+    struct memory_handler_struct *memory_handler = BX_MEM_THIS memory_handlers[idx];
+    while (memory_handler) {
+      if (memory_handler->begin <= page_end && memory_handler->end >= page_start)
+        break;
+      memory_handler = memory_handler->next;
+    }
+    map[page] = memory_handler;
+  }
+}
+
 void BX_MEM_C::enable_smram(bx_bool enable, bx_bool restricted)
 {
   BX_MEM_THIS smram_available = 1;
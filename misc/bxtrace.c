@@ -0,0 +1,180 @@
+/*
+ * misc/bxtrace.c
+ * $Id$
+ *
+ * Decodes the binary execution trace written by the trace instrumentation
+ * library (instrument/trace), see instrument/trace/trace.h for the format.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "config.h"
+
+#include "../osdep.h"
+#include "../instrument/trace/trace.h"
+
+#define MAX_CPUS 256
+
+/* decoder state per CPU, see trace.h */
+typedef struct {
+  Bit64u next, lin, phy;
+  Bit64u insns, jumps, mems, events;
+} cpu_state_t;
+
+static cpu_state_t cpus[MAX_CPUS];
+static int summary = 0;
+
+static const char *event_names[] = { "exception", "interrupt", "hwinterrupt" };
+/* BX_READ, BX_WRITE, BX_RW */
+static const char *rw_names[] = { "read ", "write", NULL, "rw   " };
+
+static void usage(void)
+{
+  fprintf(stderr,
+    "Usage: bxtrace [-s] tracefile\n\n"
+    "Decodes a Bochs execution trace.\n"
+    "  -s  print the number of records per CPU only\n");
+  exit(1);
+}
+
+static int get_varint(const Bit8u **p, const Bit8u *end, Bit64u *val)
+{
+  Bit64u result = 0;
+  unsigned shift;
+
+  for (shift = 0; shift < 64 && *p < end; shift += 7) {
+    Bit8u c = *(*p)++;
+    result |= (Bit64u)(c & 0x7f) << shift;
+    if (!(c & 0x80)) {
+      *val = result;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int get_delta(const Bit8u **p, const Bit8u *end, Bit64u *val)
+{
+  Bit64u z;
+  if (!get_varint(p, end, &z)) return 0;
+  *val += (z >> 1) ^ (Bit64u)(-(Bit64s)(z & 1));
+  return 1;
+}
+
+/* returns 0 if the block is truncated or has an unknown record */
+static int decode_block(unsigned cpu, const Bit8u *p, const Bit8u *end)
+{
+  cpu_state_t *s = &cpus[cpu];
+  Bit64u val;
+
+  while (p < end) {
+    Bit8u tag = *p++;
+    switch (tag & 0xf0) {
+    case TRACE_INSN:
+    case TRACE_JUMP:
+      if ((tag & 0xf0) == TRACE_JUMP) {
+        if (!get_delta(&p, end, &s->next)) return 0;
+        s->jumps++;
+      }
+      if (!summary)
+        printf("[cpu%u] insn  " FMT_ADDRX64 " len %u\n", cpu, s->next, tag & 0x0f);
+      s->next += tag & 0x0f;
+      s->insns++;
+      break;
+    case TRACE_MEM:
+      if ((tag & 0x0f) > 3 || !rw_names[tag & 0x0f] || p >= end) return 0;
+      {
+        unsigned size = *p++;
+        if (!get_delta(&p, end, &s->lin) || !get_delta(&p, end, &s->phy)) return 0;
+        if (!summary)
+          printf("[cpu%u] %s lin " FMT_ADDRX64 " phy " FMT_ADDRX64 " size %u\n",
+                 cpu, rw_names[tag & 0x0f], s->lin, s->phy, size);
+      }
+      s->mems++;
+      break;
+    default:
+      if (tag == TRACE_CR3) {
+        if (!get_varint(&p, end, &val)) return 0;
+        if (!summary)
+          printf("[cpu%u] cr3   " FMT_ADDRX64 "\n", cpu, val);
+      }
+      else if (tag == TRACE_EVENT) {
+        unsigned type;
+        if (p >= end) return 0;
+        type = *p++;
+        if (type > TRACE_EVENT_HWINTERRUPT || !get_varint(&p, end, &val)) return 0;
+        if (!summary)
+          printf("[cpu%u] %s %u\n", cpu, event_names[type], (unsigned) val);
+        s->events++;
+      }
+      else {
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+int main(int argc, char *argv[])
+{
+  FILE *fp;
+  char magic[TRACE_MAGIC_LEN];
+  Bit8u hdr[TRACE_BLOCK_HEADER], *buf = NULL;
+  Bit32u buf_size = 0;
+  unsigned cpu;
+  int arg = 1;
+
+  if (arg < argc && !strcmp(argv[arg], "-s")) {
+    summary = 1;
+    arg++;
+  }
+  if (arg != argc - 1) usage();
+
+  fp = fopen(argv[arg], "rb");
+  if (fp == NULL) {
+    perror(argv[arg]);
+    return 1;
+  }
+  if (fread(magic, 1, TRACE_MAGIC_LEN, fp) != TRACE_MAGIC_LEN ||
+      memcmp(magic, TRACE_MAGIC, TRACE_MAGIC_LEN))
+  {
+    fprintf(stderr, "%s: not a Bochs execution trace\n", argv[arg]);
+    return 1;
+  }
+
+  while (fread(hdr, 1, TRACE_BLOCK_HEADER, fp) == TRACE_BLOCK_HEADER) {
+    Bit32u len = hdr[1] | (hdr[2] << 8) | (hdr[3] << 16) | ((Bit32u) hdr[4] << 24);
+    cpu = hdr[0];
+    if (len > buf_size) {
+      buf = (Bit8u *) realloc(buf, len);
+      if (buf == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+      }
+      buf_size = len;
+    }
+    if (fread(buf, 1, len, fp) != len) {
+      fprintf(stderr, "%s: truncated block\n", argv[arg]);
+      break;
+    }
+    if (!decode_block(cpu, buf, buf + len)) {
+      fprintf(stderr, "%s: bad record in a block of cpu%u\n", argv[arg], cpu);
+      break;
+    }
+  }
+  fclose(fp);
+  free(buf);
+
+  if (summary) {
+    for (cpu = 0; cpu < MAX_CPUS; cpu++) {
+      cpu_state_t *s = &cpus[cpu];
+      if (s->insns == 0 && s->mems == 0 && s->events == 0) continue;
+      printf("cpu%u: " FMT_LL "u instructions, " FMT_LL "u not sequential, " FMT_LL
+             "u memory accesses, " FMT_LL "u events\n",
+             cpu, s->insns, s->jumps, s->mems, s->events);
+    }
+  }
+  return 0;
+}
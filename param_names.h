@@ -31,6 +31,13 @@
 #define BXPN_BOCHS_BENCHMARK             "general.benchmark"
 #define BXPN_RESTORE_FLAG                "general.restore"
 #define BXPN_RESTORE_PATH                "general.restore_path"
+#define BXPN_SAVE_INCREMENTAL            "general.save_incremental"
+#define BXPN_SAVE_BINARY                 "general.save_binary"
+#define BXPN_SAVE_LIVE                   "general.save_live"
+#define BXPN_RECORD_PATH                 "general.record_path"
+#define BXPN_REPLAY_PATH                 "general.replay_path"
+#define BXPN_PROFILE_PATH                "general.profile_path"
+#define BXPN_PROFILE_PERIOD              "general.profile_period"
 #define BXPN_DEBUG_RUNNING               "general.debug_running"
 #define BXPN_CPU_NPROCESSORS             "cpu.n_processors"
 #define BXPN_CPU_NCORES                  "cpu.n_cores"
@@ -39,6 +46,7 @@
 #define BXPN_SMP_QUANTUM                 "cpu.quantum"
 #define BXPN_RESET_ON_TRIPLE_FAULT       "cpu.reset_on_triple_fault"
 #define BXPN_IGNORE_BAD_MSRS             "cpu.ignore_bad_msrs"
+#define BXPN_IDLE_SKIP                   "cpu.idle_skip"
 #define BXPN_CONFIGURABLE_MSRS_PATH      "cpu.msrs"
 #define BXPN_VENDOR_STRING               "cpuid.vendor_string"
 #define BXPN_BRAND_STRING                "cpuid.brand_string"
@@ -55,6 +63,10 @@
 #define BXPN_CPUID_PCID                  "cpuid.pcid"
 #define BXPN_MEM_SIZE                    "memory.standard.ram.size"
 #define BXPN_HOST_MEM_SIZE               "memory.standard.ram.host_size"
+#define BXPN_MEM_ALLOC                   "memory.standard.ram.alloc"
+#define BXPN_MEM_NUMA_NODE               "memory.standard.ram.numa_node"
+#define BXPN_MEM_FILE                    "memory.standard.ram.file"
+#define BXPN_MEM_SAVE_FORMAT             "memory.standard.ram.save_format"
 #define BXPN_ROM_PATH                    "memory.standard.rom.path"
 #define BXPN_ROM_ADDRESS                 "memory.standard.rom.addr"
 #define BXPN_VGA_ROM_PATH                "memory.standard.vgarom.path"
@@ -161,6 +173,11 @@
 #define BXPN_MENU_RUNTIME_CDROM          "menu.runtime.cdrom"
 #define BXPN_MENU_RUNTIME_USB            "menu.runtime.usb"
 #define BXPN_MENU_RUNTIME_MISC           "menu.runtime.misc"
+#define BXPN_STATS                       "stats"
+#define BXPN_STATS_IO                    "stats.io"
+#define BXPN_STATS_MMIO                  "stats.mmio"
+#define BXPN_STATS_TIMER_FIRES           "stats.timer_fires"
+#define BXPN_STATS_SMC                   "stats.smc_invalidations"
 #define BXPN_WX_KBD_STATE                "wxdebug.keyboard"
 #define BXPN_WX_CPU_STATE                "wxdebug.cpu"
 #define BXPN_WX_CPU0_STATE               "wxdebug.cpu.0"
@@ -75,6 +75,10 @@ void bx_pc_system_c::initialize(Bit32u ips)
   triggeredTimer = 0;
   HRQ = 0;
   kill_bochs_request = 0;
+  timerFires = 0;
+
+  if (SIM->get_param(BXPN_STATS_TIMER_FIRES) == NULL)
+    new bx_shadow_num_c(SIM->get_param(BXPN_STATS), "timer_fires", &timerFires);
 
   // parameter 'ips' is the processor speed in Instructions-Per-Second
   m_ips = double(ips) / 1000000.0L;
@@ -374,6 +378,7 @@ void bx_pc_system_c::countdownEvent(void)
     // Call requested timer function.  It may request a different
     // timer period or deactivate etc.
     if (triggered[i]) {
+      timerFires++;
       triggeredTimer = i;
       timer[i].funct(timer[i].this_ptr);
       triggeredTimer = 0;
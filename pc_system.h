@@ -62,6 +62,7 @@ private:
   Bit64u     ticksTotal; // Num ticks total since start of emulator execution.
   Bit64u     lastTimeUsec; // Last sequentially read time in usec.
   Bit64u     usecSinceLast; // Number of useconds claimed since then.
+  Bit64u     timerFires; // Number of timer callbacks invoked (stats).
 
   // A special null timer is always inserted in the timer[0] slot.  This
   // make sure that at least one timer is always active, and that the
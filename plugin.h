@@ -123,8 +123,8 @@ extern "C" {
 
 #define DEV_register_timer(a,b,c,d,e,f) bx_pc_system.register_timer(a,b,c,d,e,f)
 #define DEV_mouse_enabled_changed(en) (bx_devices.mouse_enabled_changed(en))
-#define DEV_mouse_motion(dx, dy, state) (bx_devices.mouse_motion(dx, dy, 0, state))
-#define DEV_mouse_motion_ext(dx, dy, dz, state) (bx_devices.mouse_motion(dx, dy, dz, state))
+#define DEV_mouse_motion(dx, dy, state) (bx_replay.mouse_motion(dx, dy, 0, state))
+#define DEV_mouse_motion_ext(dx, dy, dz, state) (bx_replay.mouse_motion(dx, dy, dz, state))
 
 ///////// Removable devices macros
 #define DEV_optional_key_enq(a) (bx_devices.optional_key_enq(a))
@@ -148,9 +148,9 @@ extern "C" {
 
 ///////// keyboard macros
 #define DEV_kbd_gen_scancode(key) \
-    (bx_devices.pluginKeyboard->gen_scancode(key))
+    (bx_replay.gen_scancode(key))
 #define DEV_kbd_paste_bytes(bytes, count) \
-    (bx_devices.pluginKeyboard->paste_bytes(bytes,count))
+    (bx_replay.paste_bytes(bytes,count))
 
 ///////// hard drive macros
 #define DEV_hd_read_handler(a, b, c) \
@@ -170,9 +170,11 @@ extern "C" {
 #define DEV_hd_bmdma_write_sector(a,b) bx_devices.pluginHardDrive->bmdma_write_sector(a,b)
 #define DEV_hd_bmdma_complete(a) bx_devices.pluginHardDrive->bmdma_complete(a)
 
-#define DEV_bulk_io_quantum_requested() (bx_devices.bulkIOQuantumsRequested)
-#define DEV_bulk_io_quantum_transferred() (bx_devices.bulkIOQuantumsTransferred)
-#define DEV_bulk_io_host_addr() (bx_devices.bulkIOHostAddr)
+///////// bulk I/O macros
+#define DEV_register_iobulk_read_handler(b,c,d,e) bx_devices.register_io_bulk_read_handler(b,c,d,e)
+#define DEV_register_iobulk_write_handler(b,c,d,e) bx_devices.register_io_bulk_write_handler(b,c,d,e)
+#define DEV_unregister_iobulk_read_handler(b,c) bx_devices.unregister_io_bulk_read_handler(b,c)
+#define DEV_unregister_iobulk_write_handler(b,c) bx_devices.unregister_io_bulk_write_handler(b,c)
 
 ///////// FLOPPY macros
 #define DEV_floppy_get_media_status(drive) bx_devices.pluginFloppyDevice->get_media_status(drive)
@@ -218,8 +220,8 @@ extern "C" {
   (bx_devices.pluginPciBridge->register_pci_handlers(a,b,c,d))
 #define DEV_is_pci_device(name) bx_devices.pluginPciBridge->is_pci_device(name)
 #define DEV_pci_set_irq(a,b,c) bx_devices.pluginPci2IsaBridge->pci_set_irq(a,b,c)
-#define DEV_pci_set_base_mem(a,b,c,d,e,f) \
-  (bx_devices.pluginPciBridge->pci_set_base_mem(a,b,c,d,e,f))
+#define DEV_pci_set_base_mem(a,b,c,d,e,f,g) \
+  (bx_devices.pluginPciBridge->pci_set_base_mem(a,b,c,d,e,f,g))
 #define DEV_pci_set_base_io(a,b,c,d,e,f,g,h) \
   (bx_devices.pluginPciBridge->pci_set_base_io(a,b,c,d,e,f,g,h))
 #define DEV_pci_rd_memtype(addr) bx_devices.pluginPciBridge->rd_memType(addr)
@@ -238,8 +240,8 @@ extern "C" {
 #define DEV_speaker_beep_off() bx_devices.pluginSpeaker->beep_off()
 
 //////// Memory macros
-#define DEV_register_memory_handlers(param,rh,wh,b,e) \
-    bx_devices.mem->registerMemoryHandlers(param,rh,wh,b,e)
+#define DEV_register_memory_handlers(param,rh,wh,b,e,n) \
+    bx_devices.mem->registerMemoryHandlers(param,rh,wh,b,e,n)
 #define DEV_unregister_memory_handlers(rh,wh,b,e) \
     bx_devices.mem->unregisterMemoryHandlers(rh,wh,b,e)
 
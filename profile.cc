@@ -0,0 +1,394 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2010  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+#include "bochs.h"
+#include "param_names.h"
+#include "cpu/cpu.h"
+
+#define LOG_THIS bx_profile.
+
+bx_profile_c bx_profile;
+
+#define BX_PROFILE_INITIAL_SIZE  4096
+#define BX_PROFILE_REPORT_TOP    10
+
+bx_profile_c::bx_profile_c()
+{
+  put("PROF");
+  table = NULL;
+  table_size = used = 0;
+  samples = idle = 0;
+  period = 0;
+  timer_index = BX_NULL_TIMER_HANDLE;
+}
+
+bx_profile_c::~bx_profile_c()
+{
+  if (table != NULL) {
+    delete [] table;
+    table = NULL;
+  }
+}
+
+void bx_profile_c::init(void)
+{
+  if (timer_index == BX_NULL_TIMER_HANDLE) {
+    // registered even without a profile file, start() only activates it;
+    // this way profiling can be switched on for a restored checkpoint
+    timer_index = bx_pc_system.register_timer_ticks(this, timer_handler,
+        BX_PROFILE_DEFAULT_PERIOD, 1, 0, "profile");
+  }
+  if (! SIM->get_param_bool(BXPN_RESTORE_FLAG)->get())
+    start();
+}
+
+// (Re)activate the timer, also after a restore which has the timer state
+// of the checkpoint.
+void bx_profile_c::start(void)
+{
+  if (SIM->get_param_string(BXPN_PROFILE_PATH)->getptr()[0] == 0) {
+    bx_pc_system.deactivate_timer(timer_index);
+    return;
+  }
+  period = SIM->get_param_num(BXPN_PROFILE_PERIOD)->get();
+  if (table == NULL) {
+    table_size = BX_PROFILE_INITIAL_SIZE;
+    table = new sample_t[table_size];
+    memset(table, 0, table_size * sizeof(sample_t));
+  }
+  bx_pc_system.activate_timer_ticks(timer_index, period, 1);
+  BX_INFO(("sampling the guest code every %u ticks", period));
+}
+
+void bx_profile_c::exit(void)
+{
+  if (table == NULL)
+    return;
+  report();
+  write_profile(SIM->get_param_string(BXPN_PROFILE_PATH)->getptr());
+  delete [] table;
+  table = NULL;
+  table_size = used = 0;
+  samples = idle = 0;
+}
+
+void bx_profile_c::timer_handler(void *this_ptr)
+{
+  ((bx_profile_c *) this_ptr)->timer();
+}
+
+// Timers fire between instructions, the instruction pointer of each CPU
+// is the one of the next instruction to execute.
+void bx_profile_c::timer(void)
+{
+  for (unsigned i = 0; i < BX_SMP_PROCESSORS; i++) {
+    BX_CPU_C *cpu = BX_CPU(i);
+    if (cpu->activity_state != BX_ACTIVITY_STATE_ACTIVE) {
+      idle++;
+      continue;
+    }
+    Bit64u ip = cpu->get_segment_base(BX_SEG_REG_CS) + cpu->get_instruction_pointer();
+    if (cpu->get_cpu_mode() != BX_MODE_LONG_64)
+      ip &= 0xffffffff;
+#if BX_CPU_LEVEL >= 3
+    Bit64u cr3 = cpu->cr3;
+#else
+    Bit64u cr3 = 0;
+#endif
+    add(cr3, ip, cpu->sregs[BX_SEG_REG_CS].selector.rpl);
+  }
+}
+
+static BX_CPP_INLINE Bit32u profile_hash(Bit64u cr3, Bit64u ip, Bit8u cpl)
+{
+  Bit64u h = (ip * BX_CONST64(0x9e3779b97f4a7c15)) ^ (cr3 * BX_CONST64(0xc2b2ae3d27d4eb4f)) ^ cpl;
+  return (Bit32u)(h >> 32) ^ (Bit32u) h;
+}
+
+void bx_profile_c::add(Bit64u cr3, Bit64u ip, Bit8u cpl)
+{
+  Bit32u mask = table_size - 1;
+  Bit32u n = profile_hash(cr3, ip, cpl) & mask;
+
+  samples++;
+  for (;; n = (n + 1) & mask) {
+    sample_t *s = &table[n];
+    if (s->count == 0) {
+      s->cr3 = cr3;
+      s->ip = ip;
+      s->cpl = cpl;
+      s->count = 1;
+      // keep the table at most half full
+      if (++used > (table_size >> 1))
+        grow();
+      return;
+    }
+    if (s->ip == ip && s->cr3 == cr3 && s->cpl == cpl) {
+      s->count++;
+      return;
+    }
+  }
+}
+
+void bx_profile_c::grow(void)
+{
+  sample_t *old = table;
+  Bit32u old_size = table_size;
+
+  table_size <<= 1;
+  table = new sample_t[table_size];
+  memset(table, 0, table_size * sizeof(sample_t));
+  Bit32u mask = table_size - 1;
+  for (Bit32u i = 0; i < old_size; i++) {
+    if (old[i].count == 0) continue;
+    Bit32u n = profile_hash(old[i].cr3, old[i].ip, old[i].cpl) & mask;
+    while (table[n].count != 0)
+      n = (n + 1) & mask;
+    table[n] = old[i];
+  }
+  delete [] old;
+}
+
+// Symbol of a sample as "name+offset" from the symbols loaded in the
+// debugger for its address space, NULL if there is none.
+const char *bx_profile_c::symbol(const sample_t *s)
+{
+#if BX_DEBUGGER
+  if (s->ip <= 0xffffffff) {
+    const char *name = bx_dbg_symbolic_address((Bit32u)(s->cr3 >> 12), (Bit32u) s->ip, 0);
+    if (strcmp(name, "no symbol") && strcmp(name, "unk. ctxt"))
+      return name;
+  }
+#endif
+  return NULL;
+}
+
+typedef struct {
+  Bit32u count;
+  Bit32u n;  // table index
+} profile_top_t;
+
+static int profile_compare_count(const void *a, const void *b)
+{
+  Bit32u ca = ((const profile_top_t *) a)->count, cb = ((const profile_top_t *) b)->count;
+  return (ca < cb) ? 1 : (ca > cb) ? -1 : 0;
+}
+
+// Log the addresses sampled most often.
+void bx_profile_c::report(void)
+{
+  BX_INFO(("profile: " FMT_LL "u samples, " FMT_LL "u idle, %u distinct addresses",
+           samples, idle, used));
+  if (samples == 0)
+    return;
+
+  profile_top_t *top = new profile_top_t[used];
+  Bit32u num = 0;
+  for (Bit32u i = 0; i < table_size; i++) {
+    if (table[i].count == 0) continue;
+    top[num].count = table[i].count;
+    top[num].n = i;
+    num++;
+  }
+  qsort(top, num, sizeof(top[0]), profile_compare_count);
+  for (Bit32u i = 0; i < num && i < BX_PROFILE_REPORT_TOP; i++) {
+    const sample_t *s = &table[top[i].n];
+    const char *name = symbol(s);
+    BX_INFO(("%6.2f%% cr3=" FMT_LL "x cpl=%u ip=" FMT_LL "x %s",
+             100.0 * s->count / samples, s->cr3, (unsigned) s->cpl, s->ip,
+             name ? name : ""));
+  }
+  delete [] top;
+}
+
+//
+// The profile is written in the protocol buffer format of pprof, without
+// compression. Only the fields used are encoded, the buffers below hold a
+// message while it is built.
+//
+typedef struct {
+  Bit8u *data;
+  Bit32u len, size;
+} pb_buf_t;
+
+static void pb_put(pb_buf_t *b, const void *data, Bit32u len)
+{
+  if (b->len + len > b->size) {
+    do b->size = b->size ? b->size * 2 : 256; while (b->len + len > b->size);
+    b->data = (Bit8u *) realloc(b->data, b->size);
+  }
+  memcpy(b->data + b->len, data, len);
+  b->len += len;
+}
+
+static void pb_varint(pb_buf_t *b, Bit64u val)
+{
+  Bit8u tmp[10];
+  unsigned n = 0;
+  while (val >= 0x80) {
+    tmp[n++] = (Bit8u)(val | 0x80);
+    val >>= 7;
+  }
+  tmp[n++] = (Bit8u) val;
+  pb_put(b, tmp, n);
+}
+
+static void pb_uint(pb_buf_t *b, unsigned field, Bit64u val)
+{
+  pb_varint(b, field << 3);
+  pb_varint(b, val);
+}
+
+static void pb_bytes(pb_buf_t *b, unsigned field, const void *data, Bit32u len)
+{
+  pb_varint(b, (field << 3) | 2);
+  pb_varint(b, len);
+  pb_put(b, data, len);
+}
+
+// append the message m as field of b and empty m for the next one
+static void pb_message(pb_buf_t *b, unsigned field, pb_buf_t *m)
+{
+  pb_bytes(b, field, m->data, m->len);
+  m->len = 0;
+}
+
+// pprof profile.proto field numbers
+#define PB_PROFILE_SAMPLE_TYPE   1
+#define PB_PROFILE_SAMPLE        2
+#define PB_PROFILE_MAPPING       3
+#define PB_PROFILE_LOCATION      4
+#define PB_PROFILE_FUNCTION      5
+#define PB_PROFILE_STRING_TABLE  6
+#define PB_PROFILE_PERIOD_TYPE  11
+#define PB_PROFILE_PERIOD       12
+
+// fixed entries of the string table
+enum {
+  PB_STR_EMPTY, PB_STR_SAMPLES, PB_STR_COUNT, PB_STR_CPU, PB_STR_NANOSECONDS,
+  PB_STR_CR3, PB_STR_CPL, PB_STR_GUEST, PB_STR_CPL0, PB_STR_FIRST_FREE = PB_STR_CPL0 + 4
+};
+
+static const char *pb_strings[PB_STR_FIRST_FREE] = {
+  "", "samples", "count", "cpu", "nanoseconds", "cr3", "cpl", "guest",
+  "0", "1", "2", "3"
+};
+
+//
+// Each entry of the table is a sample with its own location, the CR3 and
+// the CPL are string labels of the sample (pprof drops numeric labels of
+// value 0). The location has the function of its
+// symbol without the offset, pprof adds the samples of a function. The
+// single mapping covers all addresses, pprof can also take the symbols
+// from the guest binary given on its command line.
+//
+void bx_profile_c::write_profile(const char *path)
+{
+  pb_buf_t prof = { NULL, 0, 0 }, strs = { NULL, 0, 0 };
+  pb_buf_t msg = { NULL, 0, 0 }, sub = { NULL, 0, 0 };
+  Bit32u ips = SIM->get_param_num(BXPN_IPS)->get();
+  Bit64u period_ns = (ips > 0) ? ((Bit64u) period * 1000000000 / ips) : period;
+  Bit32u num_strings = PB_STR_FIRST_FREE, id = 0;
+  bx_bool symbols = 0;
+
+  for (Bit32u i = 0; i < PB_STR_FIRST_FREE; i++)
+    pb_bytes(&strs, PB_PROFILE_STRING_TABLE, pb_strings[i], strlen(pb_strings[i]));
+
+  pb_uint(&msg, 1, PB_STR_SAMPLES);
+  pb_uint(&msg, 2, PB_STR_COUNT);
+  pb_message(&prof, PB_PROFILE_SAMPLE_TYPE, &msg);
+  pb_uint(&msg, 1, PB_STR_CPU);
+  pb_uint(&msg, 2, PB_STR_NANOSECONDS);
+  pb_message(&prof, PB_PROFILE_SAMPLE_TYPE, &msg);
+
+  for (Bit32u i = 0; i < table_size; i++) {
+    const sample_t *s = &table[i];
+    if (s->count == 0) continue;
+    id++;
+    // sample: packed location ids and values, labels
+    pb_varint(&sub, id);
+    pb_message(&msg, 1, &sub);
+    pb_varint(&sub, s->count);
+    pb_varint(&sub, s->count * period_ns);
+    pb_message(&msg, 2, &sub);
+    char cr3[20];
+    sprintf(cr3, "0x" FMT_LL "x", s->cr3);
+    pb_bytes(&strs, PB_PROFILE_STRING_TABLE, cr3, strlen(cr3));
+    pb_uint(&sub, 1, PB_STR_CR3);
+    pb_uint(&sub, 2, num_strings++);
+    pb_message(&msg, 3, &sub);
+    pb_uint(&sub, 1, PB_STR_CPL);
+    pb_uint(&sub, 2, PB_STR_CPL0 + (s->cpl & 3));
+    pb_message(&msg, 3, &sub);
+    pb_message(&prof, PB_PROFILE_SAMPLE, &msg);
+
+    const char *name = symbol(s);
+    pb_uint(&msg, 1, id);
+    pb_uint(&msg, 2, 1);
+    pb_uint(&msg, 3, s->ip);
+    if (name != NULL) {
+      pb_uint(&sub, 1, id);
+      pb_message(&msg, 4, &sub);
+    }
+    pb_message(&prof, PB_PROFILE_LOCATION, &msg);
+
+    if (name != NULL) {
+      const char *plus = strrchr(name, '+');
+      pb_bytes(&strs, PB_PROFILE_STRING_TABLE, name, plus ? (Bit32u)(plus - name) : strlen(name));
+      pb_uint(&msg, 1, id);
+      pb_uint(&msg, 2, num_strings);
+      pb_uint(&msg, 3, num_strings);
+      pb_message(&prof, PB_PROFILE_FUNCTION, &msg);
+      num_strings++;
+      symbols = 1;
+    }
+  }
+
+  pb_uint(&msg, 1, 1);
+  pb_uint(&msg, 2, 0);
+  pb_uint(&msg, 3, BX_CONST64(0xffffffffffffffff));
+  pb_uint(&msg, 5, PB_STR_GUEST);
+  pb_uint(&msg, 7, symbols);
+  pb_message(&prof, PB_PROFILE_MAPPING, &msg);
+
+  pb_uint(&msg, 1, PB_STR_CPU);
+  pb_uint(&msg, 2, PB_STR_NANOSECONDS);
+  pb_message(&prof, PB_PROFILE_PERIOD_TYPE, &msg);
+  pb_uint(&prof, PB_PROFILE_PERIOD, period_ns);
+  pb_put(&prof, strs.data, strs.len);
+
+  FILE *fp = fopen(path, "wb");
+  if (fp == NULL) {
+    BX_ERROR(("cannot create profile '%s'", path));
+  }
+  else {
+    if (fwrite(prof.data, 1, prof.len, fp) != prof.len)
+      BX_ERROR(("error writing profile '%s'", path));
+    else
+      BX_INFO(("profile of " FMT_LL "u samples written to '%s'", samples, path));
+    fclose(fp);
+  }
+  free(prof.data);
+  free(strs.data);
+  free(msg.data);
+  free(sub.data);
+}
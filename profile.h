@@ -0,0 +1,70 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2010  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef BX_PROFILE_H
+#define BX_PROFILE_H
+
+//
+// Sampling profiler of the guest code. A timer samples the address space
+// (CR3), the linear instruction pointer and the CPL of each CPU every
+// profile_period ticks, there is no per instruction hook. The samples are
+// counted in a hash table and written on exit as a pprof CPU profile,
+// with the symbols loaded in the debugger if there are any.
+//
+
+#define BX_PROFILE_DEFAULT_PERIOD  10000
+
+BOCHSAPI extern class bx_profile_c bx_profile;
+
+class BOCHSAPI bx_profile_c : public logfunctions {
+public:
+  bx_profile_c();
+ ~bx_profile_c();
+
+  void init(void);
+  void start(void);
+  void exit(void);
+
+private:
+  typedef struct {
+    Bit64u cr3;
+    Bit64u ip;     // linear address
+    Bit32u count;  // 0 if the entry is free
+    Bit8u  cpl;
+  } sample_t;
+
+  sample_t *table;
+  Bit32u table_size, used;  // table_size is a power of two
+  Bit64u samples, idle;
+  Bit32u period;
+  int    timer_index;
+
+  static void timer_handler(void *this_ptr);
+  void timer(void);
+  void add(Bit64u cr3, Bit64u ip, Bit8u cpl);
+  void grow(void);
+  const char *symbol(const sample_t *s);
+  void write_profile(const char *path);
+  void report(void);
+};
+
+#endif
@@ -0,0 +1,454 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2010  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+#include "bochs.h"
+#include "param_names.h"
+#include "iodev/iodev.h"
+
+#define LOG_THIS bx_replay.
+
+bx_replay_c bx_replay;
+
+//
+// The log starts with the magic and the Bit64u tick the recording started
+// at. Each record is the Bit8u type and the ticks since the previous record
+// as a varint. The host time follows as the zigzag varint of the change
+// since the previous value, the other records have the data length as a
+// varint and the data. Network frames have the device index first. A paste
+// longer than a record is split into leading parts and a final paste record.
+//
+#define BX_REPLAY_MAGIC     "BXREPLY1"
+#define BX_REPLAY_MAX_DATA  65536
+
+static void put_varint(FILE *fp, Bit64u val)
+{
+  while (val >= 0x80) {
+    putc((int)(val & 0x7f) | 0x80, fp);
+    val >>= 7;
+  }
+  putc((int) val, fp);
+}
+
+static bx_bool get_varint(FILE *fp, Bit64u *val)
+{
+  Bit64u result = 0;
+  for (unsigned shift = 0; shift < 64; shift += 7) {
+    int c = getc(fp);
+    if (c == EOF) return 0;
+    result |= (Bit64u)(c & 0x7f) << shift;
+    if (! (c & 0x80)) {
+      *val = result;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+bx_replay_c::bx_replay_c()
+{
+  put("RPLAY");
+  mode = BX_REPLAY_OFF;
+  timer_index = BX_NULL_TIMER_HANDLE;
+  log = NULL;
+  last_ticks = last_time = 0;
+  queue = NULL;
+  queue_len = queue_size = 0;
+  memset(&next, 0, sizeof(next));
+  have_next = 0;
+  paste_buf = NULL;
+  paste_len = 0;
+  num_net = 0;
+}
+
+bx_replay_c::~bx_replay_c()
+{
+  exit();
+}
+
+void bx_replay_c::init(void)
+{
+  if (timer_index == BX_NULL_TIMER_HANDLE) {
+    // also registered when neither recording nor replaying: a checkpoint
+    // saved while recording is restored into the replay run, its list of
+    // timers has to match
+    timer_index = bx_pc_system.register_timer_ticks(this, timer_handler, 1, 0, 0, "replay");
+  }
+  num_net = 0;
+  if (SIM->get_param_string(BXPN_REPLAY_PATH)->getptr()[0] != 0)
+    mode = BX_REPLAY_REPLAY;
+  else if (SIM->get_param_string(BXPN_RECORD_PATH)->getptr()[0] != 0)
+    mode = BX_REPLAY_RECORD;
+  else
+    mode = BX_REPLAY_OFF;
+  // a restored machine starts after the restore, the record and replay
+  // of the inputs read during the initialization are only needed if
+  // the machine starts from power on
+  if (! SIM->get_param_bool(BXPN_RESTORE_FLAG)->get())
+    start();
+}
+
+void bx_replay_c::start(void)
+{
+  Bit64u now = bx_pc_system.time_ticks();
+
+  last_ticks = now;
+  last_time = 0;
+  if (mode == BX_REPLAY_RECORD) {
+    const char *path = SIM->get_param_string(BXPN_RECORD_PATH)->getptr();
+    log = fopen(path, "wb");
+    if (log == NULL) {
+      BX_ERROR(("cannot create input log '%s'", path));
+      mode = BX_REPLAY_OFF;
+      return;
+    }
+    fwrite(BX_REPLAY_MAGIC, 1, 8, log);
+    fwrite(&now, sizeof(now), 1, log);
+    BX_INFO(("recording inputs to '%s' from tick " FMT_LL "u", path, now));
+  }
+  else if (mode == BX_REPLAY_REPLAY) {
+    const char *path = SIM->get_param_string(BXPN_REPLAY_PATH)->getptr();
+    char magic[8];
+    log = fopen(path, "rb");
+    if (log == NULL || fread(magic, 1, 8, log) != 8 || memcmp(magic, BX_REPLAY_MAGIC, 8) ||
+        fread(&last_ticks, sizeof(last_ticks), 1, log) != 1)
+    {
+      BX_PANIC(("'%s' is not an input log", path));
+      stop();
+      return;
+    }
+    if (last_ticks > now) {
+      BX_PANIC(("input log '%s' starts at tick " FMT_LL "u, after the simulation at tick " FMT_LL "u",
+                path, last_ticks, now));
+      stop();
+      return;
+    }
+    next.data = new Bit8u[BX_REPLAY_MAX_DATA];
+    // a checkpoint saved during the recording continues with the inputs
+    // delivered after it
+    have_next = read_record();
+    while (have_next && next.ticks < now)
+      have_next = read_record();
+    BX_INFO(("replaying inputs from '%s' at tick " FMT_LL "u", path, now));
+    schedule();
+  }
+}
+
+void bx_replay_c::stop(void)
+{
+  if (log != NULL) {
+    fclose(log);
+    log = NULL;
+  }
+  if (next.data != NULL) {
+    delete [] next.data;
+    next.data = NULL;
+  }
+  have_next = 0;
+  queue_len = 0;
+  if (paste_buf != NULL) {
+    delete [] paste_buf;
+    paste_buf = NULL;
+  }
+  paste_len = 0;
+  mode = BX_REPLAY_OFF;
+  if (timer_index != BX_NULL_TIMER_HANDLE)
+    bx_pc_system.deactivate_timer(timer_index);
+}
+
+void bx_replay_c::exit(void)
+{
+  if (mode == BX_REPLAY_RECORD)
+    BX_INFO(("input recording stopped at tick " FMT_LL "u", bx_pc_system.time_ticks()));
+  if (log != NULL) {
+    fclose(log);
+    log = NULL;
+  }
+  if (next.data != NULL) {
+    delete [] next.data;
+    next.data = NULL;
+  }
+  have_next = 0;
+  if (queue != NULL) {
+    free(queue);
+    queue = NULL;
+  }
+  queue_len = queue_size = 0;
+  if (paste_buf != NULL) {
+    delete [] paste_buf;
+    paste_buf = NULL;
+  }
+  paste_len = 0;
+  mode = BX_REPLAY_OFF;
+}
+
+void bx_replay_c::write_record(Bit8u type, Bit8u dev, const void *buf, unsigned len, Bit64u value)
+{
+  Bit64u now = bx_pc_system.time_ticks();
+
+  putc(type, log);
+  put_varint(log, now - last_ticks);
+  last_ticks = now;
+  if (type == BX_REPLAY_HOST_TIME) {
+    Bit64s delta = (Bit64s)(value - last_time);
+    put_varint(log, ((Bit64u) delta << 1) ^ (Bit64u)(delta >> 63));
+    last_time = value;
+    return;
+  }
+  if (type == BX_REPLAY_NET)
+    putc(dev, log);
+  put_varint(log, len);
+  fwrite(buf, 1, len, log);
+}
+
+// Read the next record of the replayed log, returns 0 at its end.
+bx_bool bx_replay_c::read_record(void)
+{
+  Bit64u val;
+  int type;
+
+  if (log == NULL || (type = getc(log)) == EOF || !get_varint(log, &val))
+    return 0;
+  next.type = (Bit8u) type;
+  next.ticks = last_ticks + val;
+  last_ticks = next.ticks;
+  next.dev = 0;
+  if (next.type == BX_REPLAY_HOST_TIME) {
+    if (! get_varint(log, &val))
+      return 0;
+    last_time += (val >> 1) ^ (Bit64u)(-(Bit64s)(val & 1));
+    next.value = last_time;
+    next.len = 0;
+    return 1;
+  }
+  if (next.type == BX_REPLAY_NET) {
+    int dev = getc(log);
+    if (dev == EOF)
+      return 0;
+    next.dev = (Bit8u) dev;
+  }
+  if (! get_varint(log, &val) || val >= BX_REPLAY_MAX_DATA)
+    return 0;
+  next.len = (Bit16u) val;
+  return (fread(next.data, 1, next.len, log) == next.len);
+}
+
+// Set the timer to the tick of the next input to deliver. Host values
+// are read by the simulation, the timer is set again after the read.
+void bx_replay_c::schedule(void)
+{
+  Bit64u now = bx_pc_system.time_ticks();
+
+  if (! have_next) {
+    BX_INFO(("replay finished at tick " FMT_LL "u", now));
+    stop();
+    return;
+  }
+  if (next.type == BX_REPLAY_HOST_TIME)
+    return;
+  if (next.ticks <= now) {
+    BX_PANIC(("replay diverged: input for tick " FMT_LL "u missed at tick " FMT_LL "u", next.ticks, now));
+    stop();
+    return;
+  }
+  bx_pc_system.activate_timer_ticks(timer_index, next.ticks - now, 0);
+}
+
+void bx_replay_c::timer_handler(void *this_ptr)
+{
+  ((bx_replay_c *) this_ptr)->timer();
+}
+
+void bx_replay_c::timer(void)
+{
+  Bit64u now = bx_pc_system.time_ticks();
+  record_t rec;
+  Bit32u at = 0;
+
+  if (mode == BX_REPLAY_RECORD) {
+    while (at < queue_len) {
+      rec.ticks = now;
+      rec.type = queue[at];
+      rec.dev = queue[at + 1];
+      memcpy(&rec.len, queue + at + 2, 2);
+      rec.data = queue + at + 4;
+      write_record(rec.type, rec.dev, rec.data, rec.len, 0);
+      deliver(&rec);
+      at += 4 + rec.len;
+    }
+    queue_len = 0;
+  }
+  else if (mode == BX_REPLAY_REPLAY) {
+    while (have_next && next.type != BX_REPLAY_HOST_TIME && next.ticks == now) {
+      deliver(&next);
+      have_next = read_record();
+    }
+    schedule();
+  }
+}
+
+// Queue an input of the host for the timer.
+void bx_replay_c::push(Bit8u type, Bit8u dev, const void *buf, unsigned len)
+{
+  Bit16u len16 = (Bit16u) len;
+
+  if (queue_len + 4 + len > queue_size) {
+    queue_size = (queue_len + 4 + len) * 2;
+    queue = (Bit8u *) realloc(queue, queue_size);
+  }
+  Bit8u *rec = queue + queue_len;
+  rec[0] = type;
+  rec[1] = dev;
+  memcpy(rec + 2, &len16, 2);
+  memcpy(rec + 4, buf, len);
+  if (queue_len == 0)
+    bx_pc_system.activate_timer_ticks(timer_index, 1, 0);
+  queue_len += 4 + len;
+}
+
+void bx_replay_c::deliver(const record_t *rec)
+{
+  Bit32u key;
+  Bit32s mouse[4];
+  Bit8u *bytes;
+
+  switch (rec->type) {
+    case BX_REPLAY_KEY:
+      memcpy(&key, rec->data, sizeof(key));
+      bx_devices.pluginKeyboard->gen_scancode(key);
+      break;
+    case BX_REPLAY_PASTE_PART:
+    case BX_REPLAY_PASTE:
+      // the parts are collected until the final record
+      bytes = new Bit8u[paste_len + rec->len];
+      if (paste_buf != NULL) {
+        memcpy(bytes, paste_buf, paste_len);
+        delete [] paste_buf;
+      }
+      memcpy(bytes + paste_len, rec->data, rec->len);
+      paste_len += rec->len;
+      if (rec->type == BX_REPLAY_PASTE_PART) {
+        paste_buf = bytes;
+        break;
+      }
+      // the keyboard frees the paste buffer
+      bx_devices.pluginKeyboard->paste_bytes(bytes, paste_len);
+      paste_buf = NULL;
+      paste_len = 0;
+      break;
+    case BX_REPLAY_MOUSE:
+      memcpy(mouse, rec->data, sizeof(mouse));
+      bx_devices.mouse_motion(mouse[0], mouse[1], mouse[2], (unsigned) mouse[3]);
+      break;
+    case BX_REPLAY_NET:
+      if (rec->dev < num_net)
+        net[rec->dev].rxh(net[rec->dev].dev, rec->data, rec->len);
+      break;
+    default:
+      BX_PANIC(("replay diverged: unexpected input type %u at tick " FMT_LL "u", rec->type, rec->ticks));
+      stop();
+  }
+}
+
+void bx_replay_c::gen_scancode(Bit32u key)
+{
+  if (mode == BX_REPLAY_RECORD)
+    push(BX_REPLAY_KEY, 0, &key, sizeof(key));
+  else if (mode == BX_REPLAY_OFF)
+    bx_devices.pluginKeyboard->gen_scancode(key);
+}
+
+void bx_replay_c::paste_bytes(Bit8u *bytes, Bit32s length)
+{
+  if (mode == BX_REPLAY_OFF) {
+    bx_devices.pluginKeyboard->paste_bytes(bytes, length);
+    return;
+  }
+  if (mode == BX_REPLAY_RECORD) {
+    Bit32s at = 0;
+    while (length - at >= BX_REPLAY_MAX_DATA) {
+      push(BX_REPLAY_PASTE_PART, 0, bytes + at, BX_REPLAY_MAX_DATA - 1);
+      at += BX_REPLAY_MAX_DATA - 1;
+    }
+    push(BX_REPLAY_PASTE, 0, bytes + at, length - at);
+  }
+  delete [] bytes;
+}
+
+void bx_replay_c::mouse_motion(int delta_x, int delta_y, int delta_z, unsigned button_state)
+{
+  if (mode == BX_REPLAY_RECORD) {
+    Bit32s mouse[4] = { delta_x, delta_y, delta_z, (Bit32s) button_state };
+    push(BX_REPLAY_MOUSE, 0, mouse, sizeof(mouse));
+  }
+  else if (mode == BX_REPLAY_OFF) {
+    bx_devices.mouse_motion(delta_x, delta_y, delta_z, button_state);
+  }
+}
+
+bx_replay_rx_handler_t bx_replay_c::register_net(bx_replay_rx_handler_t rxh, void *dev)
+{
+  if (mode == BX_REPLAY_OFF)
+    return rxh;
+  if (num_net >= BX_REPLAY_MAX_NET) {
+    BX_PANIC(("too many network devices for input recording"));
+    return rxh;
+  }
+  net[num_net].rxh = rxh;
+  net[num_net].dev = dev;
+  num_net++;
+  return net_rx_handler;
+}
+
+void bx_replay_c::net_rx_handler(void *arg, const void *buf, unsigned len)
+{
+  unsigned i;
+
+  for (i = 0; i < bx_replay.num_net; i++) {
+    if (bx_replay.net[i].dev == arg) break;
+  }
+  if (i == bx_replay.num_net)
+    return;
+  // frames of the host are dropped during the replay
+  if (bx_replay.mode == BX_REPLAY_RECORD)
+    bx_replay.push(BX_REPLAY_NET, i, buf, len);
+  else if (bx_replay.mode == BX_REPLAY_OFF)
+    bx_replay.net[i].rxh(arg, buf, len);
+}
+
+Bit64u bx_replay_c::host_time(Bit64u value)
+{
+  if (mode == BX_REPLAY_RECORD && log != NULL) {
+    write_record(BX_REPLAY_HOST_TIME, 0, NULL, 0, value);
+  }
+  else if (mode == BX_REPLAY_REPLAY && log != NULL) {
+    Bit64u now = bx_pc_system.time_ticks();
+    if (! have_next || next.type != BX_REPLAY_HOST_TIME || next.ticks != now) {
+      BX_PANIC(("replay diverged: host time read at tick " FMT_LL "u not in the log", now));
+      stop();
+      return value;
+    }
+    value = next.value;
+    have_next = read_record();
+    schedule();
+  }
+  return value;
+}
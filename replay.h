@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2010  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef BX_REPLAY_H
+#define BX_REPLAY_H
+
+//
+// Record and replay of the external inputs of the simulation. Everything
+// else is deterministic, so a recorded run can be repeated exactly, also
+// starting from a checkpoint saved during the recording.
+//
+// Inputs pushed by the host (keys, mouse, paste, network frames) are not
+// passed to the devices right away, they are queued and delivered by the
+// replay timer. The log has the tick of the delivery, the replay delivers
+// the input from the same timer at the same tick. Host values read by the
+// simulation (real time clock) are logged when read and returned in the
+// same order by the replay. The log is written and read sequentially.
+//
+
+#define BX_REPLAY_OFF     0
+#define BX_REPLAY_RECORD  1
+#define BX_REPLAY_REPLAY  2
+
+// log record types
+#define BX_REPLAY_KEY        1
+#define BX_REPLAY_MOUSE      2
+#define BX_REPLAY_PASTE      3
+#define BX_REPLAY_NET        4
+#define BX_REPLAY_HOST_TIME  5
+#define BX_REPLAY_PASTE_PART 6  // leading part of a long paste
+
+#define BX_REPLAY_MAX_NET    4
+
+typedef void (*bx_replay_rx_handler_t)(void *arg, const void *buf, unsigned len);
+
+BOCHSAPI extern class bx_replay_c bx_replay;
+
+class BOCHSAPI bx_replay_c : public logfunctions {
+public:
+  bx_replay_c();
+ ~bx_replay_c();
+
+  void init(void);
+  void start(void);
+  void exit(void);
+
+  unsigned get_mode() const { return mode; }
+
+  // inputs pushed by the host, used instead of calling the devices
+  void gen_scancode(Bit32u key);
+  void paste_bytes(Bit8u *bytes, Bit32s length);
+  void mouse_motion(int delta_x, int delta_y, int delta_z, unsigned button_state);
+  // a network backend receiving frames for dev with the rx handler rxh
+  // calls the returned handler instead if the inputs are recorded
+  bx_replay_rx_handler_t register_net(bx_replay_rx_handler_t rxh, void *dev);
+  // value read from the host
+  Bit64u host_time(Bit64u value);
+
+private:
+  typedef struct {
+    Bit64u ticks;
+    Bit8u  type;
+    Bit8u  dev;
+    Bit16u len;
+    Bit8u *data;
+    Bit64u value;  // host time
+  } record_t;
+
+  struct {
+    bx_replay_rx_handler_t rxh;
+    void *dev;
+  } net[BX_REPLAY_MAX_NET];
+  unsigned num_net;
+
+  unsigned mode;
+  int    timer_index;
+  FILE  *log;
+  // tick and host time of the previous record, the log stores the deltas
+  Bit64u last_ticks;
+  Bit64u last_time;
+  // recording: inputs waiting for the replay timer
+  Bit8u *queue;
+  Bit32u queue_len, queue_size;
+  // replay: the next record of the log
+  record_t next;
+  bx_bool  have_next;
+  // leading parts of a paste split into several records
+  Bit8u *paste_buf;
+  Bit32u paste_len;
+
+  static void timer_handler(void *this_ptr);
+  void timer(void);
+  void push(Bit8u type, Bit8u dev, const void *buf, unsigned len);
+  void write_record(Bit8u type, Bit8u dev, const void *buf, unsigned len, Bit64u value);
+  bx_bool read_record(void);
+  void deliver(const record_t *rec);
+  void schedule(void);
+  void stop(void);
+  static void net_rx_handler(void *arg, const void *buf, unsigned len);
+};
+
+#endif